@@ -0,0 +1,84 @@
+/*!
+    \file itch_convert.cpp
+    \brief NASDAQ ITCH to normalized market events converter
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/replay/event_file.h"
+#include "trader/replay/itch_converter.h"
+
+#include "filesystem/file.h"
+#include "system/stream.h"
+
+#include <OptionParser.h>
+
+#include <iostream>
+#include <memory>
+
+using namespace CppCommon;
+using namespace CppTrader::Replay;
+
+class MyITCHConverter : public ITCHConverter
+{
+public:
+    explicit MyITCHConverter(EventWriter& writer) : _writer(writer) {}
+
+protected:
+    bool onEvent(const Event& event) override { _writer.Write(event); return true; }
+
+private:
+    EventWriter& _writer;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input ITCH file name");
+    parser.add_option("-o", "--output").dest("output").help("Output events file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || !options.is_set("output"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    EventWriter writer;
+    writer.Open(Path(options.get("output")));
+
+    MyITCHConverter converter(writer);
+
+    // Open the input file or stdin
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input"))
+    {
+        File* file = new File(Path(options.get("input")));
+        file->Open(true, false);
+        input.reset(file);
+    }
+
+    // Perform input
+    size_t size;
+    uint8_t buffer[8192];
+    std::cout << "ITCH converting...";
+    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    {
+        // Process the buffer
+        converter.Process(buffer, size);
+    }
+    writer.Close();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << converter.errors() << std::endl;
+    std::cout << "Total ITCH messages: " << converter.messages() << std::endl;
+    std::cout << "Total events: " << writer.events() << std::endl;
+
+    return 0;
+}
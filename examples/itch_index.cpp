@@ -0,0 +1,98 @@
+/*!
+    \file itch_index.cpp
+    \brief NASDAQ ITCH time index builder
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_manager.h"
+#include "trader/providers/nasdaq/itch_index.h"
+#include "trader/replay/event_replayer.h"
+#include "trader/replay/itch_converter.h"
+
+#include "filesystem/file.h"
+#include "system/stream.h"
+
+#include <OptionParser.h>
+
+#include <iostream>
+#include <memory>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Replay;
+
+class MyITCHConverter : public ITCHConverter
+{
+public:
+    explicit MyITCHConverter(MarketManager& market) : _replayer(market) {}
+
+protected:
+    bool onEvent(const Event& event) override { _replayer.Replay(event); return true; }
+
+private:
+    EventReplayer _replayer;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input ITCH file name");
+    parser.add_option("-o", "--output").dest("output").help("Output index file name");
+    parser.add_option("-t", "--interval").dest("interval").action("store").type("int").set_default(60).help("Checkpoints interval in seconds. Default: %default");
+    parser.add_option("-s", "--snapshots").dest("snapshots").action("store_true").help("Store order book snapshots");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || !options.is_set("output"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    uint64_t interval = (uint64_t)options.get("interval") * 1000000000;
+    bool snapshots = options.get("snapshots");
+
+    MarketManager market;
+    MyITCHConverter converter(market);
+
+    ITCHIndex index;
+    ITCHIndexBuilder builder(index, interval, snapshots ? &converter : nullptr, snapshots ? &market : nullptr);
+
+    // Open the input file or stdin
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input"))
+    {
+        File* file = new File(Path(options.get("input")));
+        file->Open(true, false);
+        input.reset(file);
+    }
+
+    // Perform input
+    size_t size;
+    uint8_t buffer[8192];
+    std::cout << "ITCH indexing...";
+    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    {
+        // Process the buffer
+        if (!builder.Process(buffer, size))
+        {
+            std::cerr << "Invalid ITCH stream at offset " << builder.offset() << std::endl;
+            return -1;
+        }
+    }
+    index.Save(Path(options.get("output")));
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Total ITCH messages: " << builder.messages() << std::endl;
+    std::cout << "Total checkpoints: " << index.entries().size() << std::endl;
+    std::cout << "Total snapshot events: " << index.snapshots().size() << std::endl;
+
+    return 0;
+}
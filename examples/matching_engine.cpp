@@ -12,9 +12,14 @@
 
 #include "trader/matching/market_manager.h"
 #include "trader/kdbp_db.h"
+#include "trader/kdb_ipc.h"
+#include "trader/kdb_loader.h"
+#include "trader/kdb_sink.h"
 #include "trader/risk/position.h"
+#include "trader/risk/position_book.h"
 #include "system/stream.h"
 #include "trader/matching/symbol.h"
+#include "trader/matching/symbol_registry.h"
 
 #include <iostream>
 #include <thread>
@@ -24,6 +29,7 @@
 
 
 
+using namespace CppTrader;
 using namespace CppTrader::Matching;
 using namespace CppTrader::Risk;
 using namespace std;
@@ -72,78 +78,140 @@ static I handleOk(I handle)
     return 0;
 }
 
+// Orders and transactions table row
+struct OrderRow
+{
+    Order Data;
+    uint64_t Time;
+    uint64_t ExecutedPrice;
+    uint64_t ExecutedQuantity;
+};
+
+// Order row fields which are not plain members of the row
+uint64_t order_id(const OrderRow &row) { return row.Data.Id; }
+uint32_t order_symbol_id(const OrderRow &row) { return row.Data.SymbolId; }
+uint64_t order_executed_quantity(const OrderRow &row) { return row.Data.ExecutedQuantity; }
+uint64_t order_leaves_quantity(const OrderRow &row) { return row.Data.LeavesQuantity; }
+uint64_t order_max_visible_quantity(const OrderRow &row) { return row.Data.MaxVisibleQuantity; }
+uint64_t order_price(const OrderRow &row) { return row.Data.Price; }
+uint64_t order_quantity(const OrderRow &row) { return row.Data.Quantity; }
+uint8_t order_side(const OrderRow &row) { return (uint8_t)row.Data.Side; }
+uint64_t order_slippage(const OrderRow &row) { return row.Data.Slippage; }
+uint64_t order_stop_price(const OrderRow &row) { return row.Data.StopPrice; }
+uint8_t order_time_in_force(const OrderRow &row) { return (uint8_t)row.Data.TimeInForce; }
+int64_t order_trailing_distance(const OrderRow &row) { return row.Data.TrailingDistance; }
+int64_t order_trailing_step(const OrderRow &row) { return row.Data.TrailingStep; }
+uint8_t order_type(const OrderRow &row) { return (uint8_t)row.Data.Type; }
+uint64_t order_account_id(const OrderRow &row) { return row.Data.AccountId; }
+uint8_t order_status(const OrderRow &row) { return (uint8_t)row.Data.Status; }
+
+// Orders and transactions kdb+ IPC messages (serialized by the kdb+ sink writer thread into reused buffers)
+typedef KdbIpcMessage<OrderRow,
+    KdbField<KJ, &order_id>,
+    KdbField<KH, &order_symbol_id>,
+    KdbField<KJ, &order_executed_quantity>,
+    KdbField<KJ, &order_leaves_quantity>,
+    KdbField<KJ, &order_max_visible_quantity>,
+    KdbField<KJ, &order_price>,
+    KdbField<KJ, &order_quantity>,
+    KdbField<KH, &order_side>,
+    KdbField<KJ, &order_slippage>,
+    KdbField<KJ, &order_stop_price>,
+    KdbField<KH, &order_time_in_force>,
+    KdbField<KJ, &order_trailing_distance>,
+    KdbField<KJ, &order_trailing_step>,
+    KdbField<KH, &order_type>,
+    KdbField<KJ, &OrderRow::Time>,
+    KdbField<KJ, &order_account_id>,
+    KdbField<KJ, &OrderRow::ExecutedPrice>,
+    KdbField<KJ, &OrderRow::ExecutedQuantity>,
+    KdbField<KH, &order_status>> OrdersMessage;
+
+// Positions table row
+struct PositionRow
+{
+    Position Data;
+    uint64_t Time;
+};
+
+// Position row fields
+uint64_t position_id(const PositionRow &row) { return row.Data.Id; }
+uint32_t position_symbol_id(const PositionRow &row) { return row.Data.SymbolId; }
+double position_avg_entry_price(const PositionRow &row) { return row.Data.AvgEntryPrice; }
+uint64_t position_quantity(const PositionRow &row) { return row.Data.Quantity; }
+uint8_t position_side(const PositionRow &row) { return (uint8_t)row.Data.Side; }
+uint64_t position_account_id(const PositionRow &row) { return row.Data.AccountId; }
+double position_risk_z(const PositionRow &row) { return row.Data.RiskZ; }
+double position_risk_c(const PositionRow &row) { return row.Data.RiskC; }
+double position_funding(const PositionRow &row) { return row.Data.Funding; }
+uint64_t position_mark_price(const PositionRow &row) { return row.Data.MarkPrice; }
+uint64_t position_index_price(const PositionRow &row) { return row.Data.IndexPrice; }
+double position_realized_pnl(const PositionRow &row) { return row.Data.RealizedPnL; }
+double position_unrealized_pnl(const PositionRow &row) { return row.Data.UnrealizedPnL; }
+uint64_t position_funding_time(const PositionRow &row) { return row.Data.FundingTime; }
+
+// Positions kdb+ IPC message (all dirty positions are upserted with a single message)
+typedef KdbIpcMessage<PositionRow,
+    KdbField<KJ, &position_id>,
+    KdbField<KH, &position_symbol_id>,
+    KdbField<KF, &position_avg_entry_price>,
+    KdbField<KJ, &position_quantity>,
+    KdbField<KH, &position_side>,
+    KdbField<KJ, &PositionRow::Time>,
+    KdbField<KJ, &position_account_id>,
+    KdbField<KF, &position_risk_z>,
+    KdbField<KF, &position_risk_c>,
+    KdbField<KF, &position_funding>,
+    KdbField<KJ, &position_mark_price>,
+    KdbField<KJ, &position_index_price>,
+    KdbField<KF, &position_realized_pnl>,
+    KdbField<KF, &position_unrealized_pnl>,
+    KdbField<KJ, &position_funding_time>> PositionsMessage;
+
 class MyMarketHandler : public MarketHandler
 {
 public:
 
     uint64_t count_time;
-    uint64_t count_orders_chunk;
-    uint64_t count_transactions_chunk;
     uint64_t count_positions_chunk;
     
     Kdbp _kdb;
+    Kdbp _sink_kdb;
+    KdbSinkTable<OrderRow>* _orders;
+    KdbSinkTable<OrderRow>* _transactions;
+    OrdersMessage _orders_message;
+    OrdersMessage _transactions_message;
+    PositionsMessage _positions_message;
     CheckTime ct = CheckTime();
     unordered_map<uint32_t, Symbol> symbols = {};
     unordered_map<uint64_t, string> users = {};
-    unordered_map<string, Position> usersStats = {};
+    // Positions by (symbol, account) with the dirty list of positions changed since the last positions flush
+    PositionBook positions;
 
-    vector<Order> orders_chunk;
-    vector<Order> transactions_chunk;
-    unordered_map<string, Position> positions_chunk;
-    vector<uint64_t> executedPrice;
-    vector<uint64_t> executedQuantity;
-
-    uint64_t last_index(const string &table)
-    {
-        //should be last index of rows
-        count_time = 0UL;
-        count_orders_chunk = 0UL;
-        count_transactions_chunk = 0UL;
-        count_positions_chunk = 0UL;
-        K count = _kdb.readQuery("count " + table);
-        if (count){
-            return count->j;
-        }else{
-            return 0;
-        }
-        
-        
-    }
+    vector<PositionRow> positions_rows;
+    // Next position Id (continues the persisted positions on restart)
+    uint64_t next_position_id;
 
     void flush_db()
     {
-        
-        for (auto& it: usersStats)
-        {
-            K vals = position_prep(it.second);
-            _kdb.insertMultRow("upsert", "positions", vals);
-        }
-        
-        if (orders_chunk.size())
-        {
-            vector<uint64_t> prc; 
-            vector<uint64_t> qty;
-            prc.resize(orders_chunk.size());
-            qty.resize(orders_chunk.size());
-            K vals = order_prep(orders_chunk, prc, qty);
-            _kdb.insertMultRow("insert", "orders", vals);
-            orders_chunk.clear();
-            count_orders_chunk = 0UL;
-        }
-        
-        if (transactions_chunk.size())
-        {
-            K vals = order_prep(transactions_chunk, executedPrice, executedQuantity);
-            _kdb.insertMultRow("insert", "transactions", vals);
-            transactions_chunk.clear();
-            executedQuantity.clear();
-            executedQuantity.clear();
-            count_transactions_chunk = 0UL;
-        }
+        flushPositions();
 
+        // Wait until the kdb+ sink ships all orders and transactions
+        _orders->Flush(true);
+        _transactions->Flush(true);
     }
 
-    MyMarketHandler(I kdb): _kdb(Kdbp(kdb)){}
+    // Orders and transactions are shipped by the kdb+ sink over its own connection
+    MyMarketHandler(I kdb, I sink_kdb, KdbSink &sink): count_time(0UL), count_positions_chunk(0UL),
+        _kdb(Kdbp(kdb)), _sink_kdb(Kdbp(sink_kdb)),
+        _orders_message("insert", "orders"), _transactions_message("insert", "transactions"),
+        _positions_message("upsert", "positions"), next_position_id(1UL)
+    {
+        _orders = &sink.AddTable<OrderRow>("orders",
+            [this](const vector<OrderRow> &rows) { return _orders_message.Send(_sink_kdb.handle(), rows); });
+        _transactions = &sink.AddTable<OrderRow>("transactions",
+            [this](const vector<OrderRow> &rows) { return _transactions_message.Send(_sink_kdb.handle(), rows); });
+    }
     MyMarketHandler() noexcept = delete;
 
     //First needs to be defined symbols
@@ -151,41 +219,43 @@ public:
     {
         users[accountId] = name;
         for (auto& it: symbols) {
-            Position pos = Position();
-            pos.Id = last_index("positions");
-            pos.AccountId = accountId;
-            pos.SymbolId = it.second.Id;
-
-            usersStats[to_string(it.second.Id) + "+" + to_string(accountId)] = pos;
-            updatePosition(pos);
+            // Positions loaded on startup are kept
+            if (positions.GetPosition(it.second.Id, accountId) != nullptr)
+                continue;
+            Position &pos = positions.AddPosition(it.second.Id, accountId);
+            pos.Id = next_position_id++;
+            positions.MarkDirty(it.second.Id, accountId);
         }
+        flushPositions();
     }
 
-    void createTables()
+    // Tables persisted by the previous run are kept to be restored
+    void createTable(const string &name, const string &columns)
     {
+        _kdb.executeQuery("if[not `" + name + " in tables[]; " + name + ":(" + columns + ")]");
+    }
 
-        string _query = "meta symbols:([Id:`short$()] Time:`long$(); Name:`symbol$(); Type:`short$(); Multiplier:`long$(); QuantityDivisor:`long$())";
+    void createTables()
+    {
 
-        _kdb.executeQuery(_query);
+        string _columns = "[Id:`short$()] Time:`long$(); Name:`symbol$(); Type:`short$(); Multiplier:`long$(); QuantityDivisor:`long$()";
 
-        _query = "meta prices:([] Time:`long$(); SymbolId:`short$(); MarkPrice:`long$(); IndexPrice:`long$(); BestBid:`long$(); BestAsk:`long$(); RiskZ:`float$(); RiskC:`float$())";
+        createTable("symbols", _columns);
 
-        _kdb.executeQuery(_query);
+        _columns = "[] Time:`long$(); SymbolId:`short$(); MarkPrice:`long$(); IndexPrice:`long$(); BestBid:`long$(); BestAsk:`long$(); RiskZ:`float$(); RiskC:`float$()";
 
-        _query = "meta orders:([] Id:`long$(); SymbolId:`short$(); ExecutedQuantity:`long$(); LeavesQuantity:`long$(); MaxVisibleQuantity:`long$(); ";
-        _query += "Price:`long$(); Quantity:`long$(); Side:`short$(); Slippage:`long$(); StopPrice:`long$(); TimeInForce:`short$(); TrailingDistance:`long$(); ";
-        _query += "TrailingStep:`long$(); Type:`short$(); Time:`long$(); AccountId:`long$(); CurrentExecutedPrice:`long$(); CurrentExecutedQuantity:`long$(); Status:`short$())";
-        _kdb.executeQuery(_query);
+        createTable("prices", _columns);
 
-        _query = "meta transactions:([] Id:`long$(); SymbolId:`short$(); ExecutedQuantity:`long$(); LeavesQuantity:`long$(); MaxVisibleQuantity:`long$(); ";
-        _query += "Price:`long$(); Quantity:`long$(); Side:`short$(); Slippage:`long$(); StopPrice:`long$(); TimeInForce:`short$(); TrailingDistance:`long$(); ";
-        _query += "TrailingStep:`long$(); Type:`short$(); Time:`long$(); AccountId:`long$(); CurrentExecutedPrice:`long$(); CurrentExecutedQuantity:`long$(); Status:`short$())";
-        _kdb.executeQuery(_query);
+        _columns = "[] Id:`long$(); SymbolId:`short$(); ExecutedQuantity:`long$(); LeavesQuantity:`long$(); MaxVisibleQuantity:`long$(); ";
+        _columns += "Price:`long$(); Quantity:`long$(); Side:`short$(); Slippage:`long$(); StopPrice:`long$(); TimeInForce:`short$(); TrailingDistance:`long$(); ";
+        _columns += "TrailingStep:`long$(); Type:`short$(); Time:`long$(); AccountId:`long$(); CurrentExecutedPrice:`long$(); CurrentExecutedQuantity:`long$(); Status:`short$()";
+        createTable("orders", _columns);
+        createTable("transactions", _columns);
 
-        _query = "meta positions:([Id:`long$()] SymbolId:`short$(); AvgEntryPrice:`float$(); Quantity:`long$(); Side:`short$(); ";
-        _query += "Time:`long$(); AccountId:`long$(); RiskZ:`float$(); RiskC:`float$(); Funding:`float$(); MarkPrice:`long$(); IndexPrice:`long$(); ";
-        _query += "RealizedPnL:`float$(); UnrealizedPnL:`float$(); FundingTime:`long$())";
-        _kdb.executeQuery(_query);
+        _columns = "[Id:`long$()] SymbolId:`short$(); AvgEntryPrice:`float$(); Quantity:`long$(); Side:`short$(); ";
+        _columns += "Time:`long$(); AccountId:`long$(); RiskZ:`float$(); RiskC:`float$(); Funding:`float$(); MarkPrice:`long$(); IndexPrice:`long$(); ";
+        _columns += "RealizedPnL:`float$(); UnrealizedPnL:`float$(); FundingTime:`long$()";
+        createTable("positions", _columns);
 
     }
 
@@ -308,29 +378,25 @@ protected:
 
             _kdb.insertRow(_query, _table, row);
 
-            for (auto& it: users) {
-
-                uint32_t symbolId = order_book.symbol().Id;
-                uint64_t accountId = it.first;
-                Position pos = updatePositions_db(accountId, 
-                                   symbolId, 
-                                   _funding_coeficient[1], 
+            // Only accounts holding the symbol are refreshed
+            uint32_t symbolId = order_book.symbol().Id;
+            positions.ForEachHolder(symbolId, [&](Position &position, PositionBook::Key key) {
+                updatePositions_db(position,
+                                   _funding_coeficient[1],
                                    _funding_coeficient[0],
                                    _mark_price,
                                    _index_price);
-                
-                updatePosition(pos);
-        }
+                positions.MarkDirty(key);
+            });
+
+            // All refreshed positions of the symbol are upserted with a single message per tick
+            flushPositions();
             // ct.end();
         }
     }
 
-    Position updatePositions_db(uint64_t accountId, uint32_t symbolId, double riskC, double riskZ, uint64_t markPrice, uint64_t indexPrice)
+    void updatePositions_db(Position &last_pos, double riskC, double riskZ, uint64_t markPrice, uint64_t indexPrice)
     {
-        Position last_pos;
-
-        string _user_symbol = to_string(symbolId) + "+" + to_string(accountId);
-        last_pos = usersStats[_user_symbol];
         last_pos.RiskC = riskC;
         last_pos.RiskZ = riskZ;
         last_pos.MarkPrice = markPrice;
@@ -340,14 +406,12 @@ protected:
         if (last_pos.FundingTime)
         {
             uint64_t _timespan = _time - last_pos.FundingTime;
-            last_pos.Funding = last_pos.CalculateFunding(last_pos, _timespan, symbols[symbolId]);
+            last_pos.Funding = last_pos.CalculateFunding(last_pos, _timespan, symbols[last_pos.SymbolId]);
             //after 8h one should Funding /= 1000 * 3600 * 8 and put to realizedPnLFromFunding
         }else{
             last_pos.Funding = 0.0;
         }
         last_pos.FundingTime = _time;
-        usersStats[_user_symbol] = last_pos;
-        return last_pos;
     }
 
     void onUpdateOrderBook(const OrderBook &order_book, bool top) override
@@ -379,207 +443,15 @@ protected:
             mark_price_db(order_book);
     }
 
-    K order_prep(const Order &order, uint64_t currentExecutedPrice, uint64_t currentExecutedQuantity)
+    static uint64_t now_ms()
     {
         auto _now = std::chrono::system_clock::now().time_since_epoch();
-        uint64_t _time = std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
-
-        K val = knk(19,
-                    kj(order.Id),
-                    kh(order.SymbolId),
-                    kj(order.ExecutedQuantity),
-                    kj(order.LeavesQuantity),
-                    kj(order.MaxVisibleQuantity),
-                    kj(order.Price),
-                    kj(order.Quantity),
-                    kh((uint8_t)order.Side),
-                    kj(order.Slippage),
-                    kj(order.StopPrice),
-                    kh((uint8_t)order.TimeInForce),
-                    kj(order.TrailingDistance),
-                    kj(order.TrailingStep),
-                    kh((uint8_t)order.Type),
-                    kj(_time),
-                    kj(order.AccountId),
-                    kj(currentExecutedPrice),
-                    kj(currentExecutedQuantity),
-                    kh((uint8_t)order.Status)
-                    );
-        return val;
-    }
-
-    K order_prep(const vector<Order> &orders, vector<uint64_t> currentExecutedPrice, vector<uint64_t> currentExecutedQuantity)
-    {
-        if (orders.size() == 1)
-        {
-            return order_prep(orders[0], currentExecutedPrice[0], currentExecutedQuantity[0]);
-        }
-        auto _now = std::chrono::system_clock::now().time_since_epoch();
-        uint64_t _time = std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
-        vector<K> lists({ktn(KJ, orders.size()),
-                      ktn(KH, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KH, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KH, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KH, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KJ, orders.size()),
-                      ktn(KH, orders.size())});
-        for (uint64_t i=0;i<orders.size();i++)
-        {
-            kJ(lists[0])[i] = orders[i].Id;
-            kH(lists[1])[i] = orders[i].SymbolId;
-            kJ(lists[2])[i] = orders[i].ExecutedQuantity;
-            kJ(lists[3])[i] = orders[i].LeavesQuantity;
-            kJ(lists[4])[i] = orders[i].MaxVisibleQuantity;
-            kJ(lists[5])[i] = orders[i].Price;
-            kJ(lists[6])[i] = orders[i].Quantity;
-            kH(lists[7])[i] = (uint8_t)orders[i].Side;
-            kJ(lists[8])[i] = orders[i].Slippage;
-            kJ(lists[9])[i] = orders[i].StopPrice;
-            kH(lists[10])[i] = (uint8_t)orders[i].TimeInForce;
-            kJ(lists[11])[i] = orders[i].TrailingDistance;
-            kJ(lists[12])[i] = orders[i].TrailingStep;
-            kH(lists[13])[i] = (uint8_t)orders[i].Type;
-            kJ(lists[14])[i] = _time;
-            kJ(lists[15])[i] = orders[i].AccountId;
-            kJ(lists[16])[i] = currentExecutedPrice[i];
-            kJ(lists[17])[i] = currentExecutedQuantity[i];
-            kH(lists[18])[i] = (uint8_t)orders[i].Status;
-        }
-        K vals = knk(19,
-                    lists[0],
-                    lists[1],
-                    lists[2],
-                    lists[3],
-                    lists[4],
-                    lists[5],
-                    lists[6],
-                    lists[7],
-                    lists[8],
-                    lists[9],
-                    lists[10],
-                    lists[11],
-                    lists[12],
-                    lists[13],
-                    lists[14],
-                    lists[15],
-                    lists[16],
-                    lists[17],
-                    lists[18]
-                    );
-        return vals;
-    }
-
-    K position_prep(const Position &position)
-    {
-        auto _now = std::chrono::system_clock::now().time_since_epoch();
-        uint64_t _time = std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
-        K val = knk(15,
-                    kj(position.Id),
-                    kh(position.SymbolId),
-                    kf(position.AvgEntryPrice),
-                    kj(position.Quantity),
-                    kh((uint8_t)position.Side),
-                    kj(_time),
-                    kj(position.AccountId),
-                    kf(position.RiskZ),
-                    kf(position.RiskC),
-                    kf(position.Funding),
-                    kj(position.MarkPrice),
-                    kj(position.IndexPrice),
-                    kf(position.RealizedPnL),
-                    kf(position.UnrealizedPnL),
-                    kj(position.FundingTime));
-        return val;
-    }
-
-    K position_prep(const vector<Position> &positions)
-    {
-        if (positions.size() == 1)
-        {
-            return position_prep(positions[0]);
-        }
-        auto _now = std::chrono::system_clock::now().time_since_epoch();
-        uint64_t _time = std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
-        vector<K> lists({ktn(KJ, positions.size()),
-                      ktn(KH, positions.size()),
-                      ktn(KJ, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KH, positions.size()),
-                      ktn(KJ, positions.size()),
-                      ktn(KJ, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KJ, positions.size()),
-                      ktn(KJ, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KF, positions.size()),
-                      ktn(KJ, positions.size())});
-
-        for (uint64_t i=0;i<positions.size();i++)
-        {
-            kJ(lists[0])[i] = positions[i].Id;
-            kH(lists[1])[i] = positions[i].SymbolId;
-            kF(lists[2])[i] = positions[i].AvgEntryPrice;
-            kJ(lists[3])[i] = positions[i].Quantity;
-            kH(lists[4])[i] = (uint8_t)positions[i].Side;
-            kJ(lists[5])[i] = _time,
-            kJ(lists[6])[i] = positions[i].AccountId;
-            kF(lists[7])[i] = positions[i].RiskZ;
-            kF(lists[8])[i] = positions[i].RiskC;
-            kF(lists[9])[i] = positions[i].Funding;
-            kJ(lists[10])[i] = positions[i].MarkPrice;
-            kJ(lists[11])[i] = positions[i].IndexPrice;
-            kF(lists[12])[i] = positions[i].RealizedPnL;
-            kF(lists[13])[i] = positions[i].UnrealizedPnL;
-            kJ(lists[14])[i] = positions[i].FundingTime;
-        }
-        K vals = knk(15,
-                    lists[0],
-                    lists[1],
-                    lists[2],
-                    lists[3],
-                    lists[4],
-                    lists[5],
-                    lists[6],
-                    lists[7],
-                    lists[8],
-                    lists[9],
-                    lists[10],
-                    lists[11],
-                    lists[12],
-                    lists[13],
-                    lists[14]);
-        return vals;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
     }
 
     void appendOrdersChunk(const Order &order)
     {
-        orders_chunk.push_back(order);
-        if (++count_orders_chunk < CHUNK_SIZE)
-        {
-            return;
-        }
-        count_orders_chunk = 0UL;
-        vector<uint64_t> prc; 
-        vector<uint64_t> qty;
-        prc.resize(orders_chunk.size());
-        qty.resize(orders_chunk.size());
-        K vals = order_prep(orders_chunk, prc, qty);
-        _kdb.insertMultRow("insert", "orders", vals);
-        orders_chunk.clear();
+        _orders->Push(OrderRow{order, now_ms(), 0, 0});
     }
 
     void onAddOrder(const Order &order) override
@@ -614,48 +486,33 @@ protected:
 
     void appendTransactionsChunk(const Order &order, uint64_t price, uint64_t quantity)
     {
-        transactions_chunk.push_back(order);
-        executedPrice.push_back(price);
-        executedQuantity.push_back(quantity);
-
-        if (++count_transactions_chunk < CHUNK_SIZE)
-        {
-            return;
-        }
-        count_transactions_chunk = 0UL;
-
-        K vals = order_prep(transactions_chunk, executedPrice, executedQuantity);
-        _kdb.insertMultRow("insert", "transactions", vals);
-        transactions_chunk.clear();
-        executedQuantity.clear();
-        executedQuantity.clear();
+        _transactions->Push(OrderRow{order, now_ms(), price, quantity});
     }
 
-    void updatePosition(const Position &position)
+    // Upsert all dirty positions with a single columnar message
+    void flushPositions()
     {
-        K val = position_prep(position);
-        _kdb.insertMultRow("upsert", "positions", val);
+        if (!positions.dirty())
+            return;
 
+        uint64_t _time = now_ms();
+        positions_rows.clear();
+        positions.FlushDirty([this, _time](const Position &position) { positions_rows.push_back(PositionRow{position, _time}); });
+        count_positions_chunk = 0UL;
+
+        _positions_message.Send(_kdb.handle(), positions_rows);
     }
 
-    void appendUserStatsChunk(const string &userString)
+    void appendUserStatsChunk(uint32_t symbolId, uint64_t accountId)
     {
-        K val;
-        positions_chunk[userString] = usersStats[userString];
+        positions.MarkDirty(symbolId, accountId);
 
         if (++count_positions_chunk < CHUNK_SIZE_POSITIONS)
         {
             return;
         }
-        count_positions_chunk = 0UL;
-
-        for (auto& it: positions_chunk)
-        {
-            val = position_prep(it.second);
-            _kdb.insertMultRow("upsert", "positions", val);
-        }
 
-        positions_chunk.clear();
+        flushPositions();
     }
 
     void onExecuteOrder(const Order &order, uint64_t price, uint64_t quantity) override
@@ -676,14 +533,24 @@ protected:
         // _kdb.printq(data);
         // last_pos = last_pos.ReadDbStructure(data, _kdb);
 
-        Position last_pos, curr_pos;
+        Position &last_pos = positions.AddPosition(order.SymbolId, order.AccountId);
+        bool flat = (last_pos.Quantity == 0);
+        last_pos = last_pos.OrderExecuted(last_pos, order, price, quantity, symbols[order.SymbolId]);
 
-        string _user_symbol = to_string(order.SymbolId) + "+" + to_string(order.AccountId);
-        last_pos = usersStats[_user_symbol];
-        curr_pos = last_pos.OrderExecuted(last_pos, order, price, quantity, symbols[order.SymbolId]);
-        usersStats[_user_symbol] = curr_pos;
+        // Flat positions are not refreshed by mark price ticks, so funding is accrued only from the reopening
+        if (last_pos.Quantity == 0)
+        {
+            last_pos.Funding = 0.0;
+            last_pos.FundingTime = 0;
+        }
+        else if (flat)
+        {
+            auto _now = std::chrono::system_clock::now().time_since_epoch();
+            last_pos.Funding = 0.0;
+            last_pos.FundingTime = std::chrono::duration_cast<std::chrono::milliseconds>(_now).count();
+        }
 
-        appendUserStatsChunk(_user_symbol);
+        appendUserStatsChunk(order.SymbolId, order.AccountId);
     }
     
 };
@@ -694,14 +561,8 @@ void printStatsNumber(MyMarketHandler& market_handler, const string& query)
     cout << "Number of historical `"<< query << "`: " << (unsigned long)count_orders->j << endl;
 }
 
-void addSymbol(uint32_t idSymbol, const string &name, uint64_t multiplier, uint64_t divisor, const SymbolType &type, MyMarketHandler &market_handler, MarketManager &market)
+void addSymbol(const Symbol &symbol, MarketManager &market)
 {
-    char *_name = new char[8];
-
-    sprintf(_name, "%s", name.c_str());
-
-    Symbol symbol(idSymbol, _name, type, multiplier, divisor);
-
     ErrorCode result = market.AddSymbol(symbol);
     if (result != ErrorCode::OK)
         std::cerr << "Failed 'add symbol' command: " << result << std::endl;
@@ -711,16 +572,40 @@ void addSymbol(uint32_t idSymbol, const string &name, uint64_t multiplier, uint6
         std::cerr << "Failed 'add book' command: " << result << std::endl;
 }
 
+void addSymbol(uint32_t idSymbol, const string &name, uint64_t multiplier, uint64_t divisor, const SymbolType &type, MyMarketHandler &market_handler, MarketManager &market)
+{
+    char *_name = new char[8];
+
+    sprintf(_name, "%s", name.c_str());
+
+    addSymbol(Symbol(idSymbol, _name, type, multiplier, divisor), market);
+}
+
+// Add symbols defined in Redis after the start (removed ones keep their order books until the restart)
+void updateSymbols(SymbolRegistry &registry, MarketManager &market)
+{
+    registry.Update([&market](uint32_t symbolId, const Symbol *symbol) {
+        if (symbol == nullptr)
+            std::cout << "Symbol removed from Redis: " << symbolId << std::endl;
+        else if (market.GetSymbol(symbolId) == nullptr)
+            addSymbol(*symbol, market);
+    });
+}
+
 int main(int argc, char **argv)
 {
     I kdb = khpu(S("127.0.0.1"), I(5000), S(":"));
     if(!handleOk(kdb))
         return 1;
-    MyMarketHandler market_handler = MyMarketHandler(kdb);
+    I sink_kdb = khpu(S("127.0.0.1"), I(5000), S(":"));
+    if(!handleOk(sink_kdb))
+        return 1;
+    KdbSinkSettings sink_settings;
+    sink_settings.BatchSize = CHUNK_SIZE;
+    KdbSink sink(sink_settings);
+    MyMarketHandler market_handler(kdb, sink_kdb, sink);
     MarketManager market(market_handler);
-    int id = 1; //market_handler.last_index("orders");
     uint64_t account_id;
-    cout << "id: " << id << endl;
     int price;
     int quantity;
     int symbol;
@@ -729,7 +614,31 @@ int main(int argc, char **argv)
     Order order;
     ErrorCode result;
     market_handler.createTables();
-    addSymbol(0, "BTCUSD", 1000, 10, SymbolType::VANILLAPERP, market_handler, market);
+    sink.Start();
+
+    // Restore symbols, positions and resting orders persisted by the previous run
+    auto restore_start = std::chrono::steady_clock::now();
+    KdbLoader loader(kdb);
+    int64_t restored_symbols = loader.LoadSymbols(market);
+    int64_t restored_positions = loader.LoadPositions(market_handler.positions);
+    int64_t restored_orders = loader.LoadOrders(market);
+    int64_t id = std::max(loader.NextId("orders"), (int64_t)1);
+    market_handler.next_position_id = (uint64_t)std::max(loader.NextId("positions"), (int64_t)1);
+    cout << "Restored symbols: " << restored_symbols << "; positions: " << restored_positions << "; orders: " << restored_orders
+         << " in " << since<std::chrono::milliseconds>(restore_start).count() << "[ms]" << endl;
+    cout << "id: " << id << endl;
+
+    // Symbols defined in Redis are loaded once and then followed by keyspace notifications
+    SymbolRegistry registry;
+    cout << "Redis symbols: " << registry.Load() << endl;
+    registry.ForEachSymbol([&market](const Symbol &symbol) {
+        if (market.GetSymbol(symbol.Id) == nullptr)
+            addSymbol(symbol, market);
+    });
+    registry.Start();
+
+    if (market.GetSymbol(0) == nullptr)
+        addSymbol(0, "BTCUSD", 1000, 10, SymbolType::VANILLAPERP, market_handler, market);
     // addSymbol(1, "ETHUSD", 50, 100, SymbolType::INVERSEPERP, market_handler, market);
     // addSymbol(2, "RBWUSD", 100, 1, SymbolType::INVERSEFUT, market_handler, market);
     market.EnableMatching();
@@ -742,6 +651,9 @@ int main(int argc, char **argv)
 
     for (int i = 0; i < txn_no; i++)
     {
+        // Symbol changes are applied on the matching thread
+        if ((i % CLOCK_INTERVAL) == 0)
+            updateSymbols(registry, market);
 
         price = 9000 + (int)(rand() * 1000.0 / RAND_MAX);
         quantity = (int)(rand() * 1000.0 / RAND_MAX) + 1;
@@ -784,6 +696,8 @@ int main(int argc, char **argv)
     }
     market_handler.flush_db();
     auto end = std::chrono::system_clock::now();
+    registry.Stop();
+    sink.Stop();
 
     int64_t time_diff = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
     cout << "No of orders send: " << txn_no * 4 << endl;
@@ -801,6 +715,9 @@ int main(int argc, char **argv)
     printStatsNumber(market_handler, "count orders");
     printStatsNumber(market_handler, "count transactions");
     printStatsNumber(market_handler, "count positions");
+    for (size_t i = 0; i < sink.tables(); i++)
+        cout << "kdb+ sink `" << sink.table(i).name() << "`: " << sink.table(i).stats() << endl;
+    kclose(sink_kdb);
     kclose(kdb);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,253 @@
+/*!
+    \file order_flow.h
+    \brief Synthetic order flow generator definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_GENERATOR_ORDER_FLOW_H
+#define CPPTRADER_GENERATOR_ORDER_FLOW_H
+
+#include "trader/matching/market_manager.h"
+
+#include <vector>
+
+namespace CppTrader {
+
+/*!
+    \namespace CppTrader::Generator
+    \brief Synthetic market data generators definitions
+*/
+namespace Generator {
+
+//! Order prices distribution around the mid price
+enum class PriceDistribution : uint8_t
+{
+    UNIFORM,
+    NORMAL,
+    EXPONENTIAL
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, PriceDistribution distribution);
+
+//! Order types mix
+/*!
+    Order type weights are relative (they are normalized by their sum).
+    Time in force and iceberg shares are probabilities applied to the
+    order types which support them.
+
+    Trailing stop and 'All-Or-None' orders are disabled by default, because
+    the matching engine does not handle them reliably yet (see 'Automatic
+    matching' tests) and random flows with them hang in release builds.
+*/
+struct OrderMix
+{
+    //! Limit orders weight
+    double Limit = 0.75;
+    //! Market orders weight
+    double Market = 0.10;
+    //! Stop orders weight
+    double Stop = 0.03;
+    //! Stop-limit orders weight
+    double StopLimit = 0.03;
+    //! Trailing stop orders weight
+    double TrailingStop = 0.0;
+    //! Trailing stop-limit orders weight
+    double TrailingStopLimit = 0.0;
+
+    //! Share of 'Iceberg' limit orders (good-till-cancelled only)
+    double Iceberg = 0.05;
+    //! Share of 'Immediate-Or-Cancel' limit orders
+    double IOC = 0.05;
+    //! Share of 'Fill-Or-Kill' limit and market orders
+    double FOK = 0.02;
+    //! Share of 'All-Or-None' limit orders
+    double AON = 0.0;
+};
+
+//! Order flow settings
+struct OrderFlowSettings
+{
+    //! Random generator seed (the same seed produces the same order flow)
+    uint64_t Seed = 1;
+
+    //! Count of symbols (symbol Ids are in range [0, Symbols))
+    uint32_t Symbols = 1;
+    //! Zipf exponent of new orders activity across symbols (0 - uniform, 1 - classic Zipf law, symbol 0 is the most active)
+    double SymbolSkew = 0.0;
+    //! Count of accounts (account Ids are in range [1, Accounts])
+    uint64_t Accounts = 1;
+
+    //! Initial mid price of all symbols
+    uint64_t MidPrice = 10000;
+    //! Price tick size
+    uint64_t TickSize = 1;
+    //! Mid price random walk volatility (ticks per command, 0 - constant mid)
+    double Volatility = 0.0;
+
+    //! Prices distribution around the mid price
+    PriceDistribution Distribution = PriceDistribution::NORMAL;
+    //! Prices distribution scale in ticks (half-width, standard deviation or mean)
+    double PriceScale = 50.0;
+    //! Share of aggressive (crossing the mid price) limit orders
+    double Aggressive = 0.10;
+
+    //! Minimal order quantity
+    uint64_t MinQuantity = 1;
+    //! Maximal order quantity
+    uint64_t MaxQuantity = 1000;
+
+    //! Order types mix
+    OrderMix Mix;
+
+    //! Share of cancel commands
+    double CancelRatio = 0.30;
+    //! Share of modify commands
+    double ModifyRatio = 0.10;
+};
+
+//! Order flow command type
+enum class OrderFlowCommandType : uint8_t
+{
+    ADD,
+    MODIFY,
+    CANCEL
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, OrderFlowCommandType type);
+
+//! Order flow command
+struct OrderFlowCommand
+{
+    //! Command type
+    OrderFlowCommandType Type;
+    //! Order to add (ADD) or order Id, new price and new quantity (MODIFY, CANCEL)
+    Matching::Order Order;
+
+    //! Apply the command to the given market manager
+    /*!
+        Modify and cancel commands check the order existence before calling
+        the market manager, so missing orders do not trigger its asserts.
+
+        \param market - Market manager
+        \return Error code
+    */
+    Matching::ErrorCode Apply(Matching::MarketManager& market) const;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const OrderFlowCommand& command);
+};
+
+//! Synthetic order flow generator
+/*!
+    Order flow generator produces a reproducible stream of add, modify and
+    cancel commands with the configured order types mix, prices around the
+    mid price of each symbol, symbols and accounts.
+
+    Generator does not observe the market, so it keeps lists of all orders
+    which could still rest in order books and picks modify (limit orders
+    only) and cancel targets from them. Commands for orders which were
+    already filled return ErrorCode::ORDER_NOT_FOUND from Apply() in the
+    same way as cancels racing with executions in real markets. The stream
+    depends only on settings, so it could be pre-generated and replayed
+    against different engine builds.
+
+    Random numbers are produced with SplitMix64 and own distributions (not
+    the implementation-defined std ones), so the same seed gives the same
+    order flow with any standard library.
+
+    Not thread-safe.
+*/
+class OrderFlowGenerator
+{
+public:
+    //! Initialize order flow generator with given settings
+    /*!
+        \param settings - Order flow settings
+    */
+    explicit OrderFlowGenerator(const OrderFlowSettings& settings);
+    OrderFlowGenerator(const OrderFlowGenerator&) = delete;
+    OrderFlowGenerator(OrderFlowGenerator&&) = delete;
+    ~OrderFlowGenerator() = default;
+
+    OrderFlowGenerator& operator=(const OrderFlowGenerator&) = delete;
+    OrderFlowGenerator& operator=(OrderFlowGenerator&&) = delete;
+
+    //! Get the order flow settings
+    const OrderFlowSettings& settings() const noexcept { return _settings; }
+    //! Get the count of generated commands
+    uint64_t commands() const noexcept { return _commands; }
+    //! Get the count of orders which could still rest in order books
+    size_t live() const noexcept { return _live_limits.size() + _live_stops.size(); }
+    //! Get the current mid price of the given symbol
+    uint64_t mid(uint32_t symbol) const noexcept { return _mids[symbol]; }
+
+    //! Add all symbols and order books of the order flow into the given market manager
+    /*!
+        \param market - Market manager
+        \return Error code
+    */
+    Matching::ErrorCode Initialize(Matching::MarketManager& market) const;
+
+    //! Generate the next command
+    /*!
+        \return The next order flow command
+    */
+    OrderFlowCommand Next();
+
+    //! Generate the given count of commands
+    /*!
+        \param count - Count of commands to generate
+        \param commands - Commands container to append
+    */
+    void Generate(size_t count, std::vector<OrderFlowCommand>& commands);
+
+    //! Reset the generator to the initial state of its seed
+    void Reset();
+
+private:
+    struct LiveOrder
+    {
+        uint64_t Id;
+        uint32_t Symbol;
+        Matching::OrderSide Side;
+    };
+
+    OrderFlowSettings _settings;
+    double _weights[6];
+    uint64_t _state;
+    uint64_t _commands;
+    uint64_t _id;
+    std::vector<uint64_t> _mids;
+    std::vector<double> _symbols;
+    std::vector<LiveOrder> _live_limits;
+    std::vector<LiveOrder> _live_stops;
+
+    uint64_t Random() noexcept;
+    double Uniform() noexcept;
+    double Normal() noexcept;
+    uint64_t Range(uint64_t min, uint64_t max) noexcept;
+    bool Chance(double probability) noexcept;
+
+    uint32_t NextSymbol() noexcept;
+    uint64_t Offset() noexcept;
+    uint64_t PassivePrice(uint32_t symbol, Matching::OrderSide side, uint64_t offset) const noexcept;
+    uint64_t AggressivePrice(uint32_t symbol, Matching::OrderSide side, uint64_t offset) const noexcept;
+    uint64_t LimitPrice(uint64_t stop_price, Matching::OrderSide side, uint64_t ticks) const noexcept;
+    uint64_t Quantity() noexcept;
+
+    OrderFlowCommand NextAdd();
+    OrderFlowCommand NextModify();
+    OrderFlowCommand NextCancel();
+    void UpdateMid(uint32_t symbol) noexcept;
+};
+
+} // namespace Generator
+} // namespace CppTrader
+
+#include "order_flow.inl"
+
+#endif // CPPTRADER_GENERATOR_ORDER_FLOW_H
@@ -0,0 +1,108 @@
+/*!
+    \file order_flow.inl
+    \brief Synthetic order flow generator inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Generator {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, PriceDistribution distribution)
+{
+    switch (distribution)
+    {
+        case PriceDistribution::UNIFORM:
+            stream << "UNIFORM";
+            break;
+        case PriceDistribution::NORMAL:
+            stream << "NORMAL";
+            break;
+        case PriceDistribution::EXPONENTIAL:
+            stream << "EXPONENTIAL";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, OrderFlowCommandType type)
+{
+    switch (type)
+    {
+        case OrderFlowCommandType::ADD:
+            stream << "ADD";
+            break;
+        case OrderFlowCommandType::MODIFY:
+            stream << "MODIFY";
+            break;
+        case OrderFlowCommandType::CANCEL:
+            stream << "CANCEL";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const OrderFlowCommand& command)
+{
+    stream << "OrderFlowCommand(Type=" << command.Type
+        << "; Order=" << command.Order
+        << ")";
+    return stream;
+}
+
+inline Matching::ErrorCode OrderFlowCommand::Apply(Matching::MarketManager& market) const
+{
+    switch (Type)
+    {
+        case OrderFlowCommandType::ADD:
+            return market.AddOrder(Order);
+        case OrderFlowCommandType::MODIFY:
+            if (market.GetOrder(Order.Id) == nullptr)
+                return Matching::ErrorCode::ORDER_NOT_FOUND;
+            return market.ModifyOrder(Order.Id, Order.Price, Order.Quantity);
+        case OrderFlowCommandType::CANCEL:
+            if (market.GetOrder(Order.Id) == nullptr)
+                return Matching::ErrorCode::ORDER_NOT_FOUND;
+            return market.DeleteOrder(Order.Id);
+        default:
+            return Matching::ErrorCode::ORDER_TYPE_INVALID;
+    }
+}
+
+inline uint64_t OrderFlowGenerator::Random() noexcept
+{
+    // SplitMix64
+    uint64_t z = (_state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+inline double OrderFlowGenerator::Uniform() noexcept
+{
+    // 53 random bits in range [0, 1)
+    return (double)(Random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+inline uint64_t OrderFlowGenerator::Range(uint64_t min, uint64_t max) noexcept
+{
+    return (max > min) ? (min + Random() % (max - min + 1)) : min;
+}
+
+inline bool OrderFlowGenerator::Chance(double probability) noexcept
+{
+    return Uniform() < probability;
+}
+
+} // namespace Generator
+} // namespace CppTrader
@@ -0,0 +1,213 @@
+/*!
+    \file kdb_ipc.h
+    \brief kdb+ IPC message serializer definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_KDB_IPC_H
+#define CPPTRADER_KDB_IPC_H
+
+#include "trader/kdbp_db.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace CppTrader {
+
+//! kdb+ IPC message base
+/*!
+    Type independent part of the kdb+ IPC message: the reusable contiguous
+    message buffer, wire format writers and the socket transport.
+*/
+class KdbIpcMessageBase
+{
+public:
+    //! kdb+ IPC message header size
+    static const size_t HEADER_SIZE = 8;
+    //! Maximal accepted kdb+ response message size
+    static const size_t MAX_RESPONSE_SIZE = 1024 * 1024 * 1024;
+    //! Size of the kept response prefix (and of the chunk the rest is read with)
+    static const size_t RESPONSE_CHUNK_SIZE = 4096;
+
+    KdbIpcMessageBase(const std::string& query, const std::string& table, size_t capacity);
+    KdbIpcMessageBase(const KdbIpcMessageBase&) = delete;
+    KdbIpcMessageBase(KdbIpcMessageBase&&) = delete;
+    ~KdbIpcMessageBase() = default;
+
+    KdbIpcMessageBase& operator=(const KdbIpcMessageBase&) = delete;
+    KdbIpcMessageBase& operator=(KdbIpcMessageBase&&) = delete;
+
+    //! Get the query (e.g. "insert" or "upsert")
+    const std::string& query() const noexcept { return _query; }
+    //! Get the kdb+ table name
+    const std::string& table() const noexcept { return _table; }
+
+    //! Get the serialized message data
+    const uint8_t* data() const noexcept { return _buffer.get(); }
+    //! Get the serialized message size in bytes
+    size_t size() const noexcept { return _size; }
+    //! Get the message buffer capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Send the serialized message with a single write
+    /*!
+        Message serialized as synchronous waits for the kdb+ response and reads it.
+        Compressed or oversized responses are rejected and leave the connection
+        out of sync, so it should be closed.
+
+        \param handle - kdb+ connection handle (e.g. from khpu())
+        \return 'true' if the message was successfully sent (and the response is not an error), 'false' otherwise
+    */
+    bool Send(I handle);
+
+protected:
+    std::string _query;
+    std::string _table;
+    std::unique_ptr<uint8_t[]> _buffer;
+    size_t _size;
+    size_t _capacity;
+    uint8_t* _ptr;
+
+    //! Prepare the buffer for the message of the given size and write the message prefix
+    /*!
+        Writes the header, the query char vector, the table symbol atom and the
+        columns general list header.
+
+        \param size - Message size in bytes
+        \param columns - Count of columns
+        \param sync - Synchronous message flag
+    */
+    void Begin(size_t size, size_t columns, bool sync);
+    //! Get the size of the message prefix
+    size_t Prefix() const noexcept { return HEADER_SIZE + 6 + (6 + _query.size()) + (1 + _table.size() + 1) + 6; }
+
+    //! Write the vector header
+    void Vector(int type, size_t count) noexcept
+    {
+        *_ptr++ = (uint8_t)type;
+        *_ptr++ = 0;
+        Write((int32_t)count);
+    }
+    //! Write the plain value
+    template <typename T>
+    void Write(T value) noexcept
+    {
+        std::memcpy(_ptr, &value, sizeof(T));
+        _ptr += sizeof(T);
+    }
+    //! Write the null terminated symbol
+    void Symbol(const char* symbol, size_t size) noexcept
+    {
+        std::memcpy(_ptr, symbol, size);
+        _ptr += size;
+        *_ptr++ = 0;
+    }
+
+    //! Get the symbol value view (fixed size char arrays may be not null terminated)
+    template <typename T>
+    static std::string_view SymbolView(const T& symbol) noexcept
+    {
+        if constexpr (std::is_array_v<T>)
+            return std::string_view(symbol, strnlen(symbol, std::extent_v<T>));
+        else if constexpr (std::is_pointer_v<T>)
+            return (symbol != nullptr) ? std::string_view(symbol) : std::string_view();
+        else
+            return std::string_view(symbol);
+    }
+};
+
+//! kdb+ IPC message
+/*!
+    IPC message serializes the query over the kdb+ table and the batch of rows
+    (e.g. (`insert; `orders; columns)) straight into the kdb+ IPC wire format.
+    Columns are described with the same compile-time field list as in
+    KdbColumnBatch, e.g.:
+    \code
+    typedef KdbIpcMessage<Position, KdbField<KJ, &Position::Id>, KdbField<KJ, &Position::Quantity>> PositionsMessage;
+    \endcode
+
+    Rows are read column by column from the given array and written into one
+    contiguous buffer which is reused across messages and grows geometrically,
+    so no K objects are created and the message is sent with a single write.
+    Symbol (KS) fields may be std::string, null terminated strings or fixed
+    size char arrays.
+
+    The result is the same message as k(-handle, query, ks(table), columns, 0)
+    sends uncompressed, so it can share the connection with the kdb+ C library
+    as long as both are used from the same thread.
+
+    Not thread-safe.
+*/
+template <typename TRow, typename... TFields>
+class KdbIpcMessage : public KdbIpcMessageBase
+{
+public:
+    //! Count of columns
+    static constexpr size_t COLUMNS = sizeof...(TFields);
+
+    //! Initialize the message for the given query and table
+    /*!
+        \param query - Query (e.g. "insert" or "upsert")
+        \param table - kdb+ table name
+        \param capacity - Initial buffer capacity in bytes (default is 65536)
+    */
+    KdbIpcMessage(const std::string& query, const std::string& table, size_t capacity = 65536)
+        : KdbIpcMessageBase(query, table, capacity)
+    {}
+    KdbIpcMessage(const KdbIpcMessage&) = delete;
+    KdbIpcMessage(KdbIpcMessage&&) = delete;
+    ~KdbIpcMessage() = default;
+
+    KdbIpcMessage& operator=(const KdbIpcMessage&) = delete;
+    KdbIpcMessage& operator=(KdbIpcMessage&&) = delete;
+
+    //! Serialize rows into the message buffer
+    /*!
+        \param rows - Rows to serialize
+        \param count - Count of rows
+        \param sync - Synchronous message flag (default is false)
+        \return Size of the serialized message in bytes
+    */
+    size_t Serialize(const TRow* rows, size_t count, bool sync = false);
+    //! Serialize rows into the message buffer
+    /*!
+        \param rows - Rows to serialize
+        \param sync - Synchronous message flag (default is false)
+        \return Size of the serialized message in bytes
+    */
+    size_t Serialize(const std::vector<TRow>& rows, bool sync = false)
+    { return Serialize(rows.data(), rows.size(), sync); }
+
+    using KdbIpcMessageBase::Send;
+    //! Serialize rows and send the message with a single write
+    /*!
+        \param handle - kdb+ connection handle
+        \param rows - Rows to send
+        \param sync - Send the message synchronously (default is false)
+        \return 'true' if the message was successfully sent, 'false' otherwise
+    */
+    bool Send(I handle, const std::vector<TRow>& rows, bool sync = false)
+    {
+        Serialize(rows, sync);
+        return Send(handle);
+    }
+
+private:
+    template <typename TField>
+    static size_t ColumnSize(const TRow* rows, size_t count);
+    template <typename TField>
+    void Column(const TRow* rows, size_t count);
+};
+
+} // namespace CppTrader
+
+#include "kdb_ipc.inl"
+
+#endif // CPPTRADER_KDB_IPC_H
@@ -0,0 +1,67 @@
+/*!
+    \file kdb_ipc.inl
+    \brief kdb+ IPC message serializer inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+
+template <typename TRow, typename... TFields>
+inline size_t KdbIpcMessage<TRow, TFields...>::Serialize(const TRow* rows, size_t count, bool sync)
+{
+    size_t size = Prefix();
+    ((size += ColumnSize<TFields>(rows, count)), ...);
+
+    Begin(size, COLUMNS, sync);
+    (Column<TFields>(rows, count), ...);
+
+    assert(((size_t)(_ptr - _buffer.get()) == _size) && "Invalid kdb+ IPC message size!");
+    return _size;
+}
+
+template <typename TRow, typename... TFields>
+template <typename TField>
+inline size_t KdbIpcMessage<TRow, TFields...>::ColumnSize(const TRow* rows, size_t count)
+{
+    if constexpr (TField::Type == KS)
+    {
+        // Symbols are null terminated
+        size_t size = 6 + count;
+        for (size_t i = 0; i < count; ++i)
+            size += SymbolView(TField::Raw(rows[i])).size();
+        return size;
+    }
+    else
+        return 6 + count * sizeof(typename TField::Value);
+}
+
+template <typename TRow, typename... TFields>
+template <typename TField>
+inline void KdbIpcMessage<TRow, TFields...>::Column(const TRow* rows, size_t count)
+{
+    Vector(TField::Type, count);
+    if constexpr (TField::Type == KS)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string_view symbol = SymbolView(TField::Raw(rows[i]));
+            Symbol(symbol.data(), symbol.size());
+        }
+    }
+    else
+    {
+        // Local write pointer keeps the buffer position in a register
+        uint8_t* ptr = _ptr;
+        for (size_t i = 0; i < count; ++i)
+        {
+            typename TField::Value value = (typename TField::Value)TField::Raw(rows[i]);
+            std::memcpy(ptr, &value, sizeof(value));
+            ptr += sizeof(value);
+        }
+        _ptr = ptr;
+    }
+}
+
+} // namespace CppTrader
@@ -0,0 +1,107 @@
+/*!
+    \file kdb_loader.h
+    \brief kdb+ startup state loader definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_KDB_LOADER_H
+#define CPPTRADER_KDB_LOADER_H
+
+#include "matching/market_manager.h"
+#include "risk/position_book.h"
+
+// kdb+ C API macros (e.g. R) clash with the names used in other headers
+#include "kdbp_db.h"
+
+#include <cstdint>
+#include <string>
+
+namespace CppTrader {
+
+//! kdb+ startup state loader
+/*!
+    Loader rebuilds the in-memory state on startup from kdb+ tables written
+    by the persistence paths: symbols (with their order books) and resting
+    orders into the market manager and positions into the position book.
+
+    Each table is pulled with a single synchronous query and read by walking
+    its column vectors (see KdbTable), so no K atom is created per field and
+    loading scales to millions of rows. Resting orders are restored in bulk
+    without matching and without order handler notifications (see
+    MarketManager::RestoreOrders()). Symbols should be loaded before orders.
+
+    Table overloads load the given (already queried) tables. Columns are
+    resolved by names of the example schema and should have the same types.
+
+    Not thread-safe.
+*/
+class KdbLoader
+{
+public:
+    //! Symbols query
+    static const char SYMBOLS_QUERY[];
+    //! Positions query
+    static const char POSITIONS_QUERY[];
+    //! Resting orders query (the last state of each order in the orders log which is still open)
+    static const char ORDERS_QUERY[];
+
+    //! Initialize the loader with the given kdb+ connection
+    /*!
+        \param handle - kdb+ connection handle
+    */
+    explicit KdbLoader(I handle) noexcept : _handle(handle) {}
+    KdbLoader(const KdbLoader&) = delete;
+    KdbLoader(KdbLoader&&) = delete;
+    ~KdbLoader() = default;
+
+    KdbLoader& operator=(const KdbLoader&) = delete;
+    KdbLoader& operator=(KdbLoader&&) = delete;
+
+    //! Load symbols and their order books into the market manager
+    /*!
+        \param market - Market manager
+        \return Count of loaded symbols or -1 on errors
+    */
+    int64_t LoadSymbols(Matching::MarketManager& market) { return Load(SYMBOLS_QUERY, [&market](K table) { return LoadSymbols(table, market); }); }
+    //! Load positions into the position book
+    /*!
+        \param positions - Position book
+        \return Count of loaded positions or -1 on errors
+    */
+    int64_t LoadPositions(Risk::PositionBook& positions) { return Load(POSITIONS_QUERY, [&positions](K table) { return LoadPositions(table, positions); }); }
+    //! Restore resting orders into the market manager
+    /*!
+        \param market - Market manager
+        \return Count of restored orders or -1 on errors
+    */
+    int64_t LoadOrders(Matching::MarketManager& market) { return Load(ORDERS_QUERY, [&market](K table) { return LoadOrders(table, market); }); }
+
+    //! Get the next Id of the given table
+    /*!
+        \param table - Table with the 'Id' column
+        \return Maximal Id plus one (1 for the empty table) or -1 on errors
+    */
+    int64_t NextId(const std::string& table);
+
+    //! Load symbols from the given table
+    static int64_t LoadSymbols(K table, Matching::MarketManager& market);
+    //! Load positions from the given table
+    static int64_t LoadPositions(K table, Risk::PositionBook& positions);
+    //! Restore resting orders from the given table
+    static int64_t LoadOrders(K table, Matching::MarketManager& market);
+
+private:
+    I _handle;
+
+    template <class TLoader>
+    int64_t Load(const char* query, TLoader&& loader);
+    K Query(const char* query);
+};
+
+} // namespace CppTrader
+
+#include "kdb_loader.inl"
+
+#endif // CPPTRADER_KDB_LOADER_H
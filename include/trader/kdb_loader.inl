@@ -0,0 +1,23 @@
+/*!
+    \file kdb_loader.inl
+    \brief kdb+ startup state loader inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+
+template <class TLoader>
+inline int64_t KdbLoader::Load(const char* query, TLoader&& loader)
+{
+    K table = Query(query);
+    if (table == nullptr)
+        return -1;
+
+    int64_t result = loader(table);
+    r0(table);
+    return result;
+}
+
+} // namespace CppTrader
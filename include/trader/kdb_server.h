@@ -0,0 +1,119 @@
+/*!
+    \file kdb_server.h
+    \brief Local kdb+ IPC stand-in server definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_KDB_SERVER_H
+#define CPPTRADER_KDB_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace CppTrader {
+
+//! kdb+ stand-in server statistics
+struct KdbServerStats
+{
+    //! Count of accepted connections
+    uint64_t Connections;
+    //! Count of received messages
+    uint64_t Messages;
+    //! Count of received synchronous messages
+    uint64_t SyncMessages;
+    //! Count of received bytes (including message headers)
+    uint64_t Bytes;
+    //! Count of inserted or upserted rows
+    uint64_t Rows;
+    //! Count of malformed or unsupported messages
+    uint64_t Errors;
+
+    KdbServerStats() noexcept : Connections(0), Messages(0), SyncMessages(0), Bytes(0), Rows(0), Errors(0) {}
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const KdbServerStats& stats);
+};
+
+//! Local kdb+ IPC stand-in server
+/*!
+    Stand-in server speaks enough of the kdb+ IPC protocol to exercise
+    persistence paths (Kdbp, kdb+ sink, IPC messages) without a licensed
+    q process:
+    - handshake with the capability byte of kdb+ 3.x;
+    - asynchronous and synchronous messages;
+    - (insert; `table; data) and (upsert; `table; data) calls where data is
+      a list of columns, a single row or a table. Rows are counted per table
+      and acknowledged with row indexes (insert) or the table name (upsert);
+    - "count table" queries replied with the count of received rows;
+    - "table:..." queries which (re)define the table with no rows.
+    Any other query is replied with the generic null (::).
+
+    Message contents are validated and skipped, not stored. The server
+    listens on the loopback interface only, so the kdb+ C library never
+    compresses messages for it (compressed messages are rejected).
+
+    Each connection is served by its own thread.
+*/
+class KdbServer
+{
+public:
+    //! Initialize the server with the given port
+    /*!
+        \param port - Port to listen on (default is 0 - any free port)
+    */
+    explicit KdbServer(int port = 0);
+    KdbServer(const KdbServer&) = delete;
+    KdbServer(KdbServer&&) = delete;
+    ~KdbServer() { Stop(); }
+
+    KdbServer& operator=(const KdbServer&) = delete;
+    KdbServer& operator=(KdbServer&&) = delete;
+
+    //! Get the listening port (valid after Start())
+    int port() const noexcept { return _port; }
+    //! Is the server running?
+    bool running() const noexcept { return _running; }
+
+    //! Get the server statistics snapshot
+    KdbServerStats stats() const;
+    //! Get the count of rows received for the given table
+    uint64_t rows(const std::string& table) const;
+
+    //! Start the server
+    /*!
+        \return 'true' if the server was successfully started, 'false' if it is already running or failed to listen
+    */
+    bool Start();
+    //! Stop the server and close all connections
+    void Stop();
+
+private:
+    int _port;
+    int _listener;
+    std::atomic<bool> _running;
+    std::thread _thread;
+
+    mutable std::mutex _mutex;
+    std::vector<std::thread> _threads;
+    std::vector<int> _sockets;
+    std::map<std::string, uint64_t> _tables;
+    KdbServerStats _stats;
+
+    void Accept();
+    void Serve(int socket);
+    bool Process(const uint8_t* data, size_t size, std::vector<uint8_t>& response);
+    void Query(const std::string& query, std::vector<uint8_t>& response);
+};
+
+} // namespace CppTrader
+
+#include "kdb_server.inl"
+
+#endif // CPPTRADER_KDB_SERVER_H
@@ -0,0 +1,24 @@
+/*!
+    \file kdb_server.inl
+    \brief Local kdb+ IPC stand-in server inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const KdbServerStats& stats)
+{
+    stream << "KdbServerStats(Connections=" << stats.Connections
+        << "; Messages=" << stats.Messages
+        << "; SyncMessages=" << stats.SyncMessages
+        << "; Bytes=" << stats.Bytes
+        << "; Rows=" << stats.Rows
+        << "; Errors=" << stats.Errors
+        << ")";
+    return stream;
+}
+
+} // namespace CppTrader
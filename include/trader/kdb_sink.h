@@ -0,0 +1,278 @@
+/*!
+    \file kdb_sink.h
+    \brief Asynchronous kdb+ writer definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_KDB_SINK_H
+#define CPPTRADER_KDB_SINK_H
+
+#include "trader/kdbp_db.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace CppTrader {
+
+//! kdb+ sink settings
+struct KdbSinkSettings
+{
+    //! Count of rows which are handed to the writer thread as a single batch
+    size_t BatchSize;
+    //! Maximal count of rows buffered by the producer while the previous batch is still being shipped (0 - unbounded)
+    size_t MaxRows;
+
+    KdbSinkSettings() noexcept : BatchSize(10000), MaxRows(1000000) {}
+};
+
+//! kdb+ sink table statistics
+struct KdbSinkStats
+{
+    //! Count of rows pushed by the producer
+    uint64_t Rows;
+    //! Count of rows pushed beyond the batch size while the previous batch was still being shipped
+    uint64_t Overflows;
+    //! Count of producer waits for the writer thread (buffer limit or flush)
+    uint64_t Blocks;
+    //! Total time in nanoseconds the producer waited for the writer thread
+    uint64_t BlockedTime;
+    //! Maximal count of rows buffered by the producer
+    uint64_t MaxBuffered;
+    //! Count of shipped batches
+    uint64_t Batches;
+    //! Count of shipped rows
+    uint64_t Shipped;
+    //! Count of batches which failed to ship
+    uint64_t Errors;
+    //! Total time in nanoseconds spent on converting and shipping batches
+    uint64_t ShipTime;
+    //! Maximal time in nanoseconds spent on converting and shipping a single batch
+    uint64_t MaxShipTime;
+
+    KdbSinkStats() noexcept
+        : Rows(0), Overflows(0), Blocks(0), BlockedTime(0), MaxBuffered(0),
+          Batches(0), Shipped(0), Errors(0), ShipTime(0), MaxShipTime(0)
+    {}
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const KdbSinkStats& stats);
+};
+
+class KdbSink;
+
+//! kdb+ sink table base
+/*!
+    Type independent part of the sink table which is driven by the writer thread.
+*/
+class KdbSinkTableBase
+{
+    friend class KdbSink;
+
+public:
+    KdbSinkTableBase(KdbSink& sink, const std::string& name);
+    KdbSinkTableBase(const KdbSinkTableBase&) = delete;
+    KdbSinkTableBase(KdbSinkTableBase&&) = delete;
+    virtual ~KdbSinkTableBase() = default;
+
+    KdbSinkTableBase& operator=(const KdbSinkTableBase&) = delete;
+    KdbSinkTableBase& operator=(KdbSinkTableBase&&) = delete;
+
+    //! Get the table name
+    const std::string& name() const noexcept { return _name; }
+
+    //! Get the table statistics snapshot
+    KdbSinkStats stats() const noexcept;
+
+    //! Hand the buffered rows to the writer thread
+    /*!
+        Should be called from the producer thread only. If the writer thread
+        is not running, rows are shipped in the calling thread.
+
+        \param wait - Wait until all buffered rows are shipped (default is false)
+    */
+    virtual void Flush(bool wait = false) = 0;
+
+protected:
+    KdbSink& _sink;
+    std::string _name;
+    std::atomic<bool> _pending;
+
+    // Producer statistics
+    std::atomic<uint64_t> _rows;
+    std::atomic<uint64_t> _overflows;
+    std::atomic<uint64_t> _blocks;
+    std::atomic<uint64_t> _blocked_time;
+    std::atomic<uint64_t> _max_buffered;
+
+    // Writer statistics
+    std::atomic<uint64_t> _batches;
+    std::atomic<uint64_t> _shipped;
+    std::atomic<uint64_t> _errors;
+    std::atomic<uint64_t> _ship_time;
+    std::atomic<uint64_t> _max_ship_time;
+
+    //! Wait until the writer thread releases the pending batch
+    void WaitPending();
+    //! Ship the pending batch (called by the writer thread)
+    void ShipPending();
+
+    //! Convert and ship the pending batch
+    virtual bool Ship(size_t& rows) = 0;
+
+    static void Increment(std::atomic<uint64_t>& counter, uint64_t value = 1) noexcept
+    { counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed); }
+    static void Maximum(std::atomic<uint64_t>& counter, uint64_t value) noexcept
+    { if (value > counter.load(std::memory_order_relaxed)) counter.store(value, std::memory_order_relaxed); }
+};
+
+//! kdb+ sink table
+/*!
+    Sink table collects plain row structs of the producer (e.g. matching
+    thread) into the front buffer without any locks or allocations, apart
+    from the front buffer growth. When the batch size is reached and the
+    writer thread is idle, buffers are swapped and the full one is handed
+    to the writer thread, which converts it into kdb+ columns and ships it.
+    Both buffers keep their capacity, so in the steady state rows are only
+    copied once into the preallocated memory.
+
+    If the writer thread is still shipping the previous batch, the producer
+    keeps appending to the front buffer (overflows) up to the MaxRows limit
+    and only then waits for the writer thread (blocks).
+
+    Push() and Flush() should be called from a single producer thread.
+*/
+template <typename TRow>
+class KdbSinkTable : public KdbSinkTableBase
+{
+public:
+    //! Batch shipping function (returns 'true' if the batch was successfully shipped)
+    typedef std::function<bool(const std::vector<TRow>&)> Shipper;
+
+    KdbSinkTable(KdbSink& sink, const std::string& name, const Shipper& shipper);
+    KdbSinkTable(const KdbSinkTable&) = delete;
+    KdbSinkTable(KdbSinkTable&&) = delete;
+    ~KdbSinkTable() = default;
+
+    KdbSinkTable& operator=(const KdbSinkTable&) = delete;
+    KdbSinkTable& operator=(KdbSinkTable&&) = delete;
+
+    //! Get the count of rows buffered by the producer
+    size_t buffered() const noexcept { return _front->size(); }
+
+    //! Push the row into the sink table
+    /*!
+        \param row - Row to push
+    */
+    void Push(const TRow& row);
+
+    void Flush(bool wait = false) override;
+
+private:
+    std::vector<TRow> _buffers[2];
+    std::vector<TRow>* _front;
+    std::vector<TRow>* _back;
+    Shipper _shipper;
+
+    void Swap();
+    bool Ship(size_t& rows) override;
+};
+
+//! Asynchronous kdb+ writer
+/*!
+    kdb+ sink moves conversion of rows into kdb+ column vectors and the IPC
+    round trip from the producer thread to the background writer thread, so
+    the producer throughput does not depend on kdb+ latency. Each table has
+    its own double buffer (see KdbSinkTable), the writer thread is woken up
+    once per handed batch.
+
+    The writer thread should be the only user of its kdb+ connection while
+    the sink is running, so open a separate connection for the sink. kdb+
+    symbols are created in several threads, so the sink enables the symbols
+    lock of the kdb+ C library with setm(1).
+
+    Tables should be added before Start(). Start() and Stop() should be
+    called from the producer thread.
+*/
+class KdbSink
+{
+    friend class KdbSinkTableBase;
+    template <typename TRow>
+    friend class KdbSinkTable;
+
+public:
+    //! Initialize kdb+ sink with given settings
+    /*!
+        \param settings - Sink settings (default is KdbSinkSettings())
+    */
+    explicit KdbSink(const KdbSinkSettings& settings = KdbSinkSettings());
+    KdbSink(const KdbSink&) = delete;
+    KdbSink(KdbSink&&) = delete;
+    ~KdbSink() { Stop(); }
+
+    KdbSink& operator=(const KdbSink&) = delete;
+    KdbSink& operator=(KdbSink&&) = delete;
+
+    //! Get the sink settings
+    const KdbSinkSettings& settings() const noexcept { return _settings; }
+    //! Is the writer thread running?
+    bool running() const noexcept { return _running; }
+
+    //! Get the count of tables
+    size_t tables() const noexcept { return _tables.size(); }
+    //! Get the table with the given index
+    const KdbSinkTableBase& table(size_t index) const noexcept { return *_tables[index]; }
+
+    //! Add the sink table with the custom batch shipping function
+    /*!
+        \param name - Table name
+        \param shipper - Batch shipping function called from the writer thread
+        \return Sink table
+    */
+    template <typename TRow>
+    KdbSinkTable<TRow>& AddTable(const std::string& name, const typename KdbSinkTable<TRow>::Shipper& shipper);
+    //! Add the sink table which is shipped into kdb+ table with the given query
+    /*!
+        \param kdb - kdb+ connection used by the writer thread only
+        \param query - Insert query (e.g. "insert" or "upsert")
+        \param table - kdb+ table name
+        \param converter - Batch into kdb+ columns converter called from the writer thread
+        \return Sink table
+    */
+    template <typename TRow>
+    KdbSinkTable<TRow>& AddTable(Kdbp& kdb, const std::string& query, const std::string& table, const std::function<K(const std::vector<TRow>&)>& converter);
+
+    //! Start the writer thread
+    /*!
+        \return 'true' if the writer thread was successfully started, 'false' if it is already running
+    */
+    bool Start();
+    //! Flush all tables and stop the writer thread after all batches are shipped
+    void Stop();
+
+private:
+    KdbSinkSettings _settings;
+    std::vector<std::unique_ptr<KdbSinkTableBase>> _tables;
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _signaled;
+    bool _stop;
+    bool _running;
+
+    void Notify();
+    void Run();
+};
+
+} // namespace CppTrader
+
+#include "kdb_sink.inl"
+
+#endif // CPPTRADER_KDB_SINK_H
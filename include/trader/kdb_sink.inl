@@ -0,0 +1,121 @@
+/*!
+    \file kdb_sink.inl
+    \brief Asynchronous kdb+ writer inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const KdbSinkStats& stats)
+{
+    stream << "KdbSinkStats(Rows=" << stats.Rows
+        << "; Overflows=" << stats.Overflows
+        << "; Blocks=" << stats.Blocks
+        << "; BlockedTime=" << stats.BlockedTime
+        << "; MaxBuffered=" << stats.MaxBuffered
+        << "; Batches=" << stats.Batches
+        << "; Shipped=" << stats.Shipped
+        << "; Errors=" << stats.Errors
+        << "; ShipTime=" << stats.ShipTime
+        << "; MaxShipTime=" << stats.MaxShipTime
+        << ")";
+    return stream;
+}
+
+template <typename TRow>
+inline KdbSinkTable<TRow>::KdbSinkTable(KdbSink& sink, const std::string& name, const Shipper& shipper)
+    : KdbSinkTableBase(sink, name),
+      _front(&_buffers[0]),
+      _back(&_buffers[1]),
+      _shipper(shipper)
+{
+    _buffers[0].reserve(sink.settings().BatchSize);
+    _buffers[1].reserve(sink.settings().BatchSize);
+}
+
+template <typename TRow>
+inline void KdbSinkTable<TRow>::Push(const TRow& row)
+{
+    _front->push_back(row);
+    Increment(_rows);
+
+    size_t size = _front->size();
+    if (size < _sink.settings().BatchSize)
+        return;
+
+    if (!_pending.load(std::memory_order_acquire))
+    {
+        Maximum(_max_buffered, size);
+        Swap();
+        return;
+    }
+
+    // The writer thread is still shipping the previous batch
+    Increment(_overflows);
+    if ((_sink.settings().MaxRows > 0) && (size >= _sink.settings().MaxRows))
+    {
+        Maximum(_max_buffered, size);
+        WaitPending();
+        Swap();
+    }
+}
+
+template <typename TRow>
+inline void KdbSinkTable<TRow>::Flush(bool wait)
+{
+    if (!_front->empty())
+    {
+        Maximum(_max_buffered, _front->size());
+        WaitPending();
+        Swap();
+    }
+    if (wait)
+        WaitPending();
+}
+
+template <typename TRow>
+inline void KdbSinkTable<TRow>::Swap()
+{
+    std::swap(_front, _back);
+    _pending.store(true, std::memory_order_release);
+
+    // Ship in the producer thread if there is no writer thread
+    if (_sink.running())
+        _sink.Notify();
+    else
+        ShipPending();
+}
+
+template <typename TRow>
+inline bool KdbSinkTable<TRow>::Ship(size_t& rows)
+{
+    rows = _back->size();
+    bool result = _shipper(*_back);
+    _back->clear();
+    return result;
+}
+
+template <typename TRow>
+inline KdbSinkTable<TRow>& KdbSink::AddTable(const std::string& name, const typename KdbSinkTable<TRow>::Shipper& shipper)
+{
+    auto table = new KdbSinkTable<TRow>(*this, name, shipper);
+    _tables.emplace_back(table);
+    return *table;
+}
+
+template <typename TRow>
+inline KdbSinkTable<TRow>& KdbSink::AddTable(Kdbp& kdb, const std::string& query, const std::string& table, const std::function<K(const std::vector<TRow>&)>& converter)
+{
+    // kdb+ symbols are created by the producer and the writer threads
+    setm(1);
+
+    return AddTable<TRow>(table, [&kdb, query, table, converter](const std::vector<TRow>& rows)
+    {
+        return kdb.insertMultRow(query, table, converter(rows)) == 0;
+    });
+}
+
+} // namespace CppTrader
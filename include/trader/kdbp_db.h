@@ -7,6 +7,12 @@
 #include <regex>
 #include <string>
 #include <chrono>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
 #include "../kdb/c/c/k.h"
 
 
@@ -19,6 +25,7 @@ public:
     Kdbp(I kdb){
         _kdb = kdb; 
     }
+    I handle() const { return _kdb; }
     J castTime(struct tm *x);
     
     int insertMultRow(const std::string& query, const std::string& table, K rows);
@@ -37,4 +44,205 @@ public:
 };
 
 
+//! kdb+ vector element type
+template <int KType>
+struct KdbColumnType;
+
+template <> struct KdbColumnType<KB> { typedef G Type; };
+template <> struct KdbColumnType<KG> { typedef G Type; };
+template <> struct KdbColumnType<KH> { typedef H Type; };
+template <> struct KdbColumnType<KI> { typedef I Type; };
+template <> struct KdbColumnType<KJ> { typedef J Type; };
+template <> struct KdbColumnType<KE> { typedef E Type; };
+template <> struct KdbColumnType<KF> { typedef F Type; };
+template <> struct KdbColumnType<KC> { typedef C Type; };
+template <> struct KdbColumnType<KS> { typedef S Type; };
+template <> struct KdbColumnType<KP> { typedef J Type; };
+template <> struct KdbColumnType<KM> { typedef I Type; };
+template <> struct KdbColumnType<KD> { typedef I Type; };
+template <> struct KdbColumnType<KN> { typedef J Type; };
+template <> struct KdbColumnType<KU> { typedef I Type; };
+template <> struct KdbColumnType<KV> { typedef I Type; };
+template <> struct KdbColumnType<KT> { typedef I Type; };
+
+//! kdb+ column field of the row
+/*!
+    Field is described with kdb+ vector type (e.g. KJ) and the row member
+    pointer (e.g. &Position::Quantity) or the row getter function (e.g.
+    for nested or converted values). Values are cast to the kdb+ vector
+    element type, symbol (KS) values are interned with ss().
+*/
+template <int KType, auto Getter>
+struct KdbField
+{
+    //! kdb+ vector type
+    static constexpr int Type = KType;
+    //! kdb+ vector element type
+    typedef typename KdbColumnType<KType>::Type Value;
+
+    //! Get the raw field value of the given row (not cast and not interned)
+    template <typename TRow>
+    static decltype(auto) Raw(const TRow& row) { return std::invoke(Getter, row); }
+
+    //! Get the field value of the given row
+    template <typename TRow>
+    static Value Get(const TRow& row)
+    {
+        if constexpr (KType == KS)
+            return ss((S)std::invoke(Getter, row));
+        else
+            return (Value)std::invoke(Getter, row);
+    }
+};
+
+//! kdb+ columnar batch of rows
+/*!
+    Columnar batch converts rows into kdb+ column vectors described by the
+    compile-time field list, e.g.:
+    \code
+    typedef KdbColumnBatch<Position, KdbField<KJ, &Position::Id>, KdbField<KJ, &Position::Quantity>> PositionsBatch;
+    \endcode
+
+    Column vectors and the general list of them are allocated once and
+    reused across batches. Columns grow geometrically when the batch does
+    not fit into their capacity, so in the steady state adding of rows and
+    emitting of columns do not allocate any K objects.
+
+    Emitted columns are owned by the batch and are valid until the next
+    change of the batch. They are passed to kdb+ with an additional reference
+    (e.g. Kdbp::insertMultRow() consumes it), so the next change of the batch
+    should happen only after the emitted columns are sent.
+
+    Not thread-safe.
+*/
+template <typename TRow, typename... TFields>
+class KdbColumnBatch
+{
+public:
+    //! Count of columns
+    static constexpr size_t COLUMNS = sizeof...(TFields);
+
+    //! Initialize the batch with the given rows capacity
+    /*!
+        \param capacity - Initial rows capacity (default is 1024)
+    */
+    explicit KdbColumnBatch(size_t capacity = 1024);
+    KdbColumnBatch(const KdbColumnBatch&) = delete;
+    KdbColumnBatch(KdbColumnBatch&&) = delete;
+    ~KdbColumnBatch() { r0(_columns); }
+
+    KdbColumnBatch& operator=(const KdbColumnBatch&) = delete;
+    KdbColumnBatch& operator=(KdbColumnBatch&&) = delete;
+
+    //! Is the batch empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Get the count of rows
+    size_t size() const noexcept { return _size; }
+    //! Get the rows capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the column vector with the given index
+    K column(size_t index) const noexcept { return kK(_columns)[index]; }
+
+    //! Reserve the given rows capacity
+    /*!
+        \param capacity - Rows capacity
+    */
+    void Reserve(size_t capacity);
+
+    //! Add the row into the batch
+    /*!
+        \param row - Row to add
+    */
+    void Add(const TRow& row);
+    //! Add rows into the batch
+    /*!
+        \param rows - Rows to add
+        \param count - Count of rows
+    */
+    void Add(const TRow* rows, size_t count);
+
+    //! Clear the batch
+    void Clear() noexcept { _size = 0; }
+
+    //! Emit the general list of batch columns
+    /*!
+        \return General list of column vectors with an additional reference
+    */
+    K Emit();
+    //! Replace the batch with given rows and emit its columns
+    /*!
+        \param rows - Rows to emit
+        \return General list of column vectors with an additional reference
+    */
+    K Emit(const std::vector<TRow>& rows);
+
+private:
+    K _columns;
+    size_t _size;
+    size_t _capacity;
+
+    template <size_t... Index>
+    void Store(const TRow& row, std::index_sequence<Index...>);
+    template <size_t... Index>
+    void Allocate(size_t capacity, std::index_sequence<Index...>);
+};
+
+//! kdb+ table columns view
+/*!
+    Table view resolves columns of the kdb+ table (or the keyed table, with
+    both key and value columns visible) by their names and types, so rows
+    are read by walking typed column vectors directly instead of reading
+    K atoms field by field, e.g.:
+    \code
+    KdbTable table(result);
+    const J* ids = table.column<KJ>("Id");
+    const F* prices = table.column<KF>("AvgEntryPrice");
+    \endcode
+
+    Table view does not own the table, which should outlive the view.
+*/
+class KdbTable
+{
+public:
+    //! Initialize the view of the given table
+    /*!
+        \param table - Table or keyed table (any other object makes the view invalid)
+    */
+    explicit KdbTable(K table) noexcept;
+    KdbTable(const KdbTable&) noexcept = default;
+    KdbTable(KdbTable&&) noexcept = default;
+    ~KdbTable() noexcept = default;
+
+    KdbTable& operator=(const KdbTable&) noexcept = default;
+    KdbTable& operator=(KdbTable&&) noexcept = default;
+
+    //! Is the view valid?
+    bool valid() const noexcept { return _parts > 0; }
+    //! Get the count of rows
+    size_t rows() const noexcept { return _rows; }
+
+    //! Get the column vector with the given name
+    /*!
+        \param name - Column name
+        \return Column vector or nullptr if the column is not found
+    */
+    K column(const char* name) const noexcept;
+    //! Get the column data with the given name and kdb+ vector type
+    /*!
+        \param name - Column name
+        \return Column data or nullptr if the column is not found or has another type
+    */
+    template <int KType>
+    const typename KdbColumnType<KType>::Type* column(const char* name) const noexcept;
+
+private:
+    // Column names and column vectors of the table and the key table
+    K _names[2];
+    K _values[2];
+    size_t _parts;
+    size_t _rows;
+};
+
+#include "kdbp_db.inl"
+
 #endif // CPPTRADER_KDB_DB_H
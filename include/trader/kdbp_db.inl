@@ -0,0 +1,160 @@
+/*!
+    \file kdbp_db.inl
+    \brief kdb+ columnar batch inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+template <typename TRow, typename... TFields>
+inline KdbColumnBatch<TRow, TFields...>::KdbColumnBatch(size_t capacity)
+    : _columns(ktn(0, COLUMNS)),
+      _size(0),
+      _capacity(std::max(capacity, (size_t)1))
+{
+    std::memset(kK(_columns), 0, COLUMNS * sizeof(K));
+    Allocate(_capacity, std::index_sequence_for<TFields...>());
+}
+
+template <typename TRow, typename... TFields>
+inline void KdbColumnBatch<TRow, TFields...>::Reserve(size_t capacity)
+{
+    // Emitted columns should be released by kdb+ before the batch is changed
+    assert((_columns->r == 0) && "Emitted kdb+ columns are still referenced!");
+
+    if (capacity <= _capacity)
+        return;
+
+    // Grow columns geometrically
+    size_t reserve = _capacity;
+    while (reserve < capacity)
+        reserve *= 2;
+
+    Allocate(reserve, std::index_sequence_for<TFields...>());
+    _capacity = reserve;
+}
+
+template <typename TRow, typename... TFields>
+inline void KdbColumnBatch<TRow, TFields...>::Add(const TRow& row)
+{
+    if (_size == _capacity)
+        Reserve(_size + 1);
+    else
+        assert((_columns->r == 0) && "Emitted kdb+ columns are still referenced!");
+
+    Store(row, std::index_sequence_for<TFields...>());
+    ++_size;
+}
+
+template <typename TRow, typename... TFields>
+inline void KdbColumnBatch<TRow, TFields...>::Add(const TRow* rows, size_t count)
+{
+    Reserve(_size + count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Store(rows[i], std::index_sequence_for<TFields...>());
+        ++_size;
+    }
+}
+
+template <typename TRow, typename... TFields>
+inline K KdbColumnBatch<TRow, TFields...>::Emit()
+{
+    for (size_t i = 0; i < COLUMNS; ++i)
+        kK(_columns)[i]->n = (J)_size;
+    return r1(_columns);
+}
+
+template <typename TRow, typename... TFields>
+inline K KdbColumnBatch<TRow, TFields...>::Emit(const std::vector<TRow>& rows)
+{
+    Clear();
+    Add(rows.data(), rows.size());
+    return Emit();
+}
+
+template <typename TRow, typename... TFields>
+template <size_t... Index>
+inline void KdbColumnBatch<TRow, TFields...>::Store(const TRow& row, std::index_sequence<Index...>)
+{
+    ((((typename TFields::Value*)kG(kK(_columns)[Index]))[_size] = TFields::Get(row)), ...);
+}
+
+template <typename TRow, typename... TFields>
+template <size_t... Index>
+inline void KdbColumnBatch<TRow, TFields...>::Allocate(size_t capacity, std::index_sequence<Index...>)
+{
+    // Allocate new columns and move already added rows into them
+    K columns[COLUMNS] = { ktn(TFields::Type, (J)capacity)... };
+    size_t sizes[COLUMNS] = { sizeof(typename TFields::Value)... };
+    for (size_t i = 0; i < COLUMNS; ++i)
+    {
+        K column = kK(_columns)[i];
+        if (column != nullptr)
+        {
+            std::memcpy(kG(columns[i]), kG(column), _size * sizes[i]);
+            r0(column);
+        }
+        kK(_columns)[i] = columns[i];
+    }
+}
+
+inline KdbTable::KdbTable(K table) noexcept
+    : _names{ nullptr, nullptr }, _values{ nullptr, nullptr }, _parts(0), _rows(0)
+{
+    if (table == nullptr)
+        return;
+
+    // Keyed table is the dictionary of the key table and the value table
+    K tables[2] = { table, nullptr };
+    size_t count = 1;
+    if ((table->t == XD) && (kK(table)[0]->t == XT) && (kK(table)[1]->t == XT))
+    {
+        tables[0] = kK(table)[0];
+        tables[1] = kK(table)[1];
+        count = 2;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (tables[i]->t != XT)
+            return;
+        K columns = tables[i]->k;
+        K names = kK(columns)[0];
+        K values = kK(columns)[1];
+        // Column names and the general list of the same count of column vectors
+        if ((names->t != KS) || (values->t != 0) || (names->n != values->n))
+            return;
+        _names[i] = names;
+        _values[i] = values;
+    }
+    _parts = count;
+
+    // Count of rows is the length of the first column (table without columns has no rows)
+    for (size_t i = 0; i < _parts; ++i)
+    {
+        if (_values[i]->n > 0)
+        {
+            _rows = (size_t)kK(_values[i])[0]->n;
+            break;
+        }
+    }
+}
+
+inline K KdbTable::column(const char* name) const noexcept
+{
+    for (size_t i = 0; i < _parts; ++i)
+        for (J j = 0; j < _names[i]->n; ++j)
+            if (std::strcmp(kS(_names[i])[j], name) == 0)
+                return kK(_values[i])[j];
+    return nullptr;
+}
+
+template <int KType>
+inline const typename KdbColumnType<KType>::Type* KdbTable::column(const char* name) const noexcept
+{
+    K vector = column(name);
+    if ((vector == nullptr) || (vector->t != KType) || ((size_t)vector->n != _rows))
+        return nullptr;
+    return (const typename KdbColumnType<KType>::Type*)kG(vector);
+}
@@ -0,0 +1,199 @@
+/*!
+    \file market_data_book.h
+    \brief Market data order book definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_DATA_BOOK_H
+#define CPPTRADER_MATCHING_MARKET_DATA_BOOK_H
+
+#include "level.h"
+#include "symbol.h"
+
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market data price level
+struct MarketDataLevel
+{
+    //! Level type
+    LevelType Type;
+    //! Level price
+    uint32_t Price;
+    //! Level volume
+    uint64_t Volume;
+    //! Level orders
+    uint32_t Orders;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketDataLevel& level);
+
+    //! Is the bid price level?
+    bool IsBid() const noexcept { return Type == LevelType::BID; }
+    //! Is the ask price level?
+    bool IsAsk() const noexcept { return Type == LevelType::ASK; }
+};
+
+//! Market data order
+struct MarketDataOrder
+{
+    //! Order Id
+    uint64_t Id;
+    //! Symbol Id
+    uint32_t SymbolId;
+    //! Order price
+    uint32_t Price;
+    //! Order quantity (0 for unknown or deleted orders)
+    uint32_t Quantity;
+    //! Order price level index in the levels pool
+    uint32_t Level;
+    //! Order side
+    OrderSide Side;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketDataOrder& order);
+
+    //! Is the buy order?
+    bool IsBuy() const noexcept { return Side == OrderSide::BUY; }
+    //! Is the sell order?
+    bool IsSell() const noexcept { return Side == OrderSide::SELL; }
+};
+
+//! Market data price level reference (sorted price level collection item)
+struct MarketDataPriceLevel
+{
+    //! Level price
+    uint32_t Price;
+    //! Level index in the levels pool
+    uint32_t Level;
+};
+
+//! Market data price level update
+struct MarketDataLevelUpdate
+{
+    //! Update type
+    UpdateType Type;
+    //! Level update value
+    MarketDataLevel Update;
+    //! Top of the book flag
+    bool Top;
+};
+
+//! Market data price levels pool
+/*!
+    Vector-backed pool of price levels addressed by index with a free list
+    of released indexes. Indexes stay valid while the pool grows.
+
+    Not thread-safe.
+*/
+class MarketDataLevelPool
+{
+public:
+    MarketDataLevelPool() = default;
+    explicit MarketDataLevelPool(size_t reserve) { _allocated.reserve(reserve); }
+    MarketDataLevelPool(const MarketDataLevelPool&) = delete;
+    MarketDataLevelPool(MarketDataLevelPool&&) = delete;
+    ~MarketDataLevelPool() = default;
+
+    MarketDataLevelPool& operator=(const MarketDataLevelPool&) = delete;
+    MarketDataLevelPool& operator=(MarketDataLevelPool&&) = delete;
+
+    //! Get the count of allocated price levels
+    size_t allocated() const noexcept { return _allocated.size() - _free.size(); }
+
+    MarketDataLevel& operator[](uint32_t index) noexcept { return _allocated[index]; }
+    const MarketDataLevel& operator[](uint32_t index) const noexcept { return _allocated[index]; }
+
+    //! Allocate a new price level
+    uint32_t Allocate();
+    //! Release the price level with the given index
+    void Release(uint32_t index) { _free.push_back(index); }
+
+private:
+    std::vector<MarketDataLevel> _allocated;
+    std::vector<uint32_t> _free;
+};
+
+//! Market data order book
+/*!
+    Market data order book keeps aggregated price levels (L2) of the orders
+    tracked by MarketDataManager (L3). No matching is performed.
+
+    Price levels are kept in sorted vectors with the best price at the back,
+    so the most of updates near the top of the book touch only the last few
+    items. Price level data is stored in the levels pool of the market data
+    manager.
+
+    Not thread-safe.
+*/
+class MarketDataBook
+{
+    friend class MarketDataManager;
+
+public:
+    //! Price levels container (the best price level is the last one)
+    typedef std::vector<MarketDataPriceLevel> Levels;
+
+    MarketDataBook() noexcept : _pool(nullptr) {}
+    MarketDataBook(const MarketDataBook&) = delete;
+    MarketDataBook(MarketDataBook&&) noexcept = default;
+    ~MarketDataBook() = default;
+
+    MarketDataBook& operator=(const MarketDataBook&) = delete;
+    MarketDataBook& operator=(MarketDataBook&&) noexcept = default;
+
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the order book symbol
+    const Symbol& symbol() const noexcept { return _symbol; }
+
+    //! Is the order book empty?
+    bool empty() const noexcept { return _bids.empty() && _asks.empty(); }
+    //! Get the order book size
+    size_t size() const noexcept { return _bids.size() + _asks.size(); }
+
+    //! Get the order book bid price levels
+    const Levels& bids() const noexcept { return _bids; }
+    //! Get the order book ask price levels
+    const Levels& asks() const noexcept { return _asks; }
+
+    //! Get the order book best bid price level
+    const MarketDataLevel* best_bid() const noexcept { return _bids.empty() ? nullptr : &(*_pool)[_bids.back().Level]; }
+    //! Get the order book best ask price level
+    const MarketDataLevel* best_ask() const noexcept { return _asks.empty() ? nullptr : &(*_pool)[_asks.back().Level]; }
+
+    //! Get the price level data of the given price levels container item
+    const MarketDataLevel& level(const MarketDataPriceLevel& price_level) const noexcept { return (*_pool)[price_level.Level]; }
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketDataBook& order_book);
+
+private:
+    MarketDataLevelPool* _pool;
+    Symbol _symbol;
+    Levels _bids;
+    Levels _asks;
+
+    void Initialize(MarketDataLevelPool& pool, const Symbol& symbol);
+    void Release();
+
+    UpdateType FindLevel(MarketDataOrder* order_ptr);
+    void DeleteLevel(MarketDataOrder* order_ptr);
+
+    MarketDataLevelUpdate AddOrder(MarketDataOrder* order_ptr);
+    MarketDataLevelUpdate ReduceOrder(MarketDataOrder* order_ptr, uint32_t quantity);
+    MarketDataLevelUpdate DeleteOrder(MarketDataOrder* order_ptr);
+
+    bool IsTop(const MarketDataOrder* order_ptr) const noexcept;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_data_book.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_DATA_BOOK_H
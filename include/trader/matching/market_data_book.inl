@@ -0,0 +1,205 @@
+/*!
+    \file market_data_book.inl
+    \brief Market data order book inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketDataLevel& level)
+{
+    stream << "MarketDataLevel(Type=" << level.Type
+        << "; Price=" << level.Price
+        << "; Volume=" << level.Volume
+        << "; Orders=" << level.Orders
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketDataOrder& order)
+{
+    stream << "MarketDataOrder(Id=" << order.Id
+        << "; SymbolId=" << order.SymbolId
+        << "; Side=" << order.Side
+        << "; Price=" << order.Price
+        << "; Quantity=" << order.Quantity
+        << ")";
+    return stream;
+}
+
+inline uint32_t MarketDataLevelPool::Allocate()
+{
+    if (_free.empty())
+    {
+        uint32_t index = (uint32_t)_allocated.size();
+        _allocated.emplace_back();
+        return index;
+    }
+    else
+    {
+        uint32_t index = _free.back();
+        _free.pop_back();
+        return index;
+    }
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketDataBook& order_book)
+{
+    stream << "MarketDataBook(Symbol=" << order_book._symbol
+        << "; Bids=" << order_book._bids.size()
+        << "; Asks=" << order_book._asks.size()
+        << ")";
+    return stream;
+}
+
+inline void MarketDataBook::Initialize(MarketDataLevelPool& pool, const Symbol& symbol)
+{
+    _pool = &pool;
+    _symbol = symbol;
+    _bids.clear();
+    _asks.clear();
+}
+
+inline void MarketDataBook::Release()
+{
+    // Release all price levels
+    for (const auto& bid : _bids)
+        _pool->Release(bid.Level);
+    for (const auto& ask : _asks)
+        _pool->Release(ask.Level);
+
+    _pool = nullptr;
+    _bids.clear();
+    _asks.clear();
+}
+
+inline UpdateType MarketDataBook::FindLevel(MarketDataOrder* order_ptr)
+{
+    bool bid = order_ptr->IsBuy();
+    Levels& levels = bid ? _bids : _asks;
+
+    // Try to find required price level starting from the best one
+    size_t index = levels.size();
+    while (index > 0)
+    {
+        const MarketDataPriceLevel& price_level = levels[index - 1];
+        if (price_level.Price == order_ptr->Price)
+        {
+            order_ptr->Level = price_level.Level;
+            return UpdateType::UPDATE;
+        }
+        if (bid ? (price_level.Price < order_ptr->Price) : (price_level.Price > order_ptr->Price))
+            break;
+        --index;
+    }
+
+    // Create a new price level
+    uint32_t level_index = _pool->Allocate();
+    MarketDataLevel& level = (*_pool)[level_index];
+    level.Type = bid ? LevelType::BID : LevelType::ASK;
+    level.Price = order_ptr->Price;
+    level.Volume = 0;
+    level.Orders = 0;
+
+    // Insert the price level into the price level collection
+    levels.insert(levels.begin() + index, MarketDataPriceLevel{ order_ptr->Price, level_index });
+
+    order_ptr->Level = level_index;
+    return UpdateType::ADD;
+}
+
+inline void MarketDataBook::DeleteLevel(MarketDataOrder* order_ptr)
+{
+    bool bid = order_ptr->IsBuy();
+    Levels& levels = bid ? _bids : _asks;
+
+    // Try to find required price level starting from the best one
+    size_t index = levels.size();
+    while (index > 0)
+    {
+        const MarketDataPriceLevel& price_level = levels[index - 1];
+        if (price_level.Price == order_ptr->Price)
+        {
+            // Erase the price level from the price level collection
+            levels.erase(levels.begin() + (index - 1));
+            break;
+        }
+        if (bid ? (price_level.Price < order_ptr->Price) : (price_level.Price > order_ptr->Price))
+            break;
+        --index;
+    }
+
+    // Release the price level
+    _pool->Release(order_ptr->Level);
+}
+
+inline bool MarketDataBook::IsTop(const MarketDataOrder* order_ptr) const noexcept
+{
+    const Levels& levels = order_ptr->IsBuy() ? _bids : _asks;
+    return !levels.empty() && (levels.back().Level == order_ptr->Level);
+}
+
+inline MarketDataLevelUpdate MarketDataBook::AddOrder(MarketDataOrder* order_ptr)
+{
+    // Find the price level for the order
+    UpdateType type = FindLevel(order_ptr);
+    MarketDataLevel& level = (*_pool)[order_ptr->Level];
+
+    // Update the price level volume and orders count
+    level.Volume += order_ptr->Quantity;
+    ++level.Orders;
+
+    return MarketDataLevelUpdate{ type, level, IsTop(order_ptr) };
+}
+
+inline MarketDataLevelUpdate MarketDataBook::ReduceOrder(MarketDataOrder* order_ptr, uint32_t quantity)
+{
+    MarketDataLevel& level = (*_pool)[order_ptr->Level];
+
+    // Update the price level volume
+    level.Volume -= quantity;
+
+    // Update the price level orders count (the order quantity is already reduced)
+    if (order_ptr->Quantity == 0)
+        --level.Orders;
+
+    MarketDataLevelUpdate update{ UpdateType::UPDATE, level, IsTop(order_ptr) };
+
+    // Delete the empty price level
+    if (level.Orders == 0)
+    {
+        DeleteLevel(order_ptr);
+        update.Type = UpdateType::DELETE;
+    }
+
+    return update;
+}
+
+inline MarketDataLevelUpdate MarketDataBook::DeleteOrder(MarketDataOrder* order_ptr)
+{
+    MarketDataLevel& level = (*_pool)[order_ptr->Level];
+
+    // Update the price level volume and orders count
+    level.Volume -= order_ptr->Quantity;
+    --level.Orders;
+
+    MarketDataLevelUpdate update{ UpdateType::UPDATE, level, IsTop(order_ptr) };
+
+    // Delete the empty price level
+    if (level.Orders == 0)
+    {
+        DeleteLevel(order_ptr);
+        update.Type = UpdateType::DELETE;
+    }
+
+    return update;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,69 @@
+/*!
+    \file market_data_handler.h
+    \brief Market data handler definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_DATA_HANDLER_H
+#define CPPTRADER_MATCHING_MARKET_DATA_HANDLER_H
+
+#include "market_data_book.h"
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market data handler class
+/*!
+    Market data handler is used to handle all market data events from
+    MarketDataManager with a custom actions. Events are the same as the
+    MarketHandler ones:
+    \li Add/Remove symbols
+    \li Add/Remove/Modify orders
+    \li Order executions
+    \li Order book updates
+
+    Not thread-safe.
+*/
+class MarketDataHandler
+{
+    friend class MarketDataManager;
+
+public:
+    MarketDataHandler() = default;
+    MarketDataHandler(const MarketDataHandler&) = delete;
+    MarketDataHandler(MarketDataHandler&&) = delete;
+    virtual ~MarketDataHandler() = default;
+
+    MarketDataHandler& operator=(const MarketDataHandler&) = delete;
+    MarketDataHandler& operator=(MarketDataHandler&&) = delete;
+
+protected:
+    // Symbol handlers
+    virtual void onAddSymbol(const Symbol& symbol) {}
+    virtual void onDeleteSymbol(const Symbol& symbol) {}
+
+    // Order book handlers
+    virtual void onAddOrderBook(const MarketDataBook& order_book) {}
+    virtual void onUpdateOrderBook(const MarketDataBook& order_book, bool top) {}
+    virtual void onDeleteOrderBook(const MarketDataBook& order_book) {}
+
+    // Price level handlers
+    virtual void onAddLevel(const MarketDataBook& order_book, const MarketDataLevel& level, bool top) {}
+    virtual void onUpdateLevel(const MarketDataBook& order_book, const MarketDataLevel& level, bool top) {}
+    virtual void onDeleteLevel(const MarketDataBook& order_book, const MarketDataLevel& level, bool top) {}
+
+    // Order handlers
+    virtual void onAddOrder(const MarketDataOrder& order) {}
+    virtual void onUpdateOrder(const MarketDataOrder& order) {}
+    virtual void onDeleteOrder(const MarketDataOrder& order) {}
+
+    // Order execution handlers
+    virtual void onExecuteOrder(const MarketDataOrder& order, uint64_t price, uint64_t quantity) {}
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#endif // CPPTRADER_MATCHING_MARKET_DATA_HANDLER_H
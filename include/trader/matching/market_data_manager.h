@@ -0,0 +1,194 @@
+/*!
+    \file market_data_manager.h
+    \brief Market data manager definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_DATA_MANAGER_H
+#define CPPTRADER_MATCHING_MARKET_DATA_MANAGER_H
+
+#include "errors.h"
+#include "market_data_handler.h"
+
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market data manager
+/*!
+    Market data manager is used to build order books (L2 price levels and
+    L3 orders) from the market data feed (e.g. NASDAQ ITCH). Unlike the
+    MarketManager no matching is performed: the feed is the source of truth
+    for all executions.
+
+    All containers are vectors indexed by symbol and order Ids, so Ids are
+    expected to be dense (as stock locate codes and order reference numbers
+    in ITCH feeds). Containers grow on demand and could be reserved in the
+    constructor to avoid reallocations in the hot path. Price levels of all
+    order books share a single vector-backed pool.
+
+    Prices and quantities are 32-bit (ITCH precision).
+
+    Operations on unknown orders return ErrorCode::ORDER_NOT_FOUND without
+    asserts, because feed sessions joined in the middle of the day could
+    reference orders added before the join.
+
+    Not thread-safe.
+*/
+class MarketDataManager
+{
+public:
+    //! Order books container
+    typedef std::vector<MarketDataBook> OrderBooks;
+    //! Orders container
+    typedef std::vector<MarketDataOrder> Orders;
+
+    //! Initialize market data manager
+    /*!
+        \param market_handler - Market data handler
+        \param symbols - Reserved symbols count (default is 0)
+        \param orders - Reserved orders count (default is 0)
+        \param levels - Reserved price levels count (default is 0)
+    */
+    explicit MarketDataManager(MarketDataHandler& market_handler, size_t symbols = 0, size_t orders = 0, size_t levels = 0);
+    MarketDataManager(const MarketDataManager&) = delete;
+    MarketDataManager(MarketDataManager&&) = delete;
+    ~MarketDataManager() = default;
+
+    MarketDataManager& operator=(const MarketDataManager&) = delete;
+    MarketDataManager& operator=(MarketDataManager&&) = delete;
+
+    //! Get the order books container
+    const OrderBooks& order_books() const noexcept { return _order_books; }
+    //! Get the orders container
+    const Orders& orders() const noexcept { return _orders; }
+    //! Get the price levels pool
+    const MarketDataLevelPool& levels() const noexcept { return _levels; }
+
+    //! Get the symbol with the given Id
+    /*!
+        \param id - Symbol Id
+        \return Pointer to the symbol with the given Id or nullptr
+    */
+    const Symbol* GetSymbol(uint32_t id) const noexcept;
+    //! Get the order book for the given symbol Id
+    /*!
+        \param id - Symbol Id of the order book
+        \return Pointer to the order book with the given symbol Id or nullptr
+    */
+    const MarketDataBook* GetOrderBook(uint32_t id) const noexcept;
+    //! Get the order with the given Id
+    /*!
+        \param id - Order Id
+        \return Pointer to the order with the given Id or nullptr
+    */
+    const MarketDataOrder* GetOrder(uint64_t id) const noexcept;
+
+    //! Add a new symbol
+    /*!
+        \param symbol - Symbol to add
+        \return Error code
+    */
+    ErrorCode AddSymbol(const Symbol& symbol);
+    //! Delete the symbol
+    /*!
+        \param id - Symbol Id
+        \return Error code
+    */
+    ErrorCode DeleteSymbol(uint32_t id);
+
+    //! Add a new order book
+    /*!
+        \param symbol - Symbol of the order book to add
+        \return Error code
+    */
+    ErrorCode AddOrderBook(const Symbol& symbol);
+    //! Delete the order book
+    /*!
+        Orders of the deleted order book are deleted without notifications.
+
+        \param id - Symbol Id of the order book
+        \return Error code
+    */
+    ErrorCode DeleteOrderBook(uint32_t id);
+
+    //! Add a new order
+    /*!
+        \param id - Order Id
+        \param symbol - Symbol Id
+        \param side - Order side
+        \param price - Order price
+        \param quantity - Order quantity
+        \return Error code
+    */
+    ErrorCode AddOrder(uint64_t id, uint32_t symbol, OrderSide side, uint32_t price, uint32_t quantity);
+    //! Reduce the order by the given quantity
+    /*!
+        \param id - Order Id
+        \param quantity - Order quantity to reduce
+        \return Error code
+    */
+    ErrorCode ReduceOrder(uint64_t id, uint32_t quantity);
+    //! Modify the order
+    /*!
+        \param id - Order Id
+        \param new_price - Order price to modify
+        \param new_quantity - Order quantity to modify
+        \return Error code
+    */
+    ErrorCode ModifyOrder(uint64_t id, uint32_t new_price, uint32_t new_quantity);
+    //! Replace the order with a similar order but different Id, price and quantity
+    /*!
+        \param id - Order Id
+        \param new_id - Order Id to replace
+        \param new_price - Order price to replace
+        \param new_quantity - Order quantity to replace
+        \return Error code
+    */
+    ErrorCode ReplaceOrder(uint64_t id, uint64_t new_id, uint32_t new_price, uint32_t new_quantity);
+    //! Delete the order
+    /*!
+        \param id - Order Id
+        \return Error code
+    */
+    ErrorCode DeleteOrder(uint64_t id);
+
+    //! Execute the order at its price
+    /*!
+        \param id - Order Id
+        \param quantity - Order executed quantity
+        \return Error code
+    */
+    ErrorCode ExecuteOrder(uint64_t id, uint32_t quantity);
+    //! Execute the order at the given price
+    /*!
+        \param id - Order Id
+        \param price - Order executed price
+        \param quantity - Order executed quantity
+        \return Error code
+    */
+    ErrorCode ExecuteOrder(uint64_t id, uint32_t price, uint32_t quantity);
+
+private:
+    MarketDataHandler& _market_handler;
+
+    std::vector<Symbol> _symbols;
+    std::vector<bool> _symbols_active;
+    OrderBooks _order_books;
+    Orders _orders;
+    MarketDataLevelPool _levels;
+
+    MarketDataOrder* FindOrder(uint64_t id) noexcept;
+    ErrorCode ReduceOrder(MarketDataOrder* order_ptr, uint32_t quantity, bool execute, uint32_t price);
+    void UpdateLevel(const MarketDataBook& order_book, const MarketDataLevelUpdate& update) const;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_data_manager.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_DATA_MANAGER_H
@@ -0,0 +1,62 @@
+/*!
+    \file market_data_manager.inl
+    \brief Market data manager inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline MarketDataManager::MarketDataManager(MarketDataHandler& market_handler, size_t symbols, size_t orders, size_t levels)
+    : _market_handler(market_handler),
+      _levels(levels)
+{
+    _symbols.reserve(symbols);
+    _symbols_active.reserve(symbols);
+    _order_books.reserve(symbols);
+    _orders.reserve(orders);
+}
+
+inline const Symbol* MarketDataManager::GetSymbol(uint32_t id) const noexcept
+{
+    return ((id < _symbols.size()) && _symbols_active[id]) ? &_symbols[id] : nullptr;
+}
+
+inline const MarketDataBook* MarketDataManager::GetOrderBook(uint32_t id) const noexcept
+{
+    return ((id < _order_books.size()) && (_order_books[id]._pool != nullptr)) ? &_order_books[id] : nullptr;
+}
+
+inline const MarketDataOrder* MarketDataManager::GetOrder(uint64_t id) const noexcept
+{
+    return ((id < _orders.size()) && (_orders[id].Quantity > 0)) ? &_orders[id] : nullptr;
+}
+
+inline MarketDataOrder* MarketDataManager::FindOrder(uint64_t id) noexcept
+{
+    return ((id < _orders.size()) && (_orders[id].Quantity > 0)) ? &_orders[id] : nullptr;
+}
+
+inline void MarketDataManager::UpdateLevel(const MarketDataBook& order_book, const MarketDataLevelUpdate& update) const
+{
+    switch (update.Type)
+    {
+        case UpdateType::ADD:
+            _market_handler.onAddLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::UPDATE:
+            _market_handler.onUpdateLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::DELETE:
+            _market_handler.onDeleteLevel(order_book, update.Update, update.Top);
+            break;
+        default:
+            break;
+    }
+    _market_handler.onUpdateOrderBook(order_book, update.Top);
+}
+
+} // namespace Matching
+} // namespace CppTrader
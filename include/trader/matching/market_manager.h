@@ -11,6 +11,8 @@
 
 #include "fast_hash.h"
 #include "market_handler.h"
+#include "market_memory.h"
+#include "market_statistics.h"
 
 #include "containers/hashmap.h"
 #include "memory/allocator_pool.h"
@@ -33,6 +35,12 @@ namespace Matching {
     Automatic orders matching can be enabled with EnableMatching() method or can be
     manually performed with Match() method.
 
+    Per-operation latency histograms are kept if the library is compiled with
+    CPPTRADER_STATISTICS definition (see statistics() method). Per-operation
+    hardware performance counters are kept if the library is compiled with
+    CPPTRADER_PERF_COUNTERS definition (see perf_profile() method). Otherwise
+    the instrumentation is compiled out completely.
+
     Not thread-safe.
 */
 class MarketManager
@@ -82,6 +90,15 @@ public:
     */
     const Order* GetOrder(uint64_t id) const noexcept;
 
+    //! Get the memory statistics of pools, orders index and order books
+    /*!
+        Order books statistics are collected by iterating all price levels,
+        so the method should not be called on hot paths.
+
+        \return Market manager memory statistics
+    */
+    MarketMemoryStats GetMemoryStats() const;
+
     //! Add a new symbol
     /*!
         \param symbol - Symbol to add
@@ -114,6 +131,25 @@ public:
         \return Error code
     */
     ErrorCode AddOrder(const Order& order);
+    //! Restore resting orders in bulk
+    /*!
+        Restores persisted resting orders (e.g. on startup) with their executed
+        and leaves quantities. The add order handler is not called (only price
+        levels are notified). Orders should be given in the order of their
+        priority (e.g. by Id), market, 'Immediate-Or-Cancel', 'Fill-Or-Kill' and
+        fully executed orders are skipped.
+
+        The whole batch is validated before any order is restored. Stop prices
+        of trailing orders are recalculated against the current market prices.
+        If matching is enabled, stop orders triggered by the current prices are
+        activated once per restored order book after the bulk insert (otherwise
+        EnableMatching() activates them).
+
+        \param orders - Orders to restore
+        \param count - Count of orders
+        \return Error code of the first invalid order (no orders are restored in this case)
+    */
+    ErrorCode RestoreOrders(const Order* orders, size_t count);
     //! Reduce the order by the given quantity
     /*!
         \param id - Order Id
@@ -223,13 +259,35 @@ public:
     */
     void Match();
 
+#if defined(CPPTRADER_STATISTICS)
+    //! Get the market operations latency statistics
+    const MarketStatistics& statistics() const noexcept { return _statistics; }
+    //! Reset the market operations latency statistics
+    void ResetStatistics() noexcept { _statistics.Reset(); }
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    //! Get the market operations hardware performance counters profile
+    /*!
+        Profile regions are indexed by MarketOperation values. Counters should
+        be opened with PerfProfile::Open() in the thread which calls the market
+        manager, operations which are not interesting could be disabled with
+        PerfProfile::Enable() to reduce the measurement overhead.
+    */
+    Statistics::PerfProfile& perf_profile() noexcept { return _perf_profile; }
+    const Statistics::PerfProfile& perf_profile() const noexcept { return _perf_profile; }
+#endif
+
 private:
     // Market handler
     static MarketHandler _default;
     MarketHandler& _market_handler;
 
-    // Auxiliary memory manager
-    CppCommon::DefaultMemoryManager _auxiliary_memory_manager;
+    // Auxiliary memory managers (one per pool to account reserved pages)
+    CppCommon::DefaultMemoryManager _level_auxiliary_memory_manager;
+    CppCommon::DefaultMemoryManager _symbol_auxiliary_memory_manager;
+    CppCommon::DefaultMemoryManager _order_book_auxiliary_memory_manager;
+    CppCommon::DefaultMemoryManager _order_auxiliary_memory_manager;
 
     // Bid/Ask price levels
     CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _level_memory_manager;
@@ -262,6 +320,16 @@ private:
     // Matching
     bool _matching;
 
+#if defined(CPPTRADER_STATISTICS)
+    // Operations latency statistics
+    MarketStatistics _statistics;
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    // Operations hardware performance counters
+    Statistics::PerfProfile _perf_profile;
+#endif
+
     void Match(OrderBook* order_book_ptr, bool internal);
     void MatchMarket(OrderBook* order_book_ptr, Order* order_ptr);
     void MatchLimit(OrderBook* order_book_ptr, Order* order_ptr);
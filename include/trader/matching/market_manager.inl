@@ -16,17 +16,23 @@ inline MarketManager::MarketManager()
 
 inline MarketManager::MarketManager(MarketHandler& market_handler)
     : _market_handler(market_handler),
-      _auxiliary_memory_manager(),
-      _level_memory_manager(_auxiliary_memory_manager),
+      _level_auxiliary_memory_manager(),
+      _symbol_auxiliary_memory_manager(),
+      _order_book_auxiliary_memory_manager(),
+      _order_auxiliary_memory_manager(),
+      _level_memory_manager(_level_auxiliary_memory_manager),
       _level_pool(_level_memory_manager),
-      _symbol_memory_manager(_auxiliary_memory_manager),
+      _symbol_memory_manager(_symbol_auxiliary_memory_manager),
       _symbol_pool(_symbol_memory_manager),
-      _order_book_memory_manager(_auxiliary_memory_manager),
+      _order_book_memory_manager(_order_book_auxiliary_memory_manager),
       _order_book_pool(_order_book_memory_manager),
-      _order_memory_manager(_auxiliary_memory_manager),
+      _order_memory_manager(_order_auxiliary_memory_manager),
       _order_pool(_order_memory_manager),
       _orders(16384, 0),
       _matching(false)
+#if defined(CPPTRADER_PERF_COUNTERS)
+      , _perf_profile(MarketOperationNames())
+#endif
 {
 
 }
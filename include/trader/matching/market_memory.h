@@ -0,0 +1,104 @@
+/*!
+    \file market_memory.h
+    \brief Market manager memory statistics definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_MEMORY_H
+#define CPPTRADER_MATCHING_MARKET_MEMORY_H
+
+#include "utility/iostream.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Memory pool statistics
+struct MemoryPoolStats
+{
+    //! Size of the pool item in bytes
+    size_t ItemSize;
+    //! Count of allocated items
+    size_t Items;
+    //! Used memory in bytes
+    size_t Used;
+    //! Reserved memory (pool pages) in bytes
+    size_t Reserved;
+
+    //! Get the share of reserved memory which is not used (0.0 if nothing is reserved)
+    double waste() const noexcept { return (Reserved > 0) ? (1.0 - (double)Used / (double)Reserved) : 0.0; }
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MemoryPoolStats& stats);
+};
+
+//! Order book memory statistics
+struct OrderBookMemoryStats
+{
+    //! Order book symbol Id
+    uint32_t SymbolId;
+    //! Count of bid price levels
+    size_t BidLevels;
+    //! Count of ask price levels
+    size_t AskLevels;
+    //! Count of stop and trailing stop price levels
+    size_t StopLevels;
+    //! Count of orders in all price levels
+    size_t Orders;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const OrderBookMemoryStats& stats);
+};
+
+//! Market manager memory statistics
+/*!
+    Pool pages are never returned to the system before the market manager
+    is destroyed, so the difference between reserved and used memory after
+    a peak session shows the memory which could be saved by smaller
+    pre-reservations.
+*/
+struct MarketMemoryStats
+{
+    //! Orders pool
+    MemoryPoolStats OrderPool;
+    //! Price levels pool
+    MemoryPoolStats LevelPool;
+    //! Symbols pool
+    MemoryPoolStats SymbolPool;
+    //! Order books pool
+    MemoryPoolStats OrderBookPool;
+
+    //! Count of orders in the orders hash table
+    size_t OrdersSize;
+    //! Count of buckets in the orders hash table
+    size_t OrdersCapacity;
+    //! Orders hash table load factor
+    double OrdersLoadFactor;
+    //! Estimated orders hash table memory in bytes
+    size_t OrdersReserved;
+
+    //! Reserved memory of symbols and order books indexes in bytes
+    size_t IndexesReserved;
+
+    //! Statistics of all order books
+    std::vector<OrderBookMemoryStats> OrderBooks;
+
+    //! Get the total used memory in bytes
+    size_t used() const noexcept { return OrderPool.Used + LevelPool.Used + SymbolPool.Used + OrderBookPool.Used; }
+    //! Get the total reserved memory in bytes
+    size_t reserved() const noexcept { return OrderPool.Reserved + LevelPool.Reserved + SymbolPool.Reserved + OrderBookPool.Reserved + OrdersReserved + IndexesReserved; }
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketMemoryStats& stats);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_memory.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_MEMORY_H
@@ -0,0 +1,55 @@
+/*!
+    \file market_memory.inl
+    \brief Market manager memory statistics inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MemoryPoolStats& stats)
+{
+    stream << "MemoryPoolStats(ItemSize=" << stats.ItemSize
+        << "; Items=" << stats.Items
+        << "; Used=" << stats.Used
+        << "; Reserved=" << stats.Reserved
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const OrderBookMemoryStats& stats)
+{
+    stream << "OrderBookMemoryStats(SymbolId=" << stats.SymbolId
+        << "; BidLevels=" << stats.BidLevels
+        << "; AskLevels=" << stats.AskLevels
+        << "; StopLevels=" << stats.StopLevels
+        << "; Orders=" << stats.Orders
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketMemoryStats& stats)
+{
+    stream << "MarketMemoryStats(OrderPool=" << stats.OrderPool
+        << "; LevelPool=" << stats.LevelPool
+        << "; SymbolPool=" << stats.SymbolPool
+        << "; OrderBookPool=" << stats.OrderBookPool
+        << "; OrdersSize=" << stats.OrdersSize
+        << "; OrdersCapacity=" << stats.OrdersCapacity
+        << "; OrdersLoadFactor=" << stats.OrdersLoadFactor
+        << "; OrdersReserved=" << stats.OrdersReserved
+        << "; IndexesReserved=" << stats.IndexesReserved
+        << "; OrderBooks=" << stats.OrderBooks.size()
+        << "; Used=" << stats.used()
+        << "; Reserved=" << stats.reserved()
+        << ")";
+    return stream;
+}
+
+} // namespace Matching
+} // namespace CppTrader
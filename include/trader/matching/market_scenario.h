@@ -0,0 +1,176 @@
+/*!
+    \file market_scenario.h
+    \brief Market scenario definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_SCENARIO_H
+#define CPPTRADER_MATCHING_MARKET_SCENARIO_H
+
+#include "market_manager.h"
+
+#include <string>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market scenario command type
+enum class ScenarioCommandType : uint8_t
+{
+    ENABLE_MATCHING,
+    DISABLE_MATCHING,
+    MATCH,
+    ADD_SYMBOL,
+    DELETE_SYMBOL,
+    ADD_BOOK,
+    DELETE_BOOK,
+    ADD_ORDER,
+    REDUCE_ORDER,
+    MODIFY_ORDER,
+    MITIGATE_ORDER,
+    REPLACE_ORDER,
+    DELETE_ORDER
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, ScenarioCommandType type);
+
+//! Market scenario command
+struct ScenarioCommand
+{
+    //! Command type
+    ScenarioCommandType Type;
+    //! Symbol to add (ADD_SYMBOL) or symbol Id (DELETE_SYMBOL, ADD_BOOK, DELETE_BOOK)
+    Matching::Symbol Symbol;
+    //! Order to add (ADD_ORDER) or order Id, new price and new quantity (other order commands)
+    Matching::Order Order;
+    //! New order Id (REPLACE_ORDER)
+    uint64_t NewId;
+
+    //! Apply the command to the given market manager
+    /*!
+        Order commands check the order existence before calling the market
+        manager, so orders which were already filled by the scenario do not
+        trigger its asserts.
+
+        \param market - Market manager
+        \return Error code
+    */
+    ErrorCode Apply(MarketManager& market) const;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const ScenarioCommand& command);
+};
+
+//! Market scenario
+/*!
+    Market scenario is a text script of market manager commands (see
+    tools/matching/scenario-*.txt) pre-parsed into a vector of binary
+    commands, so it could be replayed through the market manager many
+    times without any parsing costs. Scenario lines are parsed with a
+    single pass tokenizer without per-line allocations directly into the
+    command vector, which is reserved for all lines at once, so parsing of
+    multi-million line scenarios is mostly bound by the memory bandwidth.
+
+    Supported commands (empty lines and lines started with '#' are skipped):
+    \code
+    enable matching
+    disable matching
+    match
+    add symbol {Id} {Name}
+    delete symbol {Id}
+    add book {Id}
+    delete book {Id}
+    add market {Side} {Id} {SymbolId} {Quantity}
+    add slippage market {Side} {Id} {SymbolId} {Quantity} {Slippage}
+    add limit {Side} {Id} {SymbolId} {Price} {Quantity}
+    add ioc limit {Side} {Id} {SymbolId} {Price} {Quantity}
+    add fok limit {Side} {Id} {SymbolId} {Price} {Quantity}
+    add aon limit {Side} {Id} {SymbolId} {Price} {Quantity}
+    add stop {Side} {Id} {SymbolId} {StopPrice} {Quantity}
+    add stop-limit {Side} {Id} {SymbolId} {StopPrice} {Price} {Quantity}
+    add trailing stop {Side} {Id} {SymbolId} {StopPrice} {Quantity} {TrailingDistance} {TrailingStep}
+    add trailing stop-limit {Side} {Id} {SymbolId} {StopPrice} {Price} {Quantity} {TrailingDistance} {TrailingStep}
+    reduce order {Id} {Quantity}
+    modify order {Id} {NewPrice} {NewQuantity}
+    mitigate order {Id} {NewPrice} {NewQuantity}
+    replace order {Id} {NewId} {NewPrice} {NewQuantity}
+    delete order {Id}
+    \endcode
+
+    Side is 'buy' or 'sell'. Trailing distance and step could be negative
+    (percentages in 0.01% units).
+
+    Not thread-safe.
+*/
+class MarketScenario
+{
+public:
+    MarketScenario() : _lines(0), _error_line(0) {}
+    MarketScenario(const MarketScenario&) = delete;
+    MarketScenario(MarketScenario&&) = delete;
+    ~MarketScenario() = default;
+
+    MarketScenario& operator=(const MarketScenario&) = delete;
+    MarketScenario& operator=(MarketScenario&&) = delete;
+
+    //! Get the scenario commands
+    const std::vector<ScenarioCommand>& commands() const noexcept { return _commands; }
+    //! Get the count of parsed lines
+    size_t lines() const noexcept { return _lines; }
+
+    //! Get the line number of the last parse error (0 if there is no error)
+    size_t error_line() const noexcept { return _error_line; }
+    //! Get the last parse error message
+    const std::string& error() const noexcept { return _error; }
+
+    //! Parse the scenario text and append its commands
+    /*!
+        Parsing stops at the first malformed line.
+
+        \param text - Scenario text
+        \param size - Scenario text size
+        \return 'true' if the scenario was successfully parsed, 'false' in case of any error
+    */
+    bool Parse(const char* text, size_t size);
+    //! Parse the scenario text and append its commands
+    /*!
+        \param text - Scenario text
+        \return 'true' if the scenario was successfully parsed, 'false' in case of any error
+    */
+    bool Parse(const std::string& text) { return Parse(text.data(), text.size()); }
+    //! Load the scenario file and append its commands
+    /*!
+        \param path - Scenario file path
+        \return 'true' if the scenario was successfully loaded, 'false' in case of any error
+    */
+    bool Load(const std::string& path);
+
+    //! Replay all scenario commands through the given market manager
+    /*!
+        \param market - Market manager
+        \return Count of commands which returned errors
+    */
+    size_t Replay(MarketManager& market) const;
+
+    //! Clear the scenario
+    void Clear();
+
+private:
+    std::vector<ScenarioCommand> _commands;
+    size_t _lines;
+    size_t _error_line;
+    std::string _error;
+
+    bool ParseLine(const char* line, size_t size, ScenarioCommand& command, bool& skip);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_scenario.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_SCENARIO_H
@@ -0,0 +1,155 @@
+/*!
+    \file market_scenario.inl
+    \brief Market scenario inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, ScenarioCommandType type)
+{
+    switch (type)
+    {
+        case ScenarioCommandType::ENABLE_MATCHING:
+            stream << "ENABLE_MATCHING";
+            break;
+        case ScenarioCommandType::DISABLE_MATCHING:
+            stream << "DISABLE_MATCHING";
+            break;
+        case ScenarioCommandType::MATCH:
+            stream << "MATCH";
+            break;
+        case ScenarioCommandType::ADD_SYMBOL:
+            stream << "ADD_SYMBOL";
+            break;
+        case ScenarioCommandType::DELETE_SYMBOL:
+            stream << "DELETE_SYMBOL";
+            break;
+        case ScenarioCommandType::ADD_BOOK:
+            stream << "ADD_BOOK";
+            break;
+        case ScenarioCommandType::DELETE_BOOK:
+            stream << "DELETE_BOOK";
+            break;
+        case ScenarioCommandType::ADD_ORDER:
+            stream << "ADD_ORDER";
+            break;
+        case ScenarioCommandType::REDUCE_ORDER:
+            stream << "REDUCE_ORDER";
+            break;
+        case ScenarioCommandType::MODIFY_ORDER:
+            stream << "MODIFY_ORDER";
+            break;
+        case ScenarioCommandType::MITIGATE_ORDER:
+            stream << "MITIGATE_ORDER";
+            break;
+        case ScenarioCommandType::REPLACE_ORDER:
+            stream << "REPLACE_ORDER";
+            break;
+        case ScenarioCommandType::DELETE_ORDER:
+            stream << "DELETE_ORDER";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const ScenarioCommand& command)
+{
+    stream << "ScenarioCommand(Type=" << command.Type;
+    switch (command.Type)
+    {
+        case ScenarioCommandType::ADD_SYMBOL:
+        case ScenarioCommandType::DELETE_SYMBOL:
+        case ScenarioCommandType::ADD_BOOK:
+        case ScenarioCommandType::DELETE_BOOK:
+            stream << "; Symbol=" << command.Symbol;
+            break;
+        case ScenarioCommandType::ENABLE_MATCHING:
+        case ScenarioCommandType::DISABLE_MATCHING:
+        case ScenarioCommandType::MATCH:
+            break;
+        case ScenarioCommandType::REPLACE_ORDER:
+            stream << "; Order=" << command.Order
+                << "; NewId=" << command.NewId;
+            break;
+        default:
+            stream << "; Order=" << command.Order;
+            break;
+    }
+    stream << ")";
+    return stream;
+}
+
+inline ErrorCode ScenarioCommand::Apply(MarketManager& market) const
+{
+    switch (Type)
+    {
+        case ScenarioCommandType::ENABLE_MATCHING:
+            market.EnableMatching();
+            return ErrorCode::OK;
+        case ScenarioCommandType::DISABLE_MATCHING:
+            market.DisableMatching();
+            return ErrorCode::OK;
+        case ScenarioCommandType::MATCH:
+            market.Match();
+            return ErrorCode::OK;
+        case ScenarioCommandType::ADD_SYMBOL:
+            if (market.GetSymbol(Symbol.Id) != nullptr)
+                return ErrorCode::SYMBOL_DUPLICATE;
+            return market.AddSymbol(Symbol);
+        case ScenarioCommandType::DELETE_SYMBOL:
+            if (market.GetSymbol(Symbol.Id) == nullptr)
+                return ErrorCode::SYMBOL_NOT_FOUND;
+            return market.DeleteSymbol(Symbol.Id);
+        case ScenarioCommandType::ADD_BOOK:
+        {
+            const Matching::Symbol* symbol = market.GetSymbol(Symbol.Id);
+            if (symbol == nullptr)
+                return ErrorCode::SYMBOL_NOT_FOUND;
+            if (market.GetOrderBook(Symbol.Id) != nullptr)
+                return ErrorCode::ORDER_BOOK_DUPLICATE;
+            return market.AddOrderBook(*symbol);
+        }
+        case ScenarioCommandType::DELETE_BOOK:
+            if (market.GetOrderBook(Symbol.Id) == nullptr)
+                return ErrorCode::ORDER_BOOK_NOT_FOUND;
+            return market.DeleteOrderBook(Symbol.Id);
+        case ScenarioCommandType::ADD_ORDER:
+            return market.AddOrder(Order);
+        default:
+            break;
+    }
+
+    // Orders could be already filled by the scenario itself
+    if (market.GetOrder(Order.Id) == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    switch (Type)
+    {
+        case ScenarioCommandType::REDUCE_ORDER:
+            return market.ReduceOrder(Order.Id, Order.Quantity);
+        case ScenarioCommandType::MODIFY_ORDER:
+            return market.ModifyOrder(Order.Id, Order.Price, Order.Quantity);
+        case ScenarioCommandType::MITIGATE_ORDER:
+            return market.MitigateOrder(Order.Id, Order.Price, Order.Quantity);
+        case ScenarioCommandType::REPLACE_ORDER:
+            if (market.GetOrder(NewId) != nullptr)
+                return ErrorCode::ORDER_DUPLICATE;
+            return market.ReplaceOrder(Order.Id, NewId, Order.Price, Order.Quantity);
+        case ScenarioCommandType::DELETE_ORDER:
+            return market.DeleteOrder(Order.Id);
+        default:
+            return ErrorCode::ORDER_TYPE_INVALID;
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
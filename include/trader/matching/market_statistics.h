@@ -0,0 +1,156 @@
+/*!
+    \file market_statistics.h
+    \brief Market manager operation statistics definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_STATISTICS_H
+#define CPPTRADER_MATCHING_MARKET_STATISTICS_H
+
+#include "trader/statistics/latency_histogram.h"
+#include "trader/statistics/perf_counters.h"
+#include "trader/statistics/tsc_clock.h"
+
+#include "utility/iostream.h"
+
+#include <array>
+#include <sstream>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market manager operation
+enum class MarketOperation : uint8_t
+{
+    ADD_LIMIT,
+    ADD_MARKET,
+    ADD_STOP,
+    REDUCE,
+    MODIFY,
+    REPLACE,
+    CANCEL,
+    EXECUTE,
+    MATCH,
+    MATCH_ORDER,
+    ACTIVATE_STOP
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, MarketOperation operation);
+
+//! Get names of all market operations (e.g. for hardware performance counters profile regions)
+std::vector<std::string> MarketOperationNames();
+
+//! Market operation latency summary (nanoseconds)
+struct MarketOperationSummary
+{
+    //! Market operation
+    MarketOperation Operation;
+    //! Count of recorded operations
+    uint64_t Count;
+    //! Median latency
+    uint64_t P50;
+    //! 99th percentile latency
+    uint64_t P99;
+    //! 99.9th percentile latency
+    uint64_t P999;
+    //! Maximal latency
+    uint64_t Max;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketOperationSummary& summary);
+};
+
+//! Market manager operation statistics
+/*!
+    Market statistics keeps a latency histogram of each market operation.
+    Latencies are recorded in CPU ticks (see TscClock) and converted into
+    nanoseconds only in summaries, so recording costs two TSC reads and a
+    histogram increment.
+
+    Nested operations (e.g. matching triggered by a new limit order) are
+    recorded separately and also included into the outer operation latency.
+
+    MarketManager keeps the statistics only if the library is compiled with
+    CPPTRADER_STATISTICS definition (CMake option CPPTRADER_STATISTICS).
+
+    Not thread-safe.
+*/
+class MarketStatistics
+{
+public:
+    //! Count of market operations
+    static constexpr size_t OPERATIONS = (size_t)MarketOperation::ACTIVATE_STOP + 1;
+
+    MarketStatistics() = default;
+    MarketStatistics(const MarketStatistics&) = default;
+    MarketStatistics(MarketStatistics&&) = default;
+    ~MarketStatistics() = default;
+
+    MarketStatistics& operator=(const MarketStatistics&) = default;
+    MarketStatistics& operator=(MarketStatistics&&) = default;
+
+    //! Get the latency histogram (CPU ticks) of the given market operation
+    const Statistics::LatencyHistogram& histogram(MarketOperation operation) const noexcept { return _histograms[(size_t)operation]; }
+
+    //! Record the given latency of the market operation
+    /*!
+        \param operation - Market operation
+        \param ticks - Operation latency in CPU ticks
+    */
+    void Record(MarketOperation operation, uint64_t ticks) noexcept { _histograms[(size_t)operation].Record(ticks); }
+
+    //! Get the latency summary of the given market operation
+    /*!
+        \param operation - Market operation
+        \return Market operation latency summary in nanoseconds
+    */
+    MarketOperationSummary Summary(MarketOperation operation) const;
+
+    //! Reset all histograms
+    void Reset() noexcept;
+
+    //! Dump latency summaries of all recorded market operations
+    /*!
+        Each recorded operation is dumped into a separate line.
+
+        \param stream - Output stream
+    */
+    template <class TOutputStream>
+    void Dump(TOutputStream& stream) const;
+
+private:
+    std::array<Statistics::LatencyHistogram, OPERATIONS> _histograms;
+};
+
+//! Market operation scope timer
+/*!
+    Records the latency of the current scope into the given market statistics.
+*/
+class MarketOperationTimer
+{
+public:
+    MarketOperationTimer(MarketStatistics& statistics, MarketOperation operation) noexcept
+        : _statistics(statistics), _operation(operation), _start(Statistics::TscClock::ticks())
+    {}
+    MarketOperationTimer(const MarketOperationTimer&) = delete;
+    MarketOperationTimer(MarketOperationTimer&&) = delete;
+    ~MarketOperationTimer() noexcept { _statistics.Record(_operation, Statistics::TscClock::ticks() - _start); }
+
+    MarketOperationTimer& operator=(const MarketOperationTimer&) = delete;
+    MarketOperationTimer& operator=(MarketOperationTimer&&) = delete;
+
+private:
+    MarketStatistics& _statistics;
+    MarketOperation _operation;
+    uint64_t _start;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_statistics.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_STATISTICS_H
@@ -0,0 +1,111 @@
+/*!
+    \file market_statistics.inl
+    \brief Market manager operation statistics inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, MarketOperation operation)
+{
+    switch (operation)
+    {
+        case MarketOperation::ADD_LIMIT:
+            stream << "ADD_LIMIT";
+            break;
+        case MarketOperation::ADD_MARKET:
+            stream << "ADD_MARKET";
+            break;
+        case MarketOperation::ADD_STOP:
+            stream << "ADD_STOP";
+            break;
+        case MarketOperation::REDUCE:
+            stream << "REDUCE";
+            break;
+        case MarketOperation::MODIFY:
+            stream << "MODIFY";
+            break;
+        case MarketOperation::REPLACE:
+            stream << "REPLACE";
+            break;
+        case MarketOperation::CANCEL:
+            stream << "CANCEL";
+            break;
+        case MarketOperation::EXECUTE:
+            stream << "EXECUTE";
+            break;
+        case MarketOperation::MATCH:
+            stream << "MATCH";
+            break;
+        case MarketOperation::MATCH_ORDER:
+            stream << "MATCH_ORDER";
+            break;
+        case MarketOperation::ACTIVATE_STOP:
+            stream << "ACTIVATE_STOP";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+inline std::vector<std::string> MarketOperationNames()
+{
+    std::vector<std::string> names;
+    for (size_t i = 0; i < MarketStatistics::OPERATIONS; ++i)
+    {
+        std::ostringstream name;
+        name << (MarketOperation)i;
+        names.push_back(name.str());
+    }
+    return names;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketOperationSummary& summary)
+{
+    stream << "MarketOperationSummary(Operation=" << summary.Operation
+        << "; Count=" << summary.Count
+        << "; P50=" << summary.P50
+        << "; P99=" << summary.P99
+        << "; P99.9=" << summary.P999
+        << "; Max=" << summary.Max
+        << ")";
+    return stream;
+}
+
+inline MarketOperationSummary MarketStatistics::Summary(MarketOperation operation) const
+{
+    const Statistics::LatencyHistogram& latency = histogram(operation);
+
+    MarketOperationSummary summary;
+    summary.Operation = operation;
+    summary.Count = latency.count();
+    summary.P50 = Statistics::TscClock::ToNanoseconds(latency.Percentile(50.0));
+    summary.P99 = Statistics::TscClock::ToNanoseconds(latency.Percentile(99.0));
+    summary.P999 = Statistics::TscClock::ToNanoseconds(latency.Percentile(99.9));
+    summary.Max = Statistics::TscClock::ToNanoseconds(latency.max());
+    return summary;
+}
+
+inline void MarketStatistics::Reset() noexcept
+{
+    for (auto& latency : _histograms)
+        latency.Reset();
+}
+
+template <class TOutputStream>
+inline void MarketStatistics::Dump(TOutputStream& stream) const
+{
+    for (size_t i = 0; i < OPERATIONS; ++i)
+        if (!_histograms[i].empty())
+            stream << Summary((MarketOperation)i) << std::endl;
+}
+
+} // namespace Matching
+} // namespace CppTrader
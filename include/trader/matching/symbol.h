@@ -10,10 +10,11 @@
 #define CPPTRADER_MATCHING_SYMBOL_H
 
 #include "utility/iostream.h"
-#include "trader/redis_db.h"
 
 #include <cstdint>
 #include <cstring>
+#include <string>
+#include <unordered_map>
 
 namespace CppTrader {
 namespace Matching {
@@ -57,8 +58,14 @@ struct Symbol
     template <class TOutputStream>
     friend TOutputStream& operator<<(TOutputStream& stream, const Symbol& symbol);
     static bool IsInverse(SymbolType type) noexcept;
-    Symbol GetSymbolById(uint32_t id) noexcept;
     Symbol ReadDbStructure(std::unordered_map<std::string, std::string> data) noexcept;
+    //! Parse the symbol from the Redis hash fields
+    /*!
+        \param data - Symbol hash fields (Id, Name, Type and optional Multiplier and QuantityDivisor)
+        \param symbol - Parsed symbol
+        \return 'true' if the symbol was parsed, 'false' if required fields are missing or malformed (including unknown types)
+    */
+    static bool Parse(const std::unordered_map<std::string, std::string>& data, Symbol& symbol) noexcept;
 };
 
 } // namespace Matching
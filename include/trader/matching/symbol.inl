@@ -6,7 +6,8 @@
     \copyright MIT License
 */
 
-
+#include <algorithm>
+#include <charconv>
 
 namespace CppTrader {
 namespace Matching {
@@ -35,29 +36,49 @@ inline bool Symbol::IsInverse(SymbolType type) noexcept
     return (uint32_t)type >= 10;
 }
 
-inline Symbol Symbol::GetSymbolById(uint32_t id) noexcept
+inline Symbol Symbol::ReadDbStructure(std::unordered_map<std::string, std::string> data) noexcept
 {
-    std::string key = "symbol:";
-    key += std::to_string(id);
     Symbol symbol = Symbol();
-    MyRedis _redis = MyRedis();
-
-    std::unordered_map<std::string, std::string> data = _redis._hgetall_db(key);
-    symbol = symbol.ReadDbStructure(data);
+    Parse(data, symbol);
     return symbol;
 }
 
-inline Symbol Symbol::ReadDbStructure(std::unordered_map<std::string, std::string> data) noexcept
+inline bool Symbol::Parse(const std::unordered_map<std::string, std::string>& data, Symbol& symbol) noexcept
 {
-    if (data.empty())
+    auto field = [&data](const char* name, auto& value)
     {
-        return Symbol();
-    }
-    SymbolType type = SymbolType(std::stoi(data["Type"]));
-    Symbol symbol = Symbol(std::stoul(data["Id"]), 
-                           data["Name"].c_str(),
-                           type);
-    return symbol;
+        auto it = data.find(name);
+        if (it == data.end())
+            return false;
+        const char* last = it->second.data() + it->second.size();
+        auto result = std::from_chars(it->second.data(), last, value);
+        return (result.ec == std::errc()) && (result.ptr == last);
+    };
+
+    auto name = data.find("Name");
+    uint32_t id;
+    uint32_t type;
+    if ((name == data.end()) || !field("Id", id) || !field("Type", type))
+        return false;
+
+    // Type should be one of the symbol type enumerators
+    if ((type > (uint32_t)SymbolType::OPTIONVANILLAFUT) && ((type < (uint32_t)SymbolType::INVERSEPERP) || (type > (uint32_t)SymbolType::OPTIONINVERSEFUT)))
+        return false;
+
+    // Optional fields keep the default values of the symbol constructor
+    uint64_t multiplier = 1;
+    uint64_t divisor = 100;
+    if ((data.count("Multiplier") > 0) && !field("Multiplier", multiplier))
+        return false;
+    if ((data.count("QuantityDivisor") > 0) && !field("QuantityDivisor", divisor))
+        return false;
+
+    // Name is padded with zeros up to the fixed size
+    char buffer[sizeof(Symbol::Name)] = {};
+    std::memcpy(buffer, name->second.data(), std::min(name->second.size(), sizeof(buffer)));
+
+    symbol = Symbol(id, buffer, SymbolType(type), multiplier, divisor);
+    return true;
 }
 
 } // namespace Matching
@@ -0,0 +1,160 @@
+/*!
+    \file symbol_registry.h
+    \brief Symbol registry definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_SYMBOL_REGISTRY_H
+#define CPPTRADER_MATCHING_SYMBOL_REGISTRY_H
+
+#include "symbol.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class MyRedis;
+
+namespace CppTrader {
+namespace Matching {
+
+//! Symbol registry
+/*!
+    Symbol registry keeps symbols loaded from the Redis 'symbol:<Id>' hashes
+    in the dense array indexed by the symbol Id, so lookups never touch
+    the network or parse strings.
+
+    All hashes are bulk-loaded with Load() over the shared connection of
+    the registry (SCAN and a single pipelined HGETALL round trip). Started
+    registry listens to keyspace notifications of symbol hashes on its own
+    thread, fetches changed hashes and queues them, and the owner applies
+    queued changes with Update() without blocking (there is a single atomic
+    check when nothing is queued). Changes of the same symbol queued before
+    the update are coalesced, so only the latest one is applied. After each
+    (re)subscription all hashes are fetched again, so changes made before
+    the subscription are not lost. Redis server should publish keyspace
+    notifications of hash and generic commands ('notify-keyspace-events'
+    includes 'Khg').
+
+    Registry is owned by a single thread: Load(), Start(), Stop(), lookups
+    and Update() should be called from it. Only Push() and Remove() are
+    thread-safe.
+*/
+class SymbolRegistry
+{
+public:
+    SymbolRegistry();
+    SymbolRegistry(const SymbolRegistry&) = delete;
+    SymbolRegistry(SymbolRegistry&&) = delete;
+    ~SymbolRegistry();
+
+    SymbolRegistry& operator=(const SymbolRegistry&) = delete;
+    SymbolRegistry& operator=(SymbolRegistry&&) = delete;
+
+    //! Is the symbol registry empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Get the count of symbols
+    size_t size() const noexcept { return _size; }
+
+    //! Get the symbol with the given Id
+    /*!
+        \param id - Symbol Id
+        \return Pointer to the symbol or nullptr if the symbol is not found
+    */
+    const Symbol* GetSymbol(uint32_t id) const noexcept;
+
+    //! Visit all symbols in the order of their Ids
+    /*!
+        \param handler - Symbol handler
+    */
+    template <typename THandler>
+    void ForEachSymbol(THandler&& handler) const;
+
+    //! Bulk-load all symbol hashes
+    /*!
+        \return Count of loaded symbols
+    */
+    size_t Load();
+
+    //! Is the notifications thread started?
+    bool IsStarted() const noexcept { return _thread.joinable(); }
+
+    //! Start listening to symbol changes
+    bool Start();
+    //! Stop listening to symbol changes
+    bool Stop();
+
+    //! Queue the symbol update (thread-safe)
+    /*!
+        \param symbol - Added or modified symbol
+    */
+    void Push(const Symbol& symbol);
+    //! Queue the symbol removal (thread-safe)
+    /*!
+        \param id - Removed symbol Id
+    */
+    void Remove(uint32_t id);
+
+    //! Apply queued symbol changes
+    /*!
+        \return Count of applied changes
+    */
+    size_t Update() { return Update([](uint32_t, const Symbol*) {}); }
+    //! Apply queued symbol changes and handle each applied one
+    /*!
+        \param handler - Change handler called with the symbol Id and the new symbol (nullptr if the symbol was removed)
+        \return Count of applied changes
+    */
+    template <typename THandler>
+    size_t Update(THandler&& handler);
+
+private:
+    // Symbol slot
+    struct Slot
+    {
+        Symbol Data;
+        bool Exists;
+
+        Slot() noexcept : Data(), Exists(false) {}
+    };
+
+    // Queued symbol change
+    struct Change
+    {
+        uint32_t Id;
+        bool Removed;
+        Symbol Data;
+    };
+
+    std::unique_ptr<MyRedis> _redis;
+    std::vector<Slot> _symbols;
+    size_t _size{0};
+
+    std::thread _thread;
+    std::atomic<bool> _stop{false};
+    std::mutex _mutex;
+    std::atomic<bool> _pending{false};
+    std::vector<Change> _changes;
+    std::vector<Change> _applied;
+    std::unordered_map<uint32_t, size_t> _queued;
+
+    bool Apply(const Change& change);
+    void Queue(const Change& change);
+    void Queue(std::vector<Change>& changes);
+    void Fetch(std::vector<Change>& changes, const std::vector<std::string>& keys);
+    void Notify(const std::string& channel, const std::string& event);
+    void Run();
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "symbol_registry.inl"
+
+#endif // CPPTRADER_MATCHING_SYMBOL_REGISTRY_H
@@ -0,0 +1,77 @@
+/*!
+    \file symbol_registry.inl
+    \brief Symbol registry inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline const Symbol* SymbolRegistry::GetSymbol(uint32_t id) const noexcept
+{
+    if ((id >= _symbols.size()) || !_symbols[id].Exists)
+        return nullptr;
+    return &_symbols[id].Data;
+}
+
+template <typename THandler>
+inline void SymbolRegistry::ForEachSymbol(THandler&& handler) const
+{
+    for (const auto& slot : _symbols)
+        if (slot.Exists)
+            handler(slot.Data);
+}
+
+template <typename THandler>
+inline size_t SymbolRegistry::Update(THandler&& handler)
+{
+    if (!_pending.load(std::memory_order_acquire))
+        return 0;
+
+    {
+        std::scoped_lock locker(_mutex);
+        std::swap(_changes, _applied);
+        _queued.clear();
+        _pending.store(false, std::memory_order_relaxed);
+    }
+
+    size_t count = 0;
+    for (const auto& change : _applied)
+    {
+        if (Apply(change))
+        {
+            handler(change.Id, GetSymbol(change.Id));
+            ++count;
+        }
+    }
+    _applied.clear();
+    return count;
+}
+
+inline bool SymbolRegistry::Apply(const Change& change)
+{
+    if (change.Removed)
+    {
+        if ((change.Id >= _symbols.size()) || !_symbols[change.Id].Exists)
+            return false;
+        _symbols[change.Id].Exists = false;
+        --_size;
+        return true;
+    }
+
+    if (change.Id >= _symbols.size())
+        _symbols.resize(change.Id + 1);
+    Slot& slot = _symbols[change.Id];
+    if (!slot.Exists)
+    {
+        slot.Exists = true;
+        ++_size;
+    }
+    slot.Data = change.Data;
+    return true;
+}
+
+} // namespace Matching
+} // namespace CppTrader
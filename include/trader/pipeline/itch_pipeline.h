@@ -0,0 +1,240 @@
+/*!
+    \file itch_pipeline.h
+    \brief NASDAQ ITCH processing pipeline definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_PIPELINE_ITCH_PIPELINE_H
+#define CPPTRADER_PIPELINE_ITCH_PIPELINE_H
+
+#include "trader/matching/market_manager.h"
+#include "trader/replay/event.h"
+#include "trader/statistics/latency_histogram.h"
+
+#include "filesystem/file.h"
+
+#include <atomic>
+#include <vector>
+
+namespace CppTrader {
+
+/*!
+    \namespace CppTrader::Pipeline
+    \brief Multi-threaded processing pipeline definitions
+*/
+namespace Pipeline {
+
+//! Pipeline queue wait policy
+enum class WaitPolicy : uint8_t
+{
+    BUSY_POLL,
+    BACKOFF
+};
+
+//! Pipeline input format
+enum class InputFormat : uint8_t
+{
+    ITCH,
+    PCAP
+};
+
+//! Pipeline settings
+struct PipelineSettings
+{
+    //! Input format (length prefixed ITCH stream or pcap/pcapng capture of MoldUDP64 packets)
+    InputFormat Format;
+    //! UDP destination port filter for pcap input (0 - any port)
+    uint16_t Port;
+    //! Input chunk size in bytes
+    size_t ChunkSize;
+    //! Count of input chunks in flight (power of two)
+    size_t Chunks;
+    //! Parser to book builder queue capacity (power of two)
+    size_t EventsQueue;
+    //! Book builder to consumer queue capacity (power of two)
+    size_t UpdatesQueue;
+    //! Count of consumer threads
+    size_t Consumers;
+    //! Queue wait policy
+    WaitPolicy Wait;
+    //! Reader thread CPU core (-1 - not pinned)
+    int ReaderCore;
+    //! Parser thread CPU core (-1 - not pinned)
+    int ParserCore;
+    //! Book builder thread CPU core (-1 - not pinned)
+    int BookCore;
+    //! Consumer threads CPU cores (-1 or missing - not pinned)
+    std::vector<int> ConsumerCores;
+
+    PipelineSettings() noexcept;
+};
+
+//! Pipeline stage statistics
+struct PipelineStage
+{
+    //! Count of processed items
+    uint64_t Items;
+    //! Count of waits for the full output queue
+    uint64_t Stalls;
+    //! Time in nanoseconds the item spent in the input queue
+    Statistics::LatencyHistogram Queueing;
+    //! Time in nanoseconds spent on the item processing
+    Statistics::LatencyHistogram Service;
+
+    PipelineStage() noexcept : Items(0), Stalls(0) {}
+};
+
+//! Order book update
+struct BookUpdate
+{
+    //! Applied market event
+    Replay::Event Event;
+    //! Best bid price (0 if there is no bids)
+    uint64_t BidPrice;
+    //! Best bid visible volume
+    uint64_t BidVolume;
+    //! Best ask price (0 if there is no asks)
+    uint64_t AskPrice;
+    //! Best ask visible volume
+    uint64_t AskVolume;
+};
+
+//! NASDAQ ITCH processing pipeline
+/*!
+    ITCH pipeline overlaps I/O, decoding and order book maintenance
+    on several threads linked with bounded lock-free SPSC ring queues:
+
+    \li <b>Reader</b> - reads the input into recycled fixed size chunks
+    \li <b>Parser</b> - decodes ITCH messages into normalized market events
+    \li <b>Book builder</b> - applies events to the market manager
+    \li <b>Consumers</b> - receive every book update with onUpdate() handler
+
+    All queues apply backpressure, so memory usage is bounded by the
+    settings. Each stage records its queueing and service latency
+    histograms.
+
+    Market handler of the market manager is called from the book builder
+    thread, onUpdate() handler is called from the corresponding consumer
+    thread.
+
+    Not thread-safe.
+*/
+class ITCHPipeline
+{
+public:
+    //! Initialize ITCH pipeline with a given market manager
+    /*!
+        \param market - Market manager to maintain
+        \param settings - Pipeline settings (default is PipelineSettings())
+    */
+    explicit ITCHPipeline(Matching::MarketManager& market, const PipelineSettings& settings = PipelineSettings());
+    ITCHPipeline(const ITCHPipeline&) = delete;
+    ITCHPipeline(ITCHPipeline&&) = delete;
+    virtual ~ITCHPipeline() = default;
+
+    ITCHPipeline& operator=(const ITCHPipeline&) = delete;
+    ITCHPipeline& operator=(ITCHPipeline&&) = delete;
+
+    //! Get the pipeline settings
+    const PipelineSettings& settings() const noexcept { return _settings; }
+
+    //! Get the reader stage statistics
+    const PipelineStage& reader() const noexcept { return _reader; }
+    //! Get the parser stage statistics
+    const PipelineStage& parser() const noexcept { return _parser; }
+    //! Get the book builder stage statistics
+    const PipelineStage& book() const noexcept { return _book; }
+    //! Get the consumer stage statistics
+    const PipelineStage& consumer(size_t index) const noexcept { return _consumers[index]; }
+
+    //! Get the count of read bytes
+    uint64_t bytes() const noexcept { return _bytes; }
+    //! Get the count of decoded ITCH messages
+    uint64_t messages() const noexcept { return _messages; }
+    //! Get the count of unknown ITCH messages and failed market events
+    uint64_t errors() const noexcept { return _errors; }
+
+    //! Run the pipeline over the given input until it is exhausted
+    /*!
+        \param input - Input reader
+        \return 'true' if the input was successfully processed, 'false' if the input process was failed
+    */
+    bool Run(CppCommon::Reader& input);
+    //! Run the pipeline over the given memory buffer (e.g. memory-mapped file)
+    /*!
+        Input chunks point directly into the given buffer without copying.
+
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the buffer was successfully processed, 'false' if the buffer process was failed
+    */
+    bool Run(const void* buffer, size_t size);
+
+protected:
+    // Consumer handlers
+    virtual void onUpdate(size_t consumer, const BookUpdate& update) {}
+
+private:
+    struct Chunk
+    {
+        const uint8_t* Data;
+        size_t Size;
+        size_t Slot;
+        uint64_t Timestamp;
+    };
+
+    struct EventItem
+    {
+        Replay::Event Event;
+        uint64_t Timestamp;
+    };
+
+    struct UpdateItem
+    {
+        BookUpdate Update;
+        uint64_t Timestamp;
+    };
+
+    class Queues;
+    class Converter;
+
+    Matching::MarketManager& _market;
+    PipelineSettings _settings;
+
+    PipelineStage _reader;
+    PipelineStage _parser;
+    PipelineStage _book;
+    std::vector<PipelineStage> _consumers;
+
+    uint64_t _bytes;
+    uint64_t _messages;
+    uint64_t _errors;
+    uint64_t _parser_errors;
+    uint64_t _book_errors;
+
+    std::atomic<bool> _failed;
+
+    bool Run(CppCommon::Reader* input, const uint8_t* buffer, size_t size);
+
+    void ReaderThread(Queues& queues, CppCommon::Reader* input, const uint8_t* buffer, size_t size);
+    void ParserThread(Queues& queues);
+    void BookThread(Queues& queues);
+    void ConsumerThread(Queues& queues, size_t index);
+
+    template <class TQueue, typename T>
+    void Push(TQueue& queue, T& item, PipelineStage& stage);
+    template <class TQueue, typename T>
+    bool Pop(TQueue& queue, T& item, const std::atomic<bool>& done);
+
+    void Wait(size_t& spins) const;
+    static void Pin(int core);
+};
+
+} // namespace Pipeline
+} // namespace CppTrader
+
+#include "itch_pipeline.inl"
+
+#endif // CPPTRADER_PIPELINE_ITCH_PIPELINE_H
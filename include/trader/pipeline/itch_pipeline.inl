@@ -0,0 +1,38 @@
+/*!
+    \file itch_pipeline.inl
+    \brief NASDAQ ITCH processing pipeline inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Pipeline {
+
+inline PipelineSettings::PipelineSettings() noexcept
+    : Format(InputFormat::ITCH),
+      Port(0),
+      ChunkSize(65536),
+      Chunks(64),
+      EventsQueue(65536),
+      UpdatesQueue(65536),
+      Consumers(1),
+      Wait(WaitPolicy::BACKOFF),
+      ReaderCore(-1),
+      ParserCore(-1),
+      BookCore(-1)
+{
+}
+
+inline bool ITCHPipeline::Run(CppCommon::Reader& input)
+{
+    return Run(&input, nullptr, 0);
+}
+
+inline bool ITCHPipeline::Run(const void* buffer, size_t size)
+{
+    return Run(nullptr, (const uint8_t*)buffer, size);
+}
+
+} // namespace Pipeline
+} // namespace CppTrader
@@ -0,0 +1,168 @@
+/*!
+    \file itch_batch.h
+    \brief NASDAQ ITCH message batch definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_BATCH_H
+#define CPPTRADER_ITCH_BATCH_H
+
+#include "itch_handler.h"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! Add order messages columns ('A' and 'F' messages)
+struct AddOrderBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OrderReferenceNumber;
+    std::vector<char> BuySellIndicator;
+    std::vector<uint32_t> Shares;
+    std::vector<std::array<char, 8>> Stock;
+    std::vector<uint32_t> Price;
+    //! MPID attribution ('\0' for 'A' messages)
+    std::vector<char> Attribution;
+};
+
+//! Order executed messages columns ('E' and 'C' messages)
+struct OrderExecutedBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OrderReferenceNumber;
+    std::vector<uint32_t> ExecutedShares;
+    std::vector<uint64_t> MatchNumber;
+    //! Printable flag ('\0' for 'E' messages)
+    std::vector<char> Printable;
+    //! Execution price (0 for 'E' messages executed at the order price)
+    std::vector<uint32_t> ExecutionPrice;
+};
+
+//! Order cancel messages columns ('X' messages)
+struct OrderCancelBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OrderReferenceNumber;
+    std::vector<uint32_t> CanceledShares;
+};
+
+//! Order delete messages columns ('D' messages)
+struct OrderDeleteBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OrderReferenceNumber;
+};
+
+//! Order replace messages columns ('U' messages)
+struct OrderReplaceBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OriginalOrderReferenceNumber;
+    std::vector<uint64_t> NewOrderReferenceNumber;
+    std::vector<uint32_t> Shares;
+    std::vector<uint32_t> Price;
+};
+
+//! Trade messages columns ('P' messages)
+struct TradeBatch
+{
+    size_t Count;
+    std::vector<uint16_t> StockLocate;
+    std::vector<uint64_t> Timestamp;
+    std::vector<uint64_t> OrderReferenceNumber;
+    std::vector<char> BuySellIndicator;
+    std::vector<uint32_t> Shares;
+    std::vector<std::array<char, 8>> Stock;
+    std::vector<uint32_t> Price;
+    std::vector<uint64_t> MatchNumber;
+};
+
+//! NASDAQ ITCH message batch
+/*!
+    Message batch is a preallocated struct-of-arrays arena filled with
+    ITCHHandler::Decode(). Messages are grouped by their type into column
+    groups, so consumers could process adds, executes, cancels, etc. in
+    tight type-homogeneous loops. The original messages order is kept in
+    the tags columns (message type and index in its group).
+
+    Messages of other types are only tagged with NONE index.
+
+    Batch never reallocates after construction.
+
+    Not thread-safe.
+*/
+struct MessageBatch
+{
+    //! Tag index of messages without column group
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    //! Message type tags in the original order
+    std::vector<char> Types;
+    //! Message index in its column group in the original order
+    std::vector<uint32_t> Indexes;
+
+    AddOrderBatch AddOrders;
+    OrderExecutedBatch OrderExecutions;
+    OrderCancelBatch OrderCancels;
+    OrderDeleteBatch OrderDeletes;
+    OrderReplaceBatch OrderReplaces;
+    TradeBatch Trades;
+
+    //! Count of messages without column group
+    size_t Others;
+    //! Count of skipped messages with invalid size
+    size_t Errors;
+
+    //! Initialize message batch with a given capacity
+    /*!
+        \param capacity - Maximal count of messages in the batch (default is 4096)
+    */
+    explicit MessageBatch(size_t capacity = 4096);
+    MessageBatch(const MessageBatch&) = delete;
+    MessageBatch(MessageBatch&&) = default;
+    ~MessageBatch() = default;
+
+    MessageBatch& operator=(const MessageBatch&) = delete;
+    MessageBatch& operator=(MessageBatch&&) = default;
+
+    //! Get the batch capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the count of messages in the batch
+    size_t size() const noexcept { return _size; }
+    //! Is the batch empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Is the batch full?
+    bool full() const noexcept { return _size >= _capacity; }
+
+    //! Clear the batch (no memory is released)
+    void Clear() noexcept;
+
+private:
+    friend class ITCHHandler;
+
+    size_t _capacity;
+    size_t _size;
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "itch_batch.inl"
+
+#endif // CPPTRADER_ITCH_BATCH_H
@@ -0,0 +1,79 @@
+/*!
+    \file itch_batch.inl
+    \brief NASDAQ ITCH message batch inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+inline MessageBatch::MessageBatch(size_t capacity)
+    : Types(capacity),
+      Indexes(capacity),
+      Others(0),
+      Errors(0),
+      _capacity(capacity),
+      _size(0)
+{
+    AddOrders.StockLocate.resize(capacity);
+    AddOrders.Timestamp.resize(capacity);
+    AddOrders.OrderReferenceNumber.resize(capacity);
+    AddOrders.BuySellIndicator.resize(capacity);
+    AddOrders.Shares.resize(capacity);
+    AddOrders.Stock.resize(capacity);
+    AddOrders.Price.resize(capacity);
+    AddOrders.Attribution.resize(capacity);
+
+    OrderExecutions.StockLocate.resize(capacity);
+    OrderExecutions.Timestamp.resize(capacity);
+    OrderExecutions.OrderReferenceNumber.resize(capacity);
+    OrderExecutions.ExecutedShares.resize(capacity);
+    OrderExecutions.MatchNumber.resize(capacity);
+    OrderExecutions.Printable.resize(capacity);
+    OrderExecutions.ExecutionPrice.resize(capacity);
+
+    OrderCancels.StockLocate.resize(capacity);
+    OrderCancels.Timestamp.resize(capacity);
+    OrderCancels.OrderReferenceNumber.resize(capacity);
+    OrderCancels.CanceledShares.resize(capacity);
+
+    OrderDeletes.StockLocate.resize(capacity);
+    OrderDeletes.Timestamp.resize(capacity);
+    OrderDeletes.OrderReferenceNumber.resize(capacity);
+
+    OrderReplaces.StockLocate.resize(capacity);
+    OrderReplaces.Timestamp.resize(capacity);
+    OrderReplaces.OriginalOrderReferenceNumber.resize(capacity);
+    OrderReplaces.NewOrderReferenceNumber.resize(capacity);
+    OrderReplaces.Shares.resize(capacity);
+    OrderReplaces.Price.resize(capacity);
+
+    Trades.StockLocate.resize(capacity);
+    Trades.Timestamp.resize(capacity);
+    Trades.OrderReferenceNumber.resize(capacity);
+    Trades.BuySellIndicator.resize(capacity);
+    Trades.Shares.resize(capacity);
+    Trades.Stock.resize(capacity);
+    Trades.Price.resize(capacity);
+    Trades.MatchNumber.resize(capacity);
+
+    Clear();
+}
+
+inline void MessageBatch::Clear() noexcept
+{
+    AddOrders.Count = 0;
+    OrderExecutions.Count = 0;
+    OrderCancels.Count = 0;
+    OrderDeletes.Count = 0;
+    OrderReplaces.Count = 0;
+    Trades.Count = 0;
+    Others = 0;
+    Errors = 0;
+    _size = 0;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -12,6 +12,10 @@
 #include "utility/endian.h"
 #include "utility/iostream.h"
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+#include "trader/statistics/perf_counters.h"
+#endif
+
 #include <vector>
 
 namespace CppTrader {
@@ -384,6 +388,8 @@ struct UnknownMessage
 
     Not thread-safe.
 */
+struct MessageBatch;
+
 class ITCHHandler
 {
 public:
@@ -410,9 +416,29 @@ public:
     */
     bool ProcessMessage(void* buffer, size_t size);
 
+    //! Decode messages from the given buffer in ITCH format into the given message batch
+    /*!
+        Decode complete length-prefixed messages until the batch is full or
+        the buffer is exhausted. No message handlers are called and no state
+        of the ITCH handler is changed, so the incomplete message at the end
+        of the buffer should be passed again with the next buffer.
+
+        \param buffer - Buffer to decode
+        \param size - Buffer size
+        \param batch - Message batch to append decoded messages
+        \return Count of consumed bytes from the given buffer
+    */
+    size_t Decode(const void* buffer, size_t size, MessageBatch& batch);
+
     //! Reset ITCH handler
     void Reset();
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+    //! Get the hardware performance counters profile of ProcessMessage() (single region)
+    Statistics::PerfProfile& perf_profile() noexcept { return _perf_profile; }
+    const Statistics::PerfProfile& perf_profile() const noexcept { return _perf_profile; }
+#endif
+
 protected:
     // Message handlers
     virtual bool onMessage(const SystemEventMessage& message) { return true; }
@@ -442,6 +468,10 @@ private:
     size_t _size;
     std::vector<uint8_t> _cache;
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+    Statistics::PerfProfile _perf_profile{ std::vector<std::string>{ "PROCESS_MESSAGE" } };
+#endif
+
     bool ProcessSystemEventMessage(void* buffer, size_t size);
     bool ProcessStockDirectoryMessage(void* buffer, size_t size);
     bool ProcessStockTradingActionMessage(void* buffer, size_t size);
@@ -345,29 +345,14 @@ inline size_t ITCHHandler::ReadString(const void* buffer, char (&str)[N])
 
 inline size_t ITCHHandler::ReadTimestamp(const void* buffer, uint64_t& value)
 {
-    if (CppCommon::Endian::IsBigEndian())
-    {
-        ((uint8_t*)&value)[0] = 0;
-        ((uint8_t*)&value)[1] = 0;
-        ((uint8_t*)&value)[2] = 0;
-        ((uint8_t*)&value)[3] = 0;
-        ((uint8_t*)&value)[4] = 0;
-        ((uint8_t*)&value)[5] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[6] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[7] = ((const uint8_t*)buffer)[2];
-    }
-    else
-    {
-        ((uint8_t*)&value)[0] = ((const uint8_t*)buffer)[2];
-        ((uint8_t*)&value)[1] = ((const uint8_t*)buffer)[1];
-        ((uint8_t*)&value)[2] = ((const uint8_t*)buffer)[0];
-        ((uint8_t*)&value)[3] = 0;
-        ((uint8_t*)&value)[4] = 0;
-        ((uint8_t*)&value)[5] = 0;
-        ((uint8_t*)&value)[6] = 0;
-        ((uint8_t*)&value)[7] = 0;
-
-    }
+    // 6 bytes big-endian nanoseconds since midnight
+    const uint8_t* data = (const uint8_t*)buffer;
+    value = ((uint64_t)data[0] << 40) |
+            ((uint64_t)data[1] << 32) |
+            ((uint64_t)data[2] << 24) |
+            ((uint64_t)data[3] << 16) |
+            ((uint64_t)data[4] << 8) |
+            ((uint64_t)data[5]);
 
     return 6;
 }
@@ -0,0 +1,194 @@
+/*!
+    \file itch_index.h
+    \brief NASDAQ ITCH time index definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_INDEX_H
+#define CPPTRADER_ITCH_INDEX_H
+
+#include "itch_handler.h"
+
+#include "trader/matching/market_manager.h"
+#include "trader/replay/event.h"
+
+#include "filesystem/path.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! ITCH time index entry
+struct ITCHIndexEntry
+{
+    //! Checkpoint timestamp in nanoseconds (all previous messages are older)
+    uint64_t Timestamp;
+    //! Byte offset of the first message after the checkpoint
+    uint64_t Offset;
+    //! Count of messages before the checkpoint
+    uint64_t Messages;
+    //! Index of the first book snapshot event
+    uint64_t SnapshotOffset;
+    //! Count of book snapshot events (0 if snapshots are disabled)
+    uint64_t SnapshotSize;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const ITCHIndexEntry& entry);
+};
+
+//! ITCH time index
+/*!
+    ITCH time index keeps checkpoints of the ITCH file taken every
+    interval of ITCH message timestamps. Each checkpoint contains the byte
+    offset and the messages count of the first message after the checkpoint
+    and optionally a snapshot of limit order books at this point stored as
+    normalized market events.
+
+    Replay of a time window starts with Seek() to find the checkpoint,
+    Restore() to rebuild the market manager from the book snapshot, then
+    the ITCH file is positioned to the checkpoint offset and processed
+    with a reset ITCH handler.
+
+    Not thread-safe.
+*/
+class ITCHIndex
+{
+    friend class ITCHIndexBuilder;
+
+public:
+    //! Index entries container
+    typedef std::vector<ITCHIndexEntry> Entries;
+    //! Book snapshots container
+    typedef std::vector<Replay::Event> Snapshots;
+
+    ITCHIndex() : _interval(0) {}
+    ITCHIndex(const ITCHIndex&) = delete;
+    ITCHIndex(ITCHIndex&&) = delete;
+    ~ITCHIndex() = default;
+
+    ITCHIndex& operator=(const ITCHIndex&) = delete;
+    ITCHIndex& operator=(ITCHIndex&&) = delete;
+
+    //! Check if the index is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the index empty?
+    bool empty() const noexcept { return _entries.empty(); }
+
+    //! Get the checkpoints interval in nanoseconds
+    uint64_t interval() const noexcept { return _interval; }
+    //! Get the index entries container
+    const Entries& entries() const noexcept { return _entries; }
+    //! Get the book snapshots container
+    const Snapshots& snapshots() const noexcept { return _snapshots; }
+
+    //! Seek the last checkpoint which is not later than the given timestamp
+    /*!
+        \param timestamp - Timestamp in nanoseconds
+        \return Pointer to the found index entry or nullptr if the index is empty
+    */
+    const ITCHIndexEntry* Seek(uint64_t timestamp) const noexcept;
+
+    //! Restore the given market manager from the book snapshot of the given index entry
+    /*!
+        Market manager should be empty. Symbols and order books are added,
+        then all limit orders are added in their price-time priority.
+
+        \param entry - Index entry
+        \param market - Market manager to restore
+        \return 'true' if the market manager was successfully restored, 'false' if the entry has no book snapshot or some snapshot events failed
+    */
+    bool Restore(const ITCHIndexEntry& entry, Matching::MarketManager& market) const;
+
+    //! Save the index into the given file
+    /*!
+        \param path - Index file path
+    */
+    void Save(const CppCommon::Path& path) const;
+    //! Load the index from the given file
+    /*!
+        \param path - Index file path
+        \return 'true' if the index was successfully loaded, 'false' if the index file has invalid format
+    */
+    bool Load(const CppCommon::Path& path);
+
+    //! Clear the index
+    void Clear();
+
+private:
+    uint64_t _interval;
+    Entries _entries;
+    Snapshots _snapshots;
+};
+
+//! ITCH time index builder
+/*!
+    ITCH time index builder scans the length prefixed ITCH stream, records
+    an index entry each time ITCH message timestamp crosses the next
+    interval boundary and forwards all messages to the optional ITCH handler.
+
+    If the market manager is provided book snapshots are taken from it at
+    each checkpoint, so the ITCH handler is expected to maintain this market
+    manager with the forwarded messages.
+
+    Not thread-safe.
+*/
+class ITCHIndexBuilder
+{
+public:
+    //! Initialize ITCH time index builder
+    /*!
+        \param index - ITCH index to build
+        \param interval - Checkpoints interval in nanoseconds
+        \param itch_handler - ITCH handler to forward messages (default is nullptr)
+        \param market - Market manager to take book snapshots (default is nullptr)
+    */
+    ITCHIndexBuilder(ITCHIndex& index, uint64_t interval, ITCHHandler* itch_handler = nullptr, const Matching::MarketManager* market = nullptr);
+    ITCHIndexBuilder(const ITCHIndexBuilder&) = delete;
+    ITCHIndexBuilder(ITCHIndexBuilder&&) = delete;
+    ~ITCHIndexBuilder() = default;
+
+    ITCHIndexBuilder& operator=(const ITCHIndexBuilder&) = delete;
+    ITCHIndexBuilder& operator=(ITCHIndexBuilder&&) = delete;
+
+    //! Get the current byte offset
+    uint64_t offset() const noexcept { return _offset; }
+    //! Get the count of scanned messages
+    uint64_t messages() const noexcept { return _messages; }
+
+    //! Process all messages from the given buffer in ITCH format
+    /*!
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool Process(void* buffer, size_t size);
+
+    //! Reset the builder and clear the index
+    void Reset();
+
+private:
+    ITCHIndex& _index;
+    ITCHHandler* _itch_handler;
+    const Matching::MarketManager* _market;
+    uint64_t _offset;
+    uint64_t _messages;
+    uint64_t _boundary;
+    size_t _size;
+    std::vector<uint8_t> _cache;
+
+    bool ProcessMessage(uint8_t* buffer, size_t size);
+    void Checkpoint(uint64_t timestamp);
+    void Snapshot();
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "itch_index.inl"
+
+#endif // CPPTRADER_ITCH_INDEX_H
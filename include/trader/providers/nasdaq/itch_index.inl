@@ -0,0 +1,38 @@
+/*!
+    \file itch_index.inl
+    \brief NASDAQ ITCH time index inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const ITCHIndexEntry& entry)
+{
+    stream << "ITCHIndexEntry(Timestamp=" << entry.Timestamp
+        << "; Offset=" << entry.Offset
+        << "; Messages=" << entry.Messages
+        << "; SnapshotOffset=" << entry.SnapshotOffset
+        << "; SnapshotSize=" << entry.SnapshotSize
+        << ")";
+    return stream;
+}
+
+inline const ITCHIndexEntry* ITCHIndex::Seek(uint64_t timestamp) const noexcept
+{
+    if (_entries.empty())
+        return nullptr;
+
+    // Find the first entry later than the given timestamp
+    auto it = std::upper_bound(_entries.begin(), _entries.end(), timestamp, [](uint64_t value, const ITCHIndexEntry& entry) { return value < entry.Timestamp; });
+    if (it != _entries.begin())
+        --it;
+
+    return &(*it);
+}
+
+} // namespace ITCH
+} // namespace CppTrader
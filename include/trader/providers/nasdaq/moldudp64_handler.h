@@ -0,0 +1,209 @@
+/*!
+    \file moldudp64_handler.h
+    \brief NASDAQ MoldUDP64 handler definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MOLDUDP64_HANDLER_H
+#define CPPTRADER_MOLDUDP64_HANDLER_H
+
+#include "itch_handler.h"
+
+#include <vector>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! MoldUDP64 packet header
+struct MoldUDP64Header
+{
+    char Session[10];
+    uint64_t SequenceNumber;
+    uint16_t MessageCount;
+
+    //! Is the heartbeat packet?
+    bool IsHeartbeat() const noexcept { return MessageCount == 0; }
+    //! Is the end of session packet?
+    bool IsEndOfSession() const noexcept { return MessageCount == 0xFFFF; }
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MoldUDP64Header& header);
+};
+
+//! Capture packet
+struct CapturePacket
+{
+    //! Capture timestamp in nanoseconds since the Unix epoch
+    uint64_t Timestamp;
+    //! Capture link type (LINKTYPE_* value)
+    uint32_t LinkType;
+    //! UDP destination port
+    uint16_t Port;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const CapturePacket& packet);
+};
+
+//! NASDAQ MoldUDP64 handler class
+/*!
+    NASDAQ MoldUDP64 handler is used to unwrap MoldUDP64 packets from pcap
+    or pcapng captures, track sequence numbers of each MoldUDP64 session
+    and forward message blocks to the given ITCH handler.
+
+    Capture records are parsed in place, only records split between two
+    consecutive Process() calls are cached. Message blocks are passed to
+    ITCHHandler::ProcessMessage() directly from the input buffer.
+
+    Supported link layers: Ethernet (with 802.1Q/802.1ad tags), Linux
+    cooked capture v1/v2, raw IP and BSD loopback. Supported network
+    layers: IPv4 (non-fragmented) and IPv6 (without extension headers).
+
+    Duplicate packets (e.g. from A/B feed lines) are skipped and sequence
+    gaps are reported with onGap() handler.
+
+    MoldUDP64 protocol specification:
+    http://www.nasdaqtrader.com/content/technicalsupport/specifications/dataproducts/moldudp64.pdf
+
+    Not thread-safe.
+*/
+class MoldUDP64Handler
+{
+public:
+    //! Initialize MoldUDP64 handler with a given ITCH handler
+    /*!
+        \param itch_handler - ITCH handler to process message blocks
+        \param port - UDP destination port filter (default is 0 - any port)
+    */
+    explicit MoldUDP64Handler(ITCHHandler& itch_handler, uint16_t port = 0);
+    MoldUDP64Handler(const MoldUDP64Handler&) = delete;
+    MoldUDP64Handler(MoldUDP64Handler&&) = delete;
+    virtual ~MoldUDP64Handler() = default;
+
+    MoldUDP64Handler& operator=(const MoldUDP64Handler&) = delete;
+    MoldUDP64Handler& operator=(MoldUDP64Handler&&) = delete;
+
+    //! Get the count of processed MoldUDP64 packets
+    uint64_t packets() const noexcept { return _packets; }
+    //! Get the count of processed message blocks
+    uint64_t messages() const noexcept { return _messages; }
+    //! Get the count of detected sequence gaps
+    uint64_t gaps() const noexcept { return _gaps; }
+    //! Get the count of messages lost in sequence gaps
+    uint64_t lost() const noexcept { return _lost; }
+    //! Get the count of skipped duplicate messages
+    uint64_t duplicates() const noexcept { return _duplicates; }
+    //! Get the count of skipped non MoldUDP64 capture records
+    uint64_t skipped() const noexcept { return _skipped; }
+
+    //! Get the next expected sequence number of the given session
+    /*!
+        \param session - Session name
+        \return Next expected sequence number or 0 if the session is unknown
+    */
+    uint64_t GetNextSequence(const char (&session)[10]) const noexcept;
+
+    //! Process all records from the given buffer in pcap/pcapng format
+    /*!
+        Buffer could be split into chunks of any size (e.g. file reads).
+
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool Process(void* buffer, size_t size);
+    //! Process a single captured link layer frame
+    /*!
+        \param buffer - Frame buffer to process
+        \param size - Frame buffer size
+        \param link_type - Frame link type (LINKTYPE_* value)
+        \param timestamp - Capture timestamp in nanoseconds (default is 0)
+        \return 'true' if the given frame was successfully processed, 'false' if the given frame process was failed
+    */
+    bool ProcessFrame(void* buffer, size_t size, uint32_t link_type, uint64_t timestamp = 0);
+    //! Process a single MoldUDP64 packet (UDP payload)
+    /*!
+        \param buffer - Packet buffer to process
+        \param size - Packet buffer size
+        \return 'true' if the given packet was successfully processed, 'false' if the given packet process was failed
+    */
+    bool ProcessPacket(void* buffer, size_t size);
+
+    //! Reset MoldUDP64 handler
+    void Reset();
+
+protected:
+    // Capture handlers
+    virtual bool onCapturePacket(const CapturePacket& packet) { return true; }
+
+    // Session handlers
+    virtual bool onHeartbeat(const MoldUDP64Header& header) { return true; }
+    virtual bool onEndOfSession(const MoldUDP64Header& header) { return true; }
+    virtual bool onGap(const MoldUDP64Header& header, uint64_t expected) { return true; }
+
+private:
+    enum class CaptureFormat : uint8_t
+    {
+        UNKNOWN,
+        PCAP,
+        PCAPNG
+    };
+
+    struct CaptureInterface
+    {
+        uint32_t LinkType;
+        uint64_t Resolution;
+    };
+
+    struct Session
+    {
+        char Name[10];
+        uint64_t NextSequence;
+    };
+
+    ITCHHandler& _itch_handler;
+    uint16_t _port;
+
+    // Capture state
+    CaptureFormat _format;
+    bool _big_endian;
+    uint64_t _resolution;
+    uint32_t _link_type;
+    uint32_t _snaplen;
+    std::vector<CaptureInterface> _interfaces;
+    std::vector<uint8_t> _cache;
+    CapturePacket _packet;
+
+    // Sessions state
+    std::vector<Session> _sessions;
+    size_t _session;
+
+    // Statistics
+    uint64_t _packets;
+    uint64_t _messages;
+    uint64_t _gaps;
+    uint64_t _lost;
+    uint64_t _duplicates;
+    uint64_t _skipped;
+
+    size_t RequiredSize(const uint8_t* data, size_t size) const;
+    bool ProcessRecord(uint8_t* data, size_t size);
+    bool ProcessPcapHeader(uint8_t* data, size_t size);
+    bool ProcessPcapRecord(uint8_t* data, size_t size);
+    bool ProcessPcapngBlock(uint8_t* data, size_t size);
+    bool ProcessIP(uint8_t* data, size_t size);
+    bool ProcessUDP(uint8_t* data, size_t size);
+
+    Session& FindSession(const char (&name)[10]);
+
+    uint16_t Read16(const uint8_t* data) const noexcept;
+    uint32_t Read32(const uint8_t* data) const noexcept;
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "moldudp64_handler.inl"
+
+#endif // CPPTRADER_MOLDUDP64_HANDLER_H
@@ -0,0 +1,68 @@
+/*!
+    \file moldudp64_handler.inl
+    \brief NASDAQ MoldUDP64 handler inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MoldUDP64Header& header)
+{
+    stream << "MoldUDP64Header(Session=" << CppCommon::WriteString(header.Session)
+        << "; SequenceNumber=" << header.SequenceNumber
+        << "; MessageCount=" << header.MessageCount
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const CapturePacket& packet)
+{
+    stream << "CapturePacket(Timestamp=" << packet.Timestamp
+        << "; LinkType=" << packet.LinkType
+        << "; Port=" << packet.Port
+        << ")";
+    return stream;
+}
+
+inline MoldUDP64Handler::MoldUDP64Handler(ITCHHandler& itch_handler, uint16_t port)
+    : _itch_handler(itch_handler),
+      _port(port)
+{
+    Reset();
+}
+
+inline uint64_t MoldUDP64Handler::GetNextSequence(const char (&session)[10]) const noexcept
+{
+    for (const auto& item : _sessions)
+        if (std::memcmp(item.Name, session, sizeof(item.Name)) == 0)
+            return item.NextSequence;
+    return 0;
+}
+
+inline uint16_t MoldUDP64Handler::Read16(const uint8_t* data) const noexcept
+{
+    uint16_t value;
+    if (_big_endian)
+        CppCommon::Endian::ReadBigEndian(data, value);
+    else
+        CppCommon::Endian::ReadLittleEndian(data, value);
+    return value;
+}
+
+inline uint32_t MoldUDP64Handler::Read32(const uint8_t* data) const noexcept
+{
+    uint32_t value;
+    if (_big_endian)
+        CppCommon::Endian::ReadBigEndian(data, value);
+    else
+        CppCommon::Endian::ReadLittleEndian(data, value);
+    return value;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
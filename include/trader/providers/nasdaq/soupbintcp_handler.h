@@ -0,0 +1,110 @@
+/*!
+    \file soupbintcp_handler.h
+    \brief NASDAQ SoupBinTCP handler definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_SOUPBINTCP_HANDLER_H
+#define CPPTRADER_SOUPBINTCP_HANDLER_H
+
+#include "itch_handler.h"
+
+#include <vector>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! SoupBinTCP login accepted packet
+struct SoupBinTCPLoginAccepted
+{
+    char Session[10];
+    uint64_t SequenceNumber;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const SoupBinTCPLoginAccepted& packet);
+};
+
+//! NASDAQ SoupBinTCP handler class
+/*!
+    NASDAQ SoupBinTCP handler is used to unwrap SoupBinTCP packets from the
+    reassembled server TCP stream, track sequence numbers of the session and
+    forward sequenced data packets to the given ITCH handler.
+
+    Packets are parsed in place, only packets split between two consecutive
+    Process() calls are cached.
+
+    SoupBinTCP protocol specification:
+    http://www.nasdaqtrader.com/content/technicalsupport/specifications/dataproducts/soupbintcp.pdf
+
+    Not thread-safe.
+*/
+class SoupBinTCPHandler
+{
+public:
+    //! Initialize SoupBinTCP handler with a given ITCH handler
+    /*!
+        \param itch_handler - ITCH handler to process sequenced messages
+    */
+    explicit SoupBinTCPHandler(ITCHHandler& itch_handler) : _itch_handler(itch_handler) { Reset(); }
+    SoupBinTCPHandler(const SoupBinTCPHandler&) = delete;
+    SoupBinTCPHandler(SoupBinTCPHandler&&) = delete;
+    virtual ~SoupBinTCPHandler() = default;
+
+    SoupBinTCPHandler& operator=(const SoupBinTCPHandler&) = delete;
+    SoupBinTCPHandler& operator=(SoupBinTCPHandler&&) = delete;
+
+    //! Get the next expected sequence number
+    uint64_t sequence() const noexcept { return _sequence; }
+    //! Get the count of processed sequenced messages
+    uint64_t messages() const noexcept { return _messages; }
+    //! Get the count of detected sequence gaps
+    uint64_t gaps() const noexcept { return _gaps; }
+
+    //! Process all packets from the given buffer in SoupBinTCP format
+    /*!
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool Process(void* buffer, size_t size);
+    //! Process a single SoupBinTCP packet (without the packet length)
+    /*!
+        \param buffer - Packet buffer to process
+        \param size - Packet buffer size
+        \return 'true' if the given packet was successfully processed, 'false' if the given packet process was failed
+    */
+    bool ProcessPacket(void* buffer, size_t size);
+
+    //! Reset SoupBinTCP handler
+    void Reset();
+
+protected:
+    // Session handlers
+    virtual bool onLoginAccepted(const SoupBinTCPLoginAccepted& packet) { return true; }
+    virtual bool onLoginRejected(char reason) { return true; }
+    virtual bool onHeartbeat() { return true; }
+    virtual bool onEndOfSession() { return true; }
+    virtual bool onGap(const SoupBinTCPLoginAccepted& packet, uint64_t expected) { return true; }
+
+private:
+    ITCHHandler& _itch_handler;
+
+    size_t _size;
+    std::vector<uint8_t> _cache;
+
+    char _session[10];
+    uint64_t _sequence;
+    uint64_t _messages;
+    uint64_t _gaps;
+
+    bool ProcessLoginAccepted(uint8_t* data, size_t size);
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "soupbintcp_handler.inl"
+
+#endif // CPPTRADER_SOUPBINTCP_HANDLER_H
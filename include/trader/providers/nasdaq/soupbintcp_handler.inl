@@ -0,0 +1,22 @@
+/*!
+    \file soupbintcp_handler.inl
+    \brief NASDAQ SoupBinTCP handler inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const SoupBinTCPLoginAccepted& packet)
+{
+    stream << "SoupBinTCPLoginAccepted(Session=" << CppCommon::WriteString(packet.Session)
+        << "; SequenceNumber=" << packet.SequenceNumber
+        << ")";
+    return stream;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -6,9 +6,111 @@
 #include <regex>
 #include <string>
 #include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <sw/redis++/redis++.h>
 
 
+//! Replies of the queued Redis commands
+/*!
+    View of the replies range of the flushed pipeline (e.g. replies of
+    a single asynchronous batch). It is valid until the next flush of
+    the pipeline. Accessors catch Redis errors and return empty values.
+*/
+class MyRedisReplies
+{
+public:
+    MyRedisReplies() = default;
+    MyRedisReplies(sw::redis::QueuedReplies* replies, size_t offset, size_t count) noexcept
+        : _replies(replies), _offset(offset), _count(count)
+    {}
+
+    //! Get the count of replies
+    size_t size() const noexcept { return _count; }
+
+    //! Is the reply with the given index not an error?
+    bool _ok(size_t index);
+    //! Get the string reply (GET)
+    sw::redis::OptionalString _string(size_t index);
+    //! Get the integer reply (DEL, RPUSH)
+    long long _integer(size_t index);
+    //! Get the list reply (LRANGE)
+    std::vector<std::string> _list(size_t index);
+    //! Get the hash reply (HGETALL)
+    std::unordered_map<std::string, std::string> _hash(size_t index);
+
+private:
+    sw::redis::QueuedReplies* _replies{nullptr};
+    size_t _offset{0};
+    size_t _count{0};
+};
+
+//! Queue of Redis commands
+/*!
+    Commands are only buffered until '_exec()', which sends all of them
+    in a single write and reads all replies, so a batch of N commands costs
+    one round trip instead of N. Transaction wraps the batch into the piped
+    MULTI/EXEC block, so it is applied atomically.
+
+    Queue either borrows the shared connection of the Redis client until it
+    is destroyed (short living queues), or keeps its own new connection which
+    is reused by all following batches (long living queues).
+
+    Not thread-safe.
+*/
+template <class TQueued>
+class MyRedisQueue
+{
+public:
+    explicit MyRedisQueue(sw::redis::Redis& redis, bool new_connection = false);
+
+    //! Get the count of queued commands
+    size_t size() const noexcept { return _queued; }
+
+    MyRedisQueue& _get_db(const std::string& key);
+    MyRedisQueue& _del_db(const std::string& key);
+    MyRedisQueue& _lrange_db(const std::string& key);
+    MyRedisQueue& _set_db(const std::string& key, const std::string& val);
+    MyRedisQueue& _append_db(const std::string& key, const std::vector<std::string>& val);
+    MyRedisQueue& _append_db(const std::string& key, const std::vector<uint64_t>& val);
+    MyRedisQueue& _hmset_db(const std::string& key, const std::unordered_map<std::string, std::string>& val);
+    MyRedisQueue& _hgetall_db(const std::string& key);
+
+    //! Flush all queued commands
+    /*!
+        \return 'true' if the commands were sent and their replies received, 'false' on connection errors
+    */
+    bool _exec();
+    //! Get the replies of the last flush
+    MyRedisReplies _replies() { return _replies(0, _result ? _result->size() : 0); }
+    //! Get the replies range of the last flush
+    MyRedisReplies _replies(size_t offset, size_t count);
+
+private:
+    sw::redis::Redis* _redis;
+    bool _new_connection;
+    std::optional<TQueued> _queue;
+    std::optional<sw::redis::QueuedReplies> _result;
+    size_t _queued{0};
+    bool _failed{false};
+
+    static TQueued Create(sw::redis::Redis& redis, bool new_connection);
+    void Reconnect();
+    template <class TCommand>
+    MyRedisQueue& Queue(TCommand&& command);
+};
+
+template <>
+sw::redis::Pipeline MyRedisQueue<sw::redis::Pipeline>::Create(sw::redis::Redis& redis, bool new_connection);
+template <>
+sw::redis::Transaction MyRedisQueue<sw::redis::Transaction>::Create(sw::redis::Redis& redis, bool new_connection);
+
+typedef MyRedisQueue<sw::redis::Pipeline> MyRedisPipeline;
+typedef MyRedisQueue<sw::redis::Transaction> MyRedisTransaction;
+
 class MyRedis
 {
 protected:
@@ -29,7 +131,105 @@ public:
     bool _append_db(const std::string& key, const std::vector<uint64_t> val);
     bool _hmset_db(const std::string& key, const std::unordered_map<std::string, std::string> val);
     std::unordered_map<std::string, std::string> _hgetall_db(const std::string& key);
+    //! Get all given hashes in a single round trip (empty hashes for missing keys)
+    std::vector<std::unordered_map<std::string, std::string>> _hgetall_db(const std::vector<std::string>& keys);
+    //! Get all keys matching the given pattern (incremental SCAN, so the server is not blocked)
+    std::vector<std::string> _scan_db(const std::string& pattern);
+
+    //! Create the subscriber over a new connection
+    /*!
+        \param timeout - Socket timeout, so consume() throws TimeoutError and the subscriber loop may be stopped
+        \return Subscriber or nothing on connection errors
+    */
+    std::optional<sw::redis::Subscriber> _subscriber_db(std::chrono::milliseconds timeout);
+
+    //! Create the pipeline (MyRedis should outlive it)
+    /*!
+        By default the pipeline borrows the shared connection, so it should be
+        destroyed before the next MyRedis command. Long living pipelines should
+        keep their own new connection instead.
+
+        \param new_connection - Create the pipeline over a new connection (default is false)
+    */
+    MyRedisPipeline _pipeline_db(bool new_connection = false) { return MyRedisPipeline(redis, new_connection); }
+    //! Create the transaction (MyRedis should outlive it)
+    /*!
+        \param new_connection - Create the transaction over a new connection (default is false)
+    */
+    MyRedisTransaction _transaction_db(bool new_connection = false) { return MyRedisTransaction(redis, new_connection); }
+
+};
+
+//! Asynchronous Redis client
+/*!
+    Batches of commands are submitted by any thread and shipped by the
+    dedicated I/O thread with its own pipeline connection created once. All
+    batches submitted since the previous flush are sent together (one write
+    and one round trip), then completion callbacks are called on the I/O
+    thread in the order of submission with the replies of their own commands.
+    Callbacks are called without holding the internal lock, so they may
+    submit new batches.
+*/
+class MyRedisAsync
+{
+public:
+    //! Batch of commands (queues commands into the pipeline)
+    typedef std::function<void(MyRedisPipeline&)> Batch;
+    //! Completion callback (flush result, replies of the batch commands)
+    typedef std::function<void(bool, MyRedisReplies&)> Callback;
+
+    explicit MyRedisAsync(MyRedis& redis);
+    MyRedisAsync(const MyRedisAsync&) = delete;
+    MyRedisAsync(MyRedisAsync&&) = delete;
+    ~MyRedisAsync() { Stop(); }
+
+    MyRedisAsync& operator=(const MyRedisAsync&) = delete;
+    MyRedisAsync& operator=(MyRedisAsync&&) = delete;
+
+    //! Is the I/O thread started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the I/O thread
+    bool Start();
+    //! Stop the I/O thread after all submitted batches are completed
+    /*!
+        \return 'true' if the I/O thread was stopped, 'false' if it is not started or called from the completion callback
+    */
+    bool Stop();
+
+    //! Submit the batch of commands
+    /*!
+        \param batch - Batch of commands
+        \param callback - Completion callback (optional)
+        \return 'true' if the batch was submitted, 'false' if the I/O thread is not started
+    */
+    bool Submit(Batch batch, Callback callback = nullptr);
+    //! Wait until all submitted batches are completed
+    /*!
+        Called from the completion callback returns immediately, batches
+        submitted by the callback are shipped by the next I/O thread flush.
+    */
+    void Flush();
+
+private:
+    struct Request
+    {
+        Batch Commands;
+        Callback Completion;
+    };
+
+    MyRedisPipeline _pipeline;
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _cv_submitted;
+    std::condition_variable _cv_completed;
+    std::vector<Request> _requests;
+    std::atomic<bool> _started{false};
+    uint64_t _submitted{0};
+    uint64_t _completed{0};
+    bool _stop{false};
 
+    void Run();
 };
 
 
@@ -0,0 +1,94 @@
+/*!
+    \file event.h
+    \brief Normalized market event definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_REPLAY_EVENT_H
+#define CPPTRADER_REPLAY_EVENT_H
+
+#include "trader/matching/order.h"
+
+#include "utility/iostream.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace CppTrader {
+
+/*!
+    \namespace CppTrader::Replay
+    \brief Normalized market events replay definitions
+*/
+namespace Replay {
+
+//! Event type
+enum class EventType : uint8_t
+{
+    SYMBOL,
+    ADD,
+    EXECUTE,
+    EXECUTE_PRICE,
+    CANCEL,
+    DELETE,
+    REPLACE
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, EventType type);
+
+//! Normalized market event
+/*!
+    Fixed-width record produced from a market data feed (e.g. NASDAQ ITCH)
+    with all decoding and symbol lookup already done. Events are stored in
+    files as-is and are applied to the market manager without any parsing.
+
+    Field usage by event type:
+    SYMBOL        - Symbol, Name
+    ADD           - Symbol, OrderId, Side, Price, Quantity
+    EXECUTE       - OrderId, Quantity
+    EXECUTE_PRICE - OrderId, Price, Quantity
+    CANCEL        - OrderId, Quantity (canceled quantity)
+    DELETE        - OrderId
+    REPLACE       - OrderId, NewOrderId, Price, Quantity
+*/
+struct Event
+{
+    //! Timestamp in nanoseconds
+    uint64_t Timestamp;
+    //! Order Id
+    uint64_t OrderId;
+    union
+    {
+        //! New order Id (REPLACE)
+        uint64_t NewOrderId;
+        //! Symbol name (SYMBOL)
+        char Name[8];
+    };
+    //! Symbol Id
+    uint32_t Symbol;
+    //! Price in ticks
+    uint32_t Price;
+    //! Quantity
+    uint32_t Quantity;
+    //! Event type
+    EventType Type;
+    //! Order side
+    Matching::OrderSide Side;
+    //! Reserved
+    uint16_t Reserved;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const Event& event);
+};
+
+static_assert(sizeof(Event) == 40, "Normalized event must be 40 bytes!");
+
+} // namespace Replay
+} // namespace CppTrader
+
+#include "event.inl"
+
+#endif // CPPTRADER_REPLAY_EVENT_H
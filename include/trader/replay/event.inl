@@ -0,0 +1,67 @@
+/*!
+    \file event.inl
+    \brief Normalized market event inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Replay {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, EventType type)
+{
+    switch (type)
+    {
+        case EventType::SYMBOL:
+            stream << "SYMBOL";
+            break;
+        case EventType::ADD:
+            stream << "ADD";
+            break;
+        case EventType::EXECUTE:
+            stream << "EXECUTE";
+            break;
+        case EventType::EXECUTE_PRICE:
+            stream << "EXECUTE_PRICE";
+            break;
+        case EventType::CANCEL:
+            stream << "CANCEL";
+            break;
+        case EventType::DELETE:
+            stream << "DELETE";
+            break;
+        case EventType::REPLACE:
+            stream << "REPLACE";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const Event& event)
+{
+    stream << "Event(Type=" << event.Type
+        << "; Timestamp=" << event.Timestamp
+        << "; Symbol=" << event.Symbol;
+    if (event.Type == EventType::SYMBOL)
+        stream << "; Name=" << CppCommon::WriteString(event.Name);
+    else
+    {
+        stream << "; OrderId=" << event.OrderId;
+        if (event.Type == EventType::REPLACE)
+            stream << "; NewOrderId=" << event.NewOrderId;
+        stream << "; Side=" << event.Side
+            << "; Price=" << event.Price
+            << "; Quantity=" << event.Quantity;
+    }
+    stream << ")";
+    return stream;
+}
+
+} // namespace Replay
+} // namespace CppTrader
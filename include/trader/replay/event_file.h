@@ -0,0 +1,161 @@
+/*!
+    \file event_file.h
+    \brief Normalized market events file definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_REPLAY_EVENT_FILE_H
+#define CPPTRADER_REPLAY_EVENT_FILE_H
+
+#include "event.h"
+
+#include "filesystem/file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace CppTrader {
+namespace Replay {
+
+//! Normalized market events file header
+/*!
+    Events file is a header followed by a plain array of Event records
+    in the native byte order. Events count is derived from the file size.
+*/
+struct EventFileHeader
+{
+    //! File magic ("CPPTREVT")
+    char Magic[8];
+    //! File format version
+    uint32_t Version;
+    //! Size of a single event record
+    uint32_t EventSize;
+    //! Byte order mark (written as 0x01020304 in the native byte order)
+    uint32_t ByteOrder;
+    //! Reserved
+    uint32_t Reserved;
+
+    //! Current file format version
+    static const uint32_t VERSION = 1;
+
+    //! Prepare the header for the current platform
+    static EventFileHeader Create() noexcept;
+
+    //! Is the header valid for the current platform?
+    bool IsValid() const noexcept;
+};
+
+static_assert(sizeof(EventFileHeader) == 24, "Events file header must be 24 bytes!");
+
+//! Normalized market events file writer
+/*!
+    Events are accumulated in the internal buffer and written in blocks.
+
+    Not thread-safe.
+*/
+class EventWriter
+{
+public:
+    //! Initialize events writer with a given buffer capacity
+    /*!
+        \param capacity - Buffer capacity in events (default is 65536)
+    */
+    explicit EventWriter(size_t capacity = 65536);
+    EventWriter(const EventWriter&) = delete;
+    EventWriter(EventWriter&&) = delete;
+    ~EventWriter() { Close(); }
+
+    EventWriter& operator=(const EventWriter&) = delete;
+    EventWriter& operator=(EventWriter&&) = delete;
+
+    //! Check if the events file is opened
+    bool IsOpened() const { return _file.IsFileOpened(); }
+
+    //! Get the count of written events
+    uint64_t events() const noexcept { return _events; }
+
+    //! Create a new events file (existing file will be truncated)
+    /*!
+        \param path - Events file path
+    */
+    void Open(const CppCommon::Path& path);
+    //! Flush and close the events file
+    void Close();
+
+    //! Write the given event
+    /*!
+        \param event - Event to write
+    */
+    void Write(const Event& event);
+    //! Flush buffered events to the file
+    void Flush();
+
+private:
+    CppCommon::File _file;
+    std::vector<Event> _buffer;
+    size_t _capacity;
+    uint64_t _events;
+};
+
+//! Memory-mapped normalized market events file
+/*!
+    Events file is mapped into the process address space as read-only
+    and events are accessed directly from the mapped memory.
+
+    Not thread-safe.
+*/
+class EventFile
+{
+public:
+    EventFile();
+    EventFile(const EventFile&) = delete;
+    EventFile(EventFile&&) = delete;
+    ~EventFile() { Close(); }
+
+    EventFile& operator=(const EventFile&) = delete;
+    EventFile& operator=(EventFile&&) = delete;
+
+    //! Check if the events file is opened
+    bool IsOpened() const noexcept { return _data != nullptr; }
+
+    //! Get the events count
+    size_t size() const noexcept { return _size; }
+    //! Get the first event
+    const Event* begin() const noexcept { return _events; }
+    //! Get the event after the last one
+    const Event* end() const noexcept { return _events + _size; }
+
+    //! Get the event with the given index
+    const Event& operator[](size_t index) const noexcept { return _events[index]; }
+
+    //! Open and map the events file
+    /*!
+        \param path - Events file path
+        \return 'true' if the events file was successfully mapped, 'false' if the file is missing or has invalid format
+    */
+    bool Open(const CppCommon::Path& path);
+    //! Unmap and close the events file
+    void Close();
+
+private:
+    void* _data;
+    size_t _length;
+    const Event* _events;
+    size_t _size;
+#if defined(_WIN32) || defined(_WIN64)
+    void* _file;
+    void* _mapping;
+#else
+    int _file;
+#endif
+};
+
+} // namespace Replay
+} // namespace CppTrader
+
+#include "event_file.inl"
+
+#endif // CPPTRADER_REPLAY_EVENT_FILE_H
@@ -0,0 +1,43 @@
+/*!
+    \file event_file.inl
+    \brief Normalized market events file inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Replay {
+
+inline EventFileHeader EventFileHeader::Create() noexcept
+{
+    EventFileHeader header;
+    std::memcpy(header.Magic, "CPPTREVT", sizeof(header.Magic));
+    header.Version = VERSION;
+    header.EventSize = sizeof(Event);
+    header.ByteOrder = 0x01020304;
+    header.Reserved = 0;
+    return header;
+}
+
+inline bool EventFileHeader::IsValid() const noexcept
+{
+    return (std::memcmp(Magic, "CPPTREVT", sizeof(Magic)) == 0) && (Version == VERSION) && (EventSize == sizeof(Event)) && (ByteOrder == 0x01020304);
+}
+
+inline EventWriter::EventWriter(size_t capacity)
+    : _capacity(std::max(capacity, (size_t)1)),
+      _events(0)
+{
+    _buffer.reserve(_capacity);
+}
+
+inline void EventWriter::Write(const Event& event)
+{
+    _buffer.push_back(event);
+    if (_buffer.size() >= _capacity)
+        Flush();
+}
+
+} // namespace Replay
+} // namespace CppTrader
@@ -0,0 +1,73 @@
+/*!
+    \file event_replayer.h
+    \brief Normalized market events replayer definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_REPLAY_EVENT_REPLAYER_H
+#define CPPTRADER_REPLAY_EVENT_REPLAYER_H
+
+#include "event.h"
+
+#include "trader/matching/market_manager.h"
+
+namespace CppTrader {
+namespace Replay {
+
+//! Normalized market events replayer
+/*!
+    Events replayer applies normalized market events directly to
+    the market manager. No decoding or symbol lookup is performed.
+
+    Not thread-safe.
+*/
+class EventReplayer
+{
+public:
+    //! Initialize events replayer with a given market manager
+    /*!
+        \param market - Market manager to rebuild
+    */
+    explicit EventReplayer(Matching::MarketManager& market);
+    EventReplayer(const EventReplayer&) = delete;
+    EventReplayer(EventReplayer&&) = delete;
+    ~EventReplayer() = default;
+
+    EventReplayer& operator=(const EventReplayer&) = delete;
+    EventReplayer& operator=(EventReplayer&&) = delete;
+
+    //! Get the count of replayed events
+    uint64_t events() const noexcept { return _events; }
+    //! Get the count of failed events
+    uint64_t errors() const noexcept { return _errors; }
+
+    //! Replay a single event
+    /*!
+        \param event - Event to replay
+        \return Error code
+    */
+    Matching::ErrorCode Replay(const Event& event);
+    //! Replay the given range of events
+    /*!
+        \param begin - First event
+        \param end - Event after the last one
+    */
+    void Replay(const Event* begin, const Event* end);
+
+    //! Reset replayer statistics
+    void Reset() noexcept { _events = 0; _errors = 0; }
+
+private:
+    Matching::MarketManager& _market;
+    uint64_t _events;
+    uint64_t _errors;
+};
+
+} // namespace Replay
+} // namespace CppTrader
+
+#include "event_replayer.inl"
+
+#endif // CPPTRADER_REPLAY_EVENT_REPLAYER_H
@@ -0,0 +1,70 @@
+/*!
+    \file event_replayer.inl
+    \brief Normalized market events replayer inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Replay {
+
+inline EventReplayer::EventReplayer(Matching::MarketManager& market)
+    : _market(market),
+      _events(0),
+      _errors(0)
+{
+}
+
+inline Matching::ErrorCode EventReplayer::Replay(const Event& event)
+{
+    Matching::ErrorCode result;
+
+    switch (event.Type)
+    {
+        case EventType::ADD:
+            result = _market.AddOrder(Matching::Order::Limit(event.OrderId, event.Symbol, event.Side, event.Price, event.Quantity));
+            break;
+        case EventType::EXECUTE:
+            result = _market.ExecuteOrder(event.OrderId, event.Quantity);
+            break;
+        case EventType::EXECUTE_PRICE:
+            result = _market.ExecuteOrder(event.OrderId, event.Price, event.Quantity);
+            break;
+        case EventType::CANCEL:
+            result = _market.ReduceOrder(event.OrderId, event.Quantity);
+            break;
+        case EventType::DELETE:
+            result = _market.DeleteOrder(event.OrderId);
+            break;
+        case EventType::REPLACE:
+            result = _market.ReplaceOrder(event.OrderId, event.NewOrderId, event.Price, event.Quantity);
+            break;
+        case EventType::SYMBOL:
+        {
+            Matching::Symbol symbol(event.Symbol, event.Name);
+            result = _market.AddSymbol(symbol);
+            if (result == Matching::ErrorCode::OK)
+                result = _market.AddOrderBook(symbol);
+            break;
+        }
+        default:
+            result = Matching::ErrorCode::ORDER_TYPE_INVALID;
+            break;
+    }
+
+    ++_events;
+    if (result != Matching::ErrorCode::OK)
+        ++_errors;
+
+    return result;
+}
+
+inline void EventReplayer::Replay(const Event* begin, const Event* end)
+{
+    for (const Event* event = begin; event != end; ++event)
+        Replay(*event);
+}
+
+} // namespace Replay
+} // namespace CppTrader
@@ -0,0 +1,85 @@
+/*!
+    \file itch_converter.h
+    \brief NASDAQ ITCH to normalized market events converter definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_REPLAY_ITCH_CONVERTER_H
+#define CPPTRADER_REPLAY_ITCH_CONVERTER_H
+
+#include "event.h"
+
+#include "trader/providers/nasdaq/itch_handler.h"
+
+namespace CppTrader {
+namespace Replay {
+
+//! NASDAQ ITCH to normalized market events converter
+/*!
+    ITCH converter decodes ITCH messages which change the order book state
+    (stock directory, add, execute, cancel, delete, replace) and produces
+    normalized market events with onEvent() handler. Stock locate code is
+    used as a symbol Id. All other messages are counted and skipped.
+
+    Not thread-safe.
+*/
+class ITCHConverter : public ITCH::ITCHHandler
+{
+public:
+    ITCHConverter();
+    ITCHConverter(const ITCHConverter&) = delete;
+    ITCHConverter(ITCHConverter&&) = delete;
+    virtual ~ITCHConverter() = default;
+
+    ITCHConverter& operator=(const ITCHConverter&) = delete;
+    ITCHConverter& operator=(ITCHConverter&&) = delete;
+
+    //! Get the count of processed ITCH messages
+    uint64_t messages() const noexcept { return _messages; }
+    //! Get the count of produced events
+    uint64_t events() const noexcept { return _events; }
+    //! Get the count of unknown ITCH messages
+    uint64_t errors() const noexcept { return _errors; }
+
+protected:
+    // Event handler
+    virtual bool onEvent(const Event& event) { return true; }
+
+protected:
+    bool onMessage(const ITCH::SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::StockDirectoryMessage& message) override;
+    bool onMessage(const ITCH::StockTradingActionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::RegSHOMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::MarketParticipantPositionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::MWCBDeclineMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::MWCBStatusMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::IPOQuotingMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::AddOrderMessage& message) override;
+    bool onMessage(const ITCH::AddOrderMPIDMessage& message) override;
+    bool onMessage(const ITCH::OrderExecutedMessage& message) override;
+    bool onMessage(const ITCH::OrderExecutedWithPriceMessage& message) override;
+    bool onMessage(const ITCH::OrderCancelMessage& message) override;
+    bool onMessage(const ITCH::OrderDeleteMessage& message) override;
+    bool onMessage(const ITCH::OrderReplaceMessage& message) override;
+    bool onMessage(const ITCH::TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::CrossTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::BrokenTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::NOIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::RPIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::LULDAuctionCollarMessage& message) override { ++_messages; return true; }
+    bool onMessage(const ITCH::UnknownMessage& message) override { ++_errors; return true; }
+
+private:
+    uint64_t _messages;
+    uint64_t _events;
+    uint64_t _errors;
+
+    bool Emit(EventType type, uint32_t symbol, uint64_t timestamp, uint64_t order_id, uint32_t price, uint32_t quantity, Matching::OrderSide side = Matching::OrderSide::BUY, uint64_t new_order_id = 0);
+};
+
+} // namespace Replay
+} // namespace CppTrader
+
+#endif // CPPTRADER_REPLAY_ITCH_CONVERTER_H
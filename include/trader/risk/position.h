@@ -14,9 +14,10 @@
 #include "../matching/symbol.h"
 #include "containers/list.h"
 #include "utility/iostream.h"
-#include "../kdb/c/c/k.h"
+#include "../kdbp_db.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <limits>
 
@@ -88,7 +89,7 @@ namespace CppTrader
 
             template <class TOutputStream>
             friend TOutputStream &operator<<(TOutputStream &stream, const Position &position);
-            static double* CalculatePnL(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const CppTrader::Matching::Symbol &symbol) noexcept;
+            static std::array<double, 3> CalculatePnL(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const CppTrader::Matching::Symbol &symbol) noexcept;
             static double CalculateFunding(const Position &position, const uint64_t timespan, const CppTrader::Matching::Symbol &symbol) noexcept;
             Position OrderExecuted(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const CppTrader::Matching::Symbol &symbol) noexcept;
             Position ReadDbStructure(K data, Kdbp kdb) noexcept;
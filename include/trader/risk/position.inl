@@ -100,7 +100,7 @@ inline double Position::CalculateFunding(const Position &position, const uint64_
     return funding;
 }
 
-inline double* Position::CalculatePnL(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const Symbol &symbol) noexcept
+inline std::array<double, 3> Position::CalculatePnL(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const Symbol &symbol) noexcept
 {
     double realized;
     double unrealized;
@@ -144,7 +144,7 @@ inline double* Position::CalculatePnL(const Position &position, const CppTrader:
 
     }
 
-    return new double[3]{realized, unrealized, avgEntryPrice};
+    return std::array<double, 3>{realized, unrealized, avgEntryPrice};
 }
 
 inline Position Position::OrderExecuted(const Position &position, const CppTrader::Matching::Order &order, uint64_t price, uint64_t quantity, const Symbol &symbol) noexcept
@@ -153,9 +153,7 @@ inline Position Position::OrderExecuted(const Position &position, const CppTrade
     {
         return position;
     }
-    double * pnls;
-
-    pnls = Position::CalculatePnL(position, order, price, quantity, symbol);
+    std::array<double, 3> pnls = Position::CalculatePnL(position, order, price, quantity, symbol);
 
     Position pos = Position(position);
     int64_t q = order.Side == OrderSide::BUY?quantity:-1 * (int64_t)quantity;
@@ -0,0 +1,202 @@
+/*!
+    \file position_book.h
+    \brief Position book definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_RISK_POSITION_BOOK_H
+#define CPPTRADER_RISK_POSITION_BOOK_H
+
+#include "position.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CppTrader {
+namespace Risk {
+
+//! Position book
+/*!
+    Position book keeps positions indexed by (symbol, account) integers.
+    Accounts are registered once and get dense indexes, each symbol keeps
+    a dense array of account slots, so the position of the fill is found
+    with a single integer hash lookup (or without any lookup by the account
+    index) and two array indexes.
+
+    Modified positions are collected into the dirty list (each position at
+    most once) which is drained by the persistence flush. Marking also
+    refreshes the compact per-symbol list of holders (accounts with non-zero
+    position quantity), so mark price and funding refreshes visit only
+    actual holders and scale with the open interest, not the accounts count.
+    Memory is only allocated when a new symbol or account appears or the
+    dirty list grows beyond its previous capacity, so position updates of
+    known accounts are allocation-free. Adding a position of a new symbol or
+    account may invalidate pointers and references to other positions.
+
+    Not thread-safe.
+*/
+class PositionBook
+{
+public:
+    //! Position slot key
+    struct Key
+    {
+        //! Symbol Id
+        uint32_t Symbol;
+        //! Dense account index
+        uint32_t Account;
+    };
+
+    PositionBook() = default;
+    PositionBook(const PositionBook&) = delete;
+    PositionBook(PositionBook&&) = delete;
+    ~PositionBook() = default;
+
+    PositionBook& operator=(const PositionBook&) = delete;
+    PositionBook& operator=(PositionBook&&) = delete;
+
+    //! Is the position book empty?
+    bool empty() const noexcept { return _size == 0; }
+    //! Get the count of positions
+    size_t size() const noexcept { return _size; }
+    //! Get the count of registered accounts
+    size_t accounts() const noexcept { return _account_ids.size(); }
+    //! Get the count of dirty positions
+    size_t dirty() const noexcept { return _dirty.size(); }
+    //! Get the count of holders of the given symbol
+    size_t holders(uint32_t symbol) const noexcept { return (symbol < _holders.size()) ? _holders[symbol].size() : 0; }
+
+    //! Get the dense index of the given account
+    /*!
+        \param account - Account Id
+        \return Dense account index or -1 if the account is not registered
+    */
+    int64_t GetAccount(uint64_t account) const noexcept;
+    //! Register the given account
+    /*!
+        \param account - Account Id
+        \return Dense account index (existing one if the account is already registered)
+    */
+    uint32_t AddAccount(uint64_t account);
+
+    //! Get the position of the given symbol and account
+    /*!
+        \param symbol - Symbol Id
+        \param account - Account Id
+        \return Pointer to the position or nullptr if the position is not found
+    */
+    Position* GetPosition(uint32_t symbol, uint64_t account) noexcept;
+    const Position* GetPosition(uint32_t symbol, uint64_t account) const noexcept
+    { return const_cast<PositionBook*>(this)->GetPosition(symbol, account); }
+    //! Get the position of the given symbol and dense account index
+    /*!
+        \param key - Position slot key
+        \return Pointer to the position or nullptr if the position is not found
+    */
+    Position* GetPosition(Key key) noexcept;
+
+    //! Add the position of the given symbol and account
+    /*!
+        New position is empty (value-initialized) with the given symbol and
+        account Ids. The account is registered if necessary.
+
+        \param symbol - Symbol Id
+        \param account - Account Id
+        \return Added or already existing position
+    */
+    Position& AddPosition(uint32_t symbol, uint64_t account);
+
+    //! Mark the position of the given symbol and account as dirty
+    /*!
+        Position should be marked after each modification, which also adds
+        or removes the account from the symbol holders by the position quantity.
+
+        \param symbol - Symbol Id
+        \param account - Account Id
+        \return 'true' if the position was marked, 'false' if the position is not found
+    */
+    bool MarkDirty(uint32_t symbol, uint64_t account);
+    //! Mark the position with the given key as dirty
+    /*!
+        Position should be marked after each modification, which also adds
+        or removes the account from the symbol holders by the position quantity.
+
+        \param key - Position slot key
+        \return 'true' if the position was marked, 'false' if the position is not found
+    */
+    bool MarkDirty(Key key);
+
+    //! Refresh the symbol holders by the position with the given key without marking it as dirty
+    /*!
+        Should be used for positions modified without persistence, e.g. loaded on startup.
+
+        \param key - Position slot key
+        \return 'true' if holders were refreshed, 'false' if the position is not found
+    */
+    bool UpdateHolder(Key key);
+
+    //! Drain the dirty list
+    /*!
+        Handler is called with each dirty position in the order of marking,
+        then the dirty list is cleared (keeping its capacity).
+
+        \param handler - Dirty position handler (const Position&)
+        \return Count of drained positions
+    */
+    template <class THandler>
+    size_t FlushDirty(THandler&& handler);
+
+    //! Visit all positions of the given symbol
+    /*!
+        \param symbol - Symbol Id
+        \param handler - Position handler (Position&, Key)
+    */
+    template <class THandler>
+    void ForEachPosition(uint32_t symbol, THandler&& handler);
+    //! Visit positions of the symbol holders
+    /*!
+        Handler may mark visited positions as dirty (even if they are removed
+        from holders). Holders added by the handler are not visited.
+
+        \param symbol - Symbol Id
+        \param handler - Position handler (Position&, Key)
+    */
+    template <class THandler>
+    void ForEachHolder(uint32_t symbol, THandler&& handler);
+
+    //! Clear the position book
+    void Clear();
+
+private:
+    // Position slot
+    struct Slot
+    {
+        Position Data;
+        bool Exists;
+        bool Dirty;
+        //! Index in the symbol holders (-1 if the position is flat)
+        int32_t Holder;
+
+        Slot() noexcept : Data(), Exists(false), Dirty(false), Holder(-1) {}
+    };
+
+    std::unordered_map<uint64_t, uint32_t> _accounts;
+    std::vector<uint64_t> _account_ids;
+    std::vector<std::vector<Slot>> _symbols;
+    std::vector<Key> _dirty;
+    std::vector<std::vector<uint32_t>> _holders;
+    size_t _size{0};
+
+    Slot* GetSlot(Key key) noexcept;
+    void UpdateHolder(Key key, Slot& slot);
+};
+
+} // namespace Risk
+} // namespace CppTrader
+
+#include "position_book.inl"
+
+#endif // CPPTRADER_RISK_POSITION_BOOK_H
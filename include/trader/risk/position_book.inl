@@ -0,0 +1,183 @@
+/*!
+    \file position_book.inl
+    \brief Position book inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Risk {
+
+inline int64_t PositionBook::GetAccount(uint64_t account) const noexcept
+{
+    auto it = _accounts.find(account);
+    return (it != _accounts.end()) ? (int64_t)it->second : -1;
+}
+
+inline uint32_t PositionBook::AddAccount(uint64_t account)
+{
+    auto result = _accounts.emplace(account, (uint32_t)_account_ids.size());
+    if (result.second)
+        _account_ids.push_back(account);
+    return result.first->second;
+}
+
+inline PositionBook::Slot* PositionBook::GetSlot(Key key) noexcept
+{
+    if (key.Symbol >= _symbols.size())
+        return nullptr;
+    auto& slots = _symbols[key.Symbol];
+    if (key.Account >= slots.size())
+        return nullptr;
+    Slot* slot = &slots[key.Account];
+    return slot->Exists ? slot : nullptr;
+}
+
+inline Position* PositionBook::GetPosition(Key key) noexcept
+{
+    Slot* slot = GetSlot(key);
+    return (slot != nullptr) ? &slot->Data : nullptr;
+}
+
+inline Position* PositionBook::GetPosition(uint32_t symbol, uint64_t account) noexcept
+{
+    int64_t index = GetAccount(account);
+    return (index >= 0) ? GetPosition(Key{ symbol, (uint32_t)index }) : nullptr;
+}
+
+inline Position& PositionBook::AddPosition(uint32_t symbol, uint64_t account)
+{
+    uint32_t index = AddAccount(account);
+
+    if (symbol >= _symbols.size())
+        _symbols.resize(symbol + 1);
+    auto& slots = _symbols[symbol];
+    // Account slots of the symbol cover all registered accounts
+    if (index >= slots.size())
+        slots.resize(_account_ids.size());
+
+    Slot& slot = slots[index];
+    if (!slot.Exists)
+    {
+        slot.Data = Position();
+        slot.Data.SymbolId = symbol;
+        slot.Data.AccountId = account;
+        slot.Exists = true;
+        ++_size;
+    }
+    return slot.Data;
+}
+
+inline bool PositionBook::MarkDirty(Key key)
+{
+    Slot* slot = GetSlot(key);
+    if (slot == nullptr)
+        return false;
+
+    if (!slot->Dirty)
+    {
+        slot->Dirty = true;
+        _dirty.push_back(key);
+    }
+
+    UpdateHolder(key, *slot);
+    return true;
+}
+
+inline bool PositionBook::UpdateHolder(Key key)
+{
+    Slot* slot = GetSlot(key);
+    if (slot == nullptr)
+        return false;
+
+    UpdateHolder(key, *slot);
+    return true;
+}
+
+inline void PositionBook::UpdateHolder(Key key, Slot& slot)
+{
+    // Refresh the symbol holders
+    bool holder = (slot.Data.Quantity != 0);
+    if (holder && (slot.Holder < 0))
+    {
+        if (key.Symbol >= _holders.size())
+            _holders.resize(key.Symbol + 1);
+        auto& holders = _holders[key.Symbol];
+        slot.Holder = (int32_t)holders.size();
+        holders.push_back(key.Account);
+    }
+    else if (!holder && (slot.Holder >= 0))
+    {
+        // Swap the last holder into the removed one
+        auto& holders = _holders[key.Symbol];
+        uint32_t last = holders.back();
+        holders[slot.Holder] = last;
+        _symbols[key.Symbol][last].Holder = slot.Holder;
+        holders.pop_back();
+        slot.Holder = -1;
+    }
+}
+
+inline bool PositionBook::MarkDirty(uint32_t symbol, uint64_t account)
+{
+    int64_t index = GetAccount(account);
+    return (index >= 0) && MarkDirty(Key{ symbol, (uint32_t)index });
+}
+
+template <class THandler>
+inline size_t PositionBook::FlushDirty(THandler&& handler)
+{
+    for (const auto& key : _dirty)
+    {
+        Slot& slot = _symbols[key.Symbol][key.Account];
+        slot.Dirty = false;
+        handler((const Position&)slot.Data);
+    }
+
+    size_t count = _dirty.size();
+    _dirty.clear();
+    return count;
+}
+
+template <class THandler>
+inline void PositionBook::ForEachPosition(uint32_t symbol, THandler&& handler)
+{
+    if (symbol >= _symbols.size())
+        return;
+
+    auto& slots = _symbols[symbol];
+    for (uint32_t i = 0; i < slots.size(); ++i)
+        if (slots[i].Exists)
+            handler(slots[i].Data, Key{ symbol, i });
+}
+
+template <class THandler>
+inline void PositionBook::ForEachHolder(uint32_t symbol, THandler&& handler)
+{
+    if (symbol >= _holders.size())
+        return;
+
+    // Backward iteration is stable to the removal of the visited holder
+    auto& holders = _holders[symbol];
+    for (size_t i = holders.size(); i-- > 0;)
+    {
+        if (i >= holders.size())
+            continue;
+        uint32_t account = holders[i];
+        handler(_symbols[symbol][account].Data, Key{ symbol, account });
+    }
+}
+
+inline void PositionBook::Clear()
+{
+    _accounts.clear();
+    _account_ids.clear();
+    _symbols.clear();
+    _dirty.clear();
+    _holders.clear();
+    _size = 0;
+}
+
+} // namespace Risk
+} // namespace CppTrader
@@ -0,0 +1,184 @@
+/*!
+    \file benchmark_report.h
+    \brief Benchmark report definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_STATISTICS_BENCHMARK_REPORT_H
+#define CPPTRADER_STATISTICS_BENCHMARK_REPORT_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace CppTrader {
+namespace Statistics {
+
+//! Benchmark metric direction
+enum class MetricDirection : uint8_t
+{
+    LOWER_IS_BETTER,
+    HIGHER_IS_BETTER
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, MetricDirection direction);
+
+//! Benchmark metric
+struct BenchmarkMetric
+{
+    //! Metric name (e.g. "command_throughput")
+    std::string Name;
+    //! Metric value
+    double Value;
+    //! Metric unit (e.g. "cmd/s" or "ns")
+    std::string Unit;
+    //! Metric direction
+    MetricDirection Direction;
+    //! Relative tolerance of the metric (negative value means the default tolerance)
+    double Tolerance;
+};
+
+//! Benchmark metric verdict
+struct BenchmarkVerdict
+{
+    //! Metric name
+    std::string Name;
+    //! Baseline value
+    double Baseline;
+    //! Current value
+    double Current;
+    //! Relative change of the current value against the baseline one
+    double Change;
+    //! Applied relative tolerance
+    double Tolerance;
+    //! Is the metric missing in the current report?
+    bool Missing;
+    //! Is the metric within the tolerance?
+    bool Passed;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const BenchmarkVerdict& verdict);
+};
+
+//! Benchmark report
+/*!
+    Benchmark report is a named list of metrics (throughput, latency
+    percentiles, hardware counters, memory) which is saved into a JSON
+    file by benchmarks and compared against a committed baseline report
+    to get a pass/fail performance verdict:
+
+    \code{.json}
+    {
+      "benchmark": "synthetic",
+      "metrics": [
+        { "name": "command_throughput", "value": 5123456, "unit": "cmd/s", "better": "higher", "tolerance": 0.1 }
+      ]
+    }
+    \endcode
+
+    The "tolerance" field is optional. Only reports in this format are
+    supported by the JSON reader.
+
+    Not thread-safe.
+*/
+class BenchmarkReport
+{
+public:
+    BenchmarkReport() = default;
+    explicit BenchmarkReport(const std::string& name) : _name(name) {}
+    BenchmarkReport(const BenchmarkReport&) = default;
+    BenchmarkReport(BenchmarkReport&&) = default;
+    ~BenchmarkReport() = default;
+
+    BenchmarkReport& operator=(const BenchmarkReport&) = default;
+    BenchmarkReport& operator=(BenchmarkReport&&) = default;
+
+    //! Get the benchmark name
+    const std::string& name() const noexcept { return _name; }
+    //! Get the benchmark metrics
+    const std::vector<BenchmarkMetric>& metrics() const noexcept { return _metrics; }
+
+    //! Find the metric with the given name
+    /*!
+        \param name - Metric name
+        \return Pointer to the metric or nullptr if the metric is not found
+    */
+    const BenchmarkMetric* Find(const std::string& name) const noexcept;
+
+    //! Add the metric (an existing metric with the same name is replaced)
+    /*!
+        \param name - Metric name
+        \param value - Metric value
+        \param unit - Metric unit
+        \param direction - Metric direction
+        \param tolerance - Relative tolerance of the metric (default is -1.0 which means the default tolerance)
+    */
+    void Add(const std::string& name, double value, const std::string& unit, MetricDirection direction, double tolerance = -1.0);
+
+    //! Clear the report
+    void Clear() { _name.clear(); _metrics.clear(); }
+
+    //! Compare the report against the baseline one
+    /*!
+        Each baseline metric gets a verdict. A metric fails if it is missing
+        in the current report or changed in the worse direction by more than
+        its tolerance. Metrics which are not present in the baseline report
+        are not compared.
+
+        \param baseline - Baseline report
+        \param tolerance - Default relative tolerance (e.g. 0.1 for 10%)
+        \return Verdicts of all baseline metrics
+    */
+    std::vector<BenchmarkVerdict> Compare(const BenchmarkReport& baseline, double tolerance) const;
+
+    //! Write the report in JSON format
+    /*!
+        \param stream - Output stream
+    */
+    template <class TOutputStream>
+    void WriteJSON(TOutputStream& stream) const;
+    //! Read the report from JSON format
+    /*!
+        \param json - JSON string
+        \return 'true' if the report was successfully read, 'false' if the JSON is malformed
+    */
+    bool ReadJSON(const std::string& json);
+
+    //! Save the report into the given JSON file
+    /*!
+        \param path - File path
+        \return 'true' if the report was successfully saved, 'false' in case of any error
+    */
+    bool Save(const std::string& path) const;
+    //! Load the report from the given JSON file
+    /*!
+        \param path - File path
+        \return 'true' if the report was successfully loaded, 'false' in case of any error
+    */
+    bool Load(const std::string& path);
+
+private:
+    std::string _name;
+    std::vector<BenchmarkMetric> _metrics;
+
+    static std::string FormatNumber(double value);
+    static std::string FormatString(const std::string& value);
+};
+
+//! Check if all verdicts are passed
+/*!
+    \param verdicts - Verdicts to check
+    \return 'true' if all verdicts are passed, 'false' otherwise
+*/
+bool Passed(const std::vector<BenchmarkVerdict>& verdicts) noexcept;
+
+} // namespace Statistics
+} // namespace CppTrader
+
+#include "benchmark_report.inl"
+
+#endif // CPPTRADER_STATISTICS_BENCHMARK_REPORT_H
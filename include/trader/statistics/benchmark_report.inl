@@ -0,0 +1,67 @@
+/*!
+    \file benchmark_report.inl
+    \brief Benchmark report inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Statistics {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, MetricDirection direction)
+{
+    switch (direction)
+    {
+        case MetricDirection::LOWER_IS_BETTER:
+            stream << "lower";
+            break;
+        case MetricDirection::HIGHER_IS_BETTER:
+            stream << "higher";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const BenchmarkVerdict& verdict)
+{
+    stream << "BenchmarkVerdict(Name=" << verdict.Name
+        << "; Baseline=" << verdict.Baseline
+        << "; Current=" << verdict.Current
+        << "; Change=" << verdict.Change
+        << "; Tolerance=" << verdict.Tolerance
+        << "; Missing=" << (verdict.Missing ? "true" : "false")
+        << "; Passed=" << (verdict.Passed ? "true" : "false")
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline void BenchmarkReport::WriteJSON(TOutputStream& stream) const
+{
+    stream << "{\n";
+    stream << "  \"benchmark\": " << FormatString(_name) << ",\n";
+    stream << "  \"metrics\": [";
+    for (size_t i = 0; i < _metrics.size(); ++i)
+    {
+        const BenchmarkMetric& metric = _metrics[i];
+        stream << ((i > 0) ? ",\n" : "\n");
+        stream << "    { \"name\": " << FormatString(metric.Name)
+            << ", \"value\": " << FormatNumber(metric.Value)
+            << ", \"unit\": " << FormatString(metric.Unit)
+            << ", \"better\": \"" << metric.Direction << "\"";
+        if (metric.Tolerance >= 0.0)
+            stream << ", \"tolerance\": " << FormatNumber(metric.Tolerance);
+        stream << " }";
+    }
+    stream << (_metrics.empty() ? "]\n" : "\n  ]\n");
+    stream << "}\n";
+}
+
+} // namespace Statistics
+} // namespace CppTrader
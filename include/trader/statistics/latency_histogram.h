@@ -0,0 +1,120 @@
+/*!
+    \file latency_histogram.h
+    \brief Latency histogram definition
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_STATISTICS_LATENCY_HISTOGRAM_H
+#define CPPTRADER_STATISTICS_LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace CppTrader {
+
+/*!
+    \namespace CppTrader::Statistics
+    \brief Statistics definitions
+*/
+namespace Statistics {
+
+//! Latency histogram
+/*!
+    Latency histogram records non-negative values (usually nanoseconds)
+    into log-linear buckets: values below 128 are recorded exactly and
+    larger values with the relative error below 1/64. Recording is a few
+    arithmetic operations without any allocations, so the histogram could
+    be used on hot paths.
+
+    Not thread-safe.
+*/
+class LatencyHistogram
+{
+public:
+    LatencyHistogram() noexcept { Reset(); }
+    LatencyHistogram(const LatencyHistogram&) noexcept = default;
+    LatencyHistogram(LatencyHistogram&&) noexcept = default;
+    ~LatencyHistogram() noexcept = default;
+
+    LatencyHistogram& operator=(const LatencyHistogram&) noexcept = default;
+    LatencyHistogram& operator=(LatencyHistogram&&) noexcept = default;
+
+    //! Check if the histogram is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the histogram empty?
+    bool empty() const noexcept { return _count == 0; }
+
+    //! Get the count of recorded values
+    uint64_t count() const noexcept { return _count; }
+    //! Get the minimal recorded value
+    uint64_t min() const noexcept { return (_count > 0) ? _min : 0; }
+    //! Get the maximal recorded value
+    uint64_t max() const noexcept { return _max; }
+    //! Get the mean of recorded values
+    double mean() const noexcept { return (_count > 0) ? ((double)_total / (double)_count) : 0.0; }
+
+    //! Record the given value
+    /*!
+        \param value - Value to record
+        \param count - Count of records (default is 1)
+    */
+    void Record(uint64_t value, uint64_t count = 1) noexcept;
+    //! Record the given value with coordinated omission correction
+    /*!
+        If the value is larger than the expected interval between records,
+        the missed records are filled with linearly decreasing values
+        (value - interval, value - 2 * interval, ...) the same way as
+        a load generator which did not stall would have measured them.
+
+        \param value - Value to record
+        \param interval - Expected interval between records
+    */
+    void RecordCorrected(uint64_t value, uint64_t interval) noexcept;
+
+    //! Merge the given histogram into the current one
+    /*!
+        \param histogram - Histogram to merge
+    */
+    void Merge(const LatencyHistogram& histogram) noexcept;
+
+    //! Get the value at the given percentile
+    /*!
+        \param percentile - Percentile in range [0, 100]
+        \return Upper bound of the bucket containing the given percentile
+    */
+    uint64_t Percentile(double percentile) const noexcept;
+
+    //! Reset the histogram
+    void Reset() noexcept;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const LatencyHistogram& histogram);
+
+private:
+    // Sub-buckets precision bits
+    static const int PRECISION = 7;
+    static const uint64_t SUB_BUCKETS = 1ull << PRECISION;
+    static const uint64_t HALF_BUCKETS = SUB_BUCKETS / 2;
+    static const size_t BUCKETS = (size_t)((64 - PRECISION + 2) * HALF_BUCKETS);
+
+    std::array<uint64_t, BUCKETS> _buckets;
+    uint64_t _count;
+    uint64_t _total;
+    uint64_t _min;
+    uint64_t _max;
+
+    static size_t Index(uint64_t value) noexcept;
+    static uint64_t UpperBound(size_t index) noexcept;
+};
+
+} // namespace Statistics
+} // namespace CppTrader
+
+#include "latency_histogram.inl"
+
+#endif // CPPTRADER_STATISTICS_LATENCY_HISTOGRAM_H
@@ -0,0 +1,128 @@
+/*!
+    \file latency_histogram.inl
+    \brief Latency histogram inline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace CppTrader {
+namespace Statistics {
+
+inline size_t LatencyHistogram::Index(uint64_t value) noexcept
+{
+    if (value < SUB_BUCKETS)
+        return (size_t)value;
+
+#if defined(_MSC_VER)
+    unsigned long msb;
+    _BitScanReverse64(&msb, value);
+#else
+    int msb = 63 - __builtin_clzll(value);
+#endif
+
+    // Keep PRECISION most significant bits of the value
+    int shift = (int)msb - PRECISION + 1;
+    return (size_t)(shift * HALF_BUCKETS + (value >> shift));
+}
+
+inline uint64_t LatencyHistogram::UpperBound(size_t index) noexcept
+{
+    if (index < SUB_BUCKETS)
+        return index;
+
+    uint64_t shift = index / HALF_BUCKETS - 1;
+    uint64_t mantissa = index - shift * HALF_BUCKETS;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+inline void LatencyHistogram::Record(uint64_t value, uint64_t count) noexcept
+{
+    _buckets[Index(value)] += count;
+    _count += count;
+    _total += value * count;
+    if (value < _min)
+        _min = value;
+    if (value > _max)
+        _max = value;
+}
+
+inline void LatencyHistogram::RecordCorrected(uint64_t value, uint64_t interval) noexcept
+{
+    Record(value);
+
+    if ((interval == 0) || (value <= interval))
+        return;
+
+    for (uint64_t missed = value - interval; missed >= interval; missed -= interval)
+        Record(missed);
+}
+
+inline void LatencyHistogram::Merge(const LatencyHistogram& histogram) noexcept
+{
+    for (size_t i = 0; i < BUCKETS; ++i)
+        _buckets[i] += histogram._buckets[i];
+    _count += histogram._count;
+    _total += histogram._total;
+    if (histogram._min < _min)
+        _min = histogram._min;
+    if (histogram._max > _max)
+        _max = histogram._max;
+}
+
+inline uint64_t LatencyHistogram::Percentile(double percentile) const noexcept
+{
+    if (_count == 0)
+        return 0;
+
+    if (percentile <= 0.0)
+        return _min;
+    if (percentile >= 100.0)
+        return _max;
+
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)_count + 0.5);
+    if (rank == 0)
+        rank = 1;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKETS; ++i)
+    {
+        total += _buckets[i];
+        if (total >= rank)
+            return std::min(std::max(UpperBound(i), _min), _max);
+    }
+
+    return _max;
+}
+
+inline void LatencyHistogram::Reset() noexcept
+{
+    _buckets.fill(0);
+    _count = 0;
+    _total = 0;
+    _min = std::numeric_limits<uint64_t>::max();
+    _max = 0;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const LatencyHistogram& histogram)
+{
+    stream << "LatencyHistogram(Count=" << histogram.count()
+        << "; Min=" << histogram.min()
+        << "; Mean=" << (uint64_t)histogram.mean()
+        << "; P50=" << histogram.Percentile(50.0)
+        << "; P90=" << histogram.Percentile(90.0)
+        << "; P99=" << histogram.Percentile(99.0)
+        << "; P99.9=" << histogram.Percentile(99.9)
+        << "; P99.99=" << histogram.Percentile(99.99)
+        << "; Max=" << histogram.max()
+        << ")";
+    return stream;
+}
+
+} // namespace Statistics
+} // namespace CppTrader
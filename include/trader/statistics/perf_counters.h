@@ -0,0 +1,264 @@
+/*!
+    \file perf_counters.h
+    \brief Hardware performance counters definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_STATISTICS_PERF_COUNTERS_H
+#define CPPTRADER_STATISTICS_PERF_COUNTERS_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace CppTrader {
+namespace Statistics {
+
+//! Hardware performance counter
+enum class PerfCounter : uint8_t
+{
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    LLC_MISSES,
+    BRANCH_MISSES,
+    DTLB_MISSES
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, PerfCounter counter);
+
+//! Count of hardware performance counters
+const size_t PERF_COUNTERS = (size_t)PerfCounter::DTLB_MISSES + 1;
+
+//! Hardware performance counters sample
+struct PerfSample
+{
+    //! Counter values (unavailable counters are always zero)
+    uint64_t Values[PERF_COUNTERS];
+
+    PerfSample() noexcept : Values() {}
+
+    //! Get the value of the given counter
+    uint64_t operator[](PerfCounter counter) const noexcept { return Values[(size_t)counter]; }
+};
+
+//! Hardware performance counters
+/*!
+    Hardware performance counters are opened with Linux perf_event_open()
+    as a single group for the calling thread, so all counters are scheduled
+    on the PMU together and read with a single read() system call. Only
+    user space events are counted, which is allowed with the default
+    kernel.perf_event_paranoid setting (2).
+
+    Counters which are not supported by the CPU or the hypervisor (e.g.
+    inside virtual machines) are skipped, so check available() before
+    reporting them. On other platforms Open() always fails.
+
+    Not thread-safe.
+*/
+class PerfCounters
+{
+public:
+    PerfCounters() noexcept;
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters(PerfCounters&&) = delete;
+    ~PerfCounters() { Close(); }
+
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    PerfCounters& operator=(PerfCounters&&) = delete;
+
+    //! Are counters opened?
+    bool opened() const noexcept { return _count > 0; }
+    //! Is the given counter available?
+    bool available(PerfCounter counter) const noexcept { return _positions[(size_t)counter] < PERF_COUNTERS; }
+
+    //! Open and start all available counters for the calling thread
+    /*!
+        \return 'true' if at least one counter was opened, 'false' if no counters are available
+    */
+    bool Open();
+    //! Stop and close all counters
+    void Close();
+
+    //! Read the current values of all counters
+    /*!
+        \param sample - Sample to fill
+        \return 'true' if counters were read, 'false' if counters are not opened or were not scheduled on the PMU
+    */
+    bool Read(PerfSample& sample) const noexcept;
+
+private:
+    int _leader;
+    int _fds[PERF_COUNTERS];
+    size_t _positions[PERF_COUNTERS];
+    size_t _count;
+};
+
+//! Hardware performance counters region summary (average values per region)
+struct PerfRegionSummary
+{
+    //! Region name
+    std::string Region;
+    //! Count of recorded regions
+    uint64_t Count;
+    //! Average counter values
+    double Values[PERF_COUNTERS];
+    //! Average instructions per cycle
+    double IPC;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const PerfRegionSummary& summary);
+};
+
+//! Hardware performance counters profile
+/*!
+    Profile accumulates counter deltas of the named code regions (e.g.
+    market manager operations) measured with PerfScope. Each region could
+    be enabled or disabled at runtime, disabled regions cost only a branch.
+
+    Reading counters is a system call (hundreds of nanoseconds), so the
+    profile is suitable for attributing cache and branch behaviour of
+    operations rather than for measuring their latency. Nested regions are
+    recorded separately and the outer region also counts the inner reads.
+
+    Not thread-safe.
+*/
+class PerfProfile
+{
+public:
+    //! Initialize the profile with given region names
+    /*!
+        All regions are enabled by default.
+
+        \param regions - Region names
+    */
+    explicit PerfProfile(const std::vector<std::string>& regions);
+    PerfProfile(const PerfProfile&) = delete;
+    PerfProfile(PerfProfile&&) = delete;
+    ~PerfProfile() = default;
+
+    PerfProfile& operator=(const PerfProfile&) = delete;
+    PerfProfile& operator=(PerfProfile&&) = delete;
+
+    //! Get the hardware performance counters
+    const PerfCounters& counters() const noexcept { return _counters; }
+    //! Is the profile opened?
+    bool opened() const noexcept { return _counters.opened(); }
+
+    //! Get the count of regions
+    size_t regions() const noexcept { return _regions.size(); }
+    //! Get the name of the given region
+    const std::string& name(size_t region) const noexcept { return _regions[region].Name; }
+    //! Is the given region enabled?
+    bool enabled(size_t region) const noexcept { return _regions[region].Enabled; }
+    //! Get the count of recorded given regions
+    uint64_t count(size_t region) const noexcept { return _regions[region].Count; }
+    //! Get the total value of the counter in the given region
+    uint64_t total(size_t region, PerfCounter counter) const noexcept { return _regions[region].Totals[(size_t)counter]; }
+
+    //! Open counters for the calling thread
+    /*!
+        Regions should be measured in the same thread.
+
+        \return 'true' if at least one counter was opened, 'false' if no counters are available
+    */
+    bool Open() { return _counters.Open(); }
+    //! Close counters
+    void Close() { _counters.Close(); }
+
+    //! Enable or disable the given region
+    /*!
+        \param region - Region index
+        \param enable - Enable flag (default is true)
+    */
+    void Enable(size_t region, bool enable = true) noexcept { _regions[region].Enabled = enable; }
+    //! Enable or disable all regions
+    /*!
+        \param enable - Enable flag (default is true)
+    */
+    void EnableAll(bool enable = true) noexcept;
+
+    //! Record counter deltas of the given region
+    /*!
+        \param region - Region index
+        \param start - Sample at the region start
+        \param stop - Sample at the region stop
+    */
+    void Record(size_t region, const PerfSample& start, const PerfSample& stop) noexcept;
+
+    //! Get the summary of the given region
+    /*!
+        \param region - Region index
+        \return Region summary with average counter values
+    */
+    PerfRegionSummary Summary(size_t region) const;
+
+    //! Reset all recorded values
+    void Reset() noexcept;
+
+    //! Dump summaries of all recorded regions
+    /*!
+        Each recorded region is dumped into a separate line.
+
+        \param stream - Output stream
+    */
+    template <class TOutputStream>
+    void Dump(TOutputStream& stream) const;
+
+private:
+    struct Region
+    {
+        std::string Name;
+        bool Enabled;
+        uint64_t Count;
+        uint64_t Totals[PERF_COUNTERS];
+    };
+
+    PerfCounters _counters;
+    std::vector<Region> _regions;
+};
+
+//! Hardware performance counters scope
+/*!
+    Records counter deltas of the current scope into the given profile
+    region. Nothing is read if the profile is not opened or the region
+    is disabled.
+*/
+class PerfScope
+{
+public:
+    PerfScope(PerfProfile& profile, size_t region) noexcept
+        : _profile(profile), _region(region), _active(profile.opened() && profile.enabled(region))
+    {
+        if (_active)
+            _active = _profile.counters().Read(_start);
+    }
+    PerfScope(const PerfScope&) = delete;
+    PerfScope(PerfScope&&) = delete;
+    ~PerfScope() noexcept
+    {
+        PerfSample stop;
+        if (_active && _profile.counters().Read(stop))
+            _profile.Record(_region, _start, stop);
+    }
+
+    PerfScope& operator=(const PerfScope&) = delete;
+    PerfScope& operator=(PerfScope&&) = delete;
+
+private:
+    PerfProfile& _profile;
+    size_t _region;
+    bool _active;
+    PerfSample _start;
+};
+
+} // namespace Statistics
+} // namespace CppTrader
+
+#include "perf_counters.inl"
+
+#endif // CPPTRADER_STATISTICS_PERF_COUNTERS_H
@@ -0,0 +1,110 @@
+/*!
+    \file perf_counters.inl
+    \brief Hardware performance counters inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Statistics {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, PerfCounter counter)
+{
+    switch (counter)
+    {
+        case PerfCounter::CYCLES:
+            stream << "Cycles";
+            break;
+        case PerfCounter::INSTRUCTIONS:
+            stream << "Instructions";
+            break;
+        case PerfCounter::L1D_MISSES:
+            stream << "L1DMisses";
+            break;
+        case PerfCounter::LLC_MISSES:
+            stream << "LLCMisses";
+            break;
+        case PerfCounter::BRANCH_MISSES:
+            stream << "BranchMisses";
+            break;
+        case PerfCounter::DTLB_MISSES:
+            stream << "DTLBMisses";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const PerfRegionSummary& summary)
+{
+    stream << "PerfRegionSummary(Region=" << summary.Region
+        << "; Count=" << summary.Count;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+        stream << "; " << (PerfCounter)i << "=" << summary.Values[i];
+    stream << "; IPC=" << summary.IPC
+        << ")";
+    return stream;
+}
+
+inline PerfProfile::PerfProfile(const std::vector<std::string>& regions)
+{
+    _regions.resize(regions.size());
+    for (size_t i = 0; i < regions.size(); ++i)
+        _regions[i].Name = regions[i];
+    EnableAll();
+    Reset();
+}
+
+inline void PerfProfile::EnableAll(bool enable) noexcept
+{
+    for (auto& region : _regions)
+        region.Enabled = enable;
+}
+
+inline void PerfProfile::Record(size_t region, const PerfSample& start, const PerfSample& stop) noexcept
+{
+    Region& current = _regions[region];
+    ++current.Count;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+        current.Totals[i] += stop.Values[i] - start.Values[i];
+}
+
+inline PerfRegionSummary PerfProfile::Summary(size_t region) const
+{
+    const Region& current = _regions[region];
+
+    PerfRegionSummary summary;
+    summary.Region = current.Name;
+    summary.Count = current.Count;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+        summary.Values[i] = (current.Count > 0) ? ((double)current.Totals[i] / (double)current.Count) : 0.0;
+    uint64_t cycles = current.Totals[(size_t)PerfCounter::CYCLES];
+    summary.IPC = (cycles > 0) ? ((double)current.Totals[(size_t)PerfCounter::INSTRUCTIONS] / (double)cycles) : 0.0;
+    return summary;
+}
+
+inline void PerfProfile::Reset() noexcept
+{
+    for (auto& region : _regions)
+    {
+        region.Count = 0;
+        for (auto& total : region.Totals)
+            total = 0;
+    }
+}
+
+template <class TOutputStream>
+inline void PerfProfile::Dump(TOutputStream& stream) const
+{
+    for (size_t i = 0; i < regions(); ++i)
+        if (count(i) > 0)
+            stream << Summary(i) << std::endl;
+}
+
+} // namespace Statistics
+} // namespace CppTrader
@@ -0,0 +1,58 @@
+/*!
+    \file tsc_clock.h
+    \brief Time stamp counter clock definition
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_STATISTICS_TSC_CLOCK_H
+#define CPPTRADER_STATISTICS_TSC_CLOCK_H
+
+#include "time/timestamp.h"
+
+#include <cstdint>
+
+namespace CppTrader {
+namespace Statistics {
+
+//! Time stamp counter clock
+/*!
+    Time stamp counter clock reads CPU ticks with CppCommon::Timestamp::rdts()
+    which costs a few nanoseconds, so it could be used to measure very short
+    operations. Ticks are converted into nanoseconds with the frequency
+    calibrated against the monotonic clock on the first conversion. Invariant
+    TSC (all modern x86 CPUs) is expected.
+
+    Thread-safe.
+*/
+class TscClock
+{
+public:
+    TscClock() = delete;
+    TscClock(const TscClock&) = delete;
+    TscClock(TscClock&&) = delete;
+    ~TscClock() = delete;
+
+    TscClock& operator=(const TscClock&) = delete;
+    TscClock& operator=(TscClock&&) = delete;
+
+    //! Get the current CPU ticks
+    static uint64_t ticks() noexcept { return CppCommon::Timestamp::rdts(); }
+
+    //! Get the count of nanoseconds in one CPU tick
+    static double nanoseconds_per_tick();
+
+    //! Convert the given CPU ticks into nanoseconds
+    static uint64_t ToNanoseconds(uint64_t ticks) { return (uint64_t)((double)ticks * nanoseconds_per_tick()); }
+
+private:
+    static double Calibrate();
+};
+
+} // namespace Statistics
+} // namespace CppTrader
+
+#include "tsc_clock.inl"
+
+#endif // CPPTRADER_STATISTICS_TSC_CLOCK_H
@@ -0,0 +1,35 @@
+/*!
+    \file tsc_clock.inl
+    \brief Time stamp counter clock inline implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Statistics {
+
+inline double TscClock::nanoseconds_per_tick()
+{
+    static const double result = Calibrate();
+    return result;
+}
+
+inline double TscClock::Calibrate()
+{
+    // Spin for 10 milliseconds of the monotonic clock and count CPU ticks
+    uint64_t nano_start = CppCommon::Timestamp::nano();
+    uint64_t ticks_start = ticks();
+    uint64_t nano_stop;
+    do
+    {
+        nano_stop = CppCommon::Timestamp::nano();
+    } while ((nano_stop - nano_start) < 10000000);
+    uint64_t ticks_stop = ticks();
+
+    uint64_t elapsed = ticks_stop - ticks_start;
+    return (elapsed > 0) ? ((double)(nano_stop - nano_start) / (double)elapsed) : 1.0;
+}
+
+} // namespace Statistics
+} // namespace CppTrader
@@ -0,0 +1,119 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "trader/providers/nasdaq/itch_batch.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(4096).help("Message batch capacity. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    ITCHHandler itch_handler;
+    MessageBatch batch((size_t)options.get("batch"));
+
+    // Open the input file or stdin
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input"))
+    {
+        File* file = new File(Path(options.get("input")));
+        file->Open(true, false);
+        input.reset(file);
+    }
+
+    size_t total_messages = 0;
+    size_t total_batches = 0;
+    size_t total_errors = 0;
+    uint64_t add_shares = 0;
+    uint64_t add_notional = 0;
+    uint64_t executed_shares = 0;
+    uint64_t canceled_shares = 0;
+
+    // Perform input
+    size_t size;
+    size_t pending = 0;
+    std::vector<uint8_t> buffer(1024 * 1024);
+    std::cout << "ITCH batch decoding...";
+    uint64_t timestamp_start = Timestamp::nano();
+    while ((size = input->Read(buffer.data() + pending, buffer.size() - pending)) > 0)
+    {
+        size += pending;
+
+        // Decode the buffer in batches
+        size_t offset = 0;
+        size_t consumed;
+        do
+        {
+            batch.Clear();
+            consumed = itch_handler.Decode(buffer.data() + offset, size - offset, batch);
+            offset += consumed;
+
+            // Type-homogeneous column loops
+            const AddOrderBatch& adds = batch.AddOrders;
+            for (size_t i = 0; i < adds.Count; ++i)
+            {
+                add_shares += adds.Shares[i];
+                add_notional += (uint64_t)adds.Shares[i] * adds.Price[i];
+            }
+            const OrderExecutedBatch& executions = batch.OrderExecutions;
+            for (size_t i = 0; i < executions.Count; ++i)
+                executed_shares += executions.ExecutedShares[i];
+            const OrderCancelBatch& cancels = batch.OrderCancels;
+            for (size_t i = 0; i < cancels.Count; ++i)
+                canceled_shares += cancels.CanceledShares[i];
+
+            total_messages += batch.size();
+            total_errors += batch.Errors;
+            total_batches += batch.empty() ? 0 : 1;
+        } while (consumed > 0);
+
+        // Keep the incomplete message for the next read
+        pending = size - offset;
+        std::memmove(buffer.data(), buffer.data() + offset, pending);
+    }
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+    std::cout << "Added shares: " << add_shares << std::endl;
+    std::cout << "Added notional: " << add_notional << std::endl;
+    std::cout << "Executed shares: " << executed_shares << std::endl;
+    std::cout << "Canceled shares: " << canceled_shares << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total ITCH batches: " << total_batches << std::endl;
+    std::cout << "Total ITCH messages: " << total_messages << std::endl;
+    std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(total_messages, (size_t)1)) << std::endl;
+    std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+
+    return 0;
+}
@@ -71,6 +71,11 @@ int main(int argc, char** argv)
 
     MyITCHHandler itch_handler;
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+    if (!itch_handler.perf_profile().Open())
+        std::cerr << "Hardware performance counters are not available!" << std::endl;
+#endif
+
     // Open the input file or stdin
     std::unique_ptr<Reader> input(new StdInput());
     if (options.is_set("input"))
@@ -106,5 +111,12 @@ int main(int argc, char** argv)
     std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
     std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+    std::cout << std::endl;
+
+    std::cout << "ITCH message hardware performance counters (per message): " << std::endl;
+    itch_handler.perf_profile().Dump(std::cout);
+#endif
+
     return 0;
 }
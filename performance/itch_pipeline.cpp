@@ -0,0 +1,118 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "trader/pipeline/itch_pipeline.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Pipeline;
+using namespace CppTrader::Statistics;
+
+void PrintStage(const std::string& name, const PipelineStage& stage)
+{
+    auto print = [](const std::string& title, const LatencyHistogram& histogram)
+    {
+        std::cout << "  " << title << ": "
+            << "p50=" << CppBenchmark::ReporterConsole::GenerateTimePeriod(histogram.Percentile(50.0))
+            << "; p99=" << CppBenchmark::ReporterConsole::GenerateTimePeriod(histogram.Percentile(99.0))
+            << "; p99.9=" << CppBenchmark::ReporterConsole::GenerateTimePeriod(histogram.Percentile(99.9))
+            << "; max=" << CppBenchmark::ReporterConsole::GenerateTimePeriod(histogram.max())
+            << std::endl;
+    };
+
+    std::cout << name << ": items=" << stage.Items << "; stalls=" << stage.Stalls << std::endl;
+    print("Queueing", stage.Queueing);
+    print("Service", stage.Service);
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-p", "--pcap").dest("pcap").action("store_true").help("Input is pcap/pcapng capture of MoldUDP64 packets");
+    parser.add_option("-c", "--consumers").dest("consumers").action("store").type("int").set_default(1).help("Count of consumer threads. Default: %default");
+    parser.add_option("-b", "--busy").dest("busy").action("store_true").help("Busy poll queues instead of back-off");
+    parser.add_option("-a", "--affinity").dest("affinity").help("Comma separated CPU cores for reader, parser, book builder and consumer threads");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    PipelineSettings settings;
+    settings.Format = options.get("pcap") ? InputFormat::PCAP : InputFormat::ITCH;
+    settings.Consumers = (size_t)std::max((int)options.get("consumers"), 1);
+    settings.Wait = options.get("busy") ? WaitPolicy::BUSY_POLL : WaitPolicy::BACKOFF;
+    if (options.is_set("affinity"))
+    {
+        std::vector<int> cores;
+        std::stringstream ss(options.get("affinity"));
+        std::string core;
+        while (std::getline(ss, core, ','))
+            cores.push_back(std::stoi(core));
+        if (cores.size() > 0) settings.ReaderCore = cores[0];
+        if (cores.size() > 1) settings.ParserCore = cores[1];
+        if (cores.size() > 2) settings.BookCore = cores[2];
+        if (cores.size() > 3) settings.ConsumerCores.assign(cores.begin() + 3, cores.end());
+    }
+
+    MarketManager market;
+    ITCHPipeline pipeline(market, settings);
+
+    // Open the input file or stdin
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input"))
+    {
+        File* file = new File(Path(options.get("input")));
+        file->Open(true, false);
+        input.reset(file);
+    }
+
+    // Perform input
+    std::cout << "ITCH pipeline processing...";
+    uint64_t timestamp_start = Timestamp::nano();
+    bool result = pipeline.Run(*input);
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << (result ? "Done!" : "Failed!") << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << pipeline.errors() << std::endl;
+
+    std::cout << std::endl;
+
+    size_t total_messages = pipeline.messages();
+
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total bytes: " << pipeline.bytes() << std::endl;
+    std::cout << "Total ITCH messages: " << total_messages << std::endl;
+    std::cout << "ITCH message throughput: " << total_messages * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " msg/s" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Pipeline stages: " << std::endl;
+    PrintStage("Reader", pipeline.reader());
+    PrintStage("Parser", pipeline.parser());
+    PrintStage("Book builder", pipeline.book());
+    for (size_t i = 0; i < settings.Consumers; ++i)
+        PrintStage("Consumer " + std::to_string(i), pipeline.consumer(i));
+
+    return result ? 0 : -1;
+}
@@ -0,0 +1,198 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/matching/market_manager.h"
+#include "trader/statistics/benchmark_report.h"
+
+#include "time/timestamp.h"
+
+// kdb+ C API macros (e.g. R) clash with the names used in other headers
+#include "trader/kdb_loader.h"
+
+#include <OptionParser.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace CppCommon;
+using namespace CppTrader;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Risk;
+using namespace CppTrader::Statistics;
+
+// Build the kdb+ table of the given named columns of the given rows count
+K Table(const std::vector<std::pair<const char*, int>>& schema, size_t rows)
+{
+    K names = ktn(KS, 0);
+    K columns = ktn(0, 0);
+    for (const auto& column : schema)
+    {
+        js(&names, ss((S)column.first));
+        jk(&columns, ktn(column.second, (J)rows));
+    }
+    return xT(xD(names, columns));
+}
+
+// Get the column vector data of the table
+template <typename T>
+T* Column(K table, const char* name)
+{
+    return (T*)kG(KdbTable(table).column(name));
+}
+
+// Load result
+struct LoadResult
+{
+    std::string Name;
+    uint64_t Duration;
+    uint64_t Rows;
+    bool Valid;
+
+    double throughput() const noexcept { return (double)Rows * 1000000000.0 / (double)std::max(Duration, (uint64_t)1); }
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-o", "--orders").dest("orders").action("store").type("int").set_default(1000000).help("Count of resting orders. Default: %default");
+    parser.add_option("-p", "--positions").dest("positions").action("store").type("int").set_default(1000000).help("Count of positions. Default: %default");
+    parser.add_option("-s", "--symbols").dest("symbols").action("store").type("int").set_default(64).help("Count of symbols. Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    size_t order_count = (size_t)std::max((int)options.get("orders"), 1);
+    size_t position_count = (size_t)std::max((int)options.get("positions"), 1);
+    size_t symbol_count = (size_t)std::min(std::max((int)options.get("symbols"), 1), 32767);
+
+    khp((S)"", -1);
+
+    // Prepare tables as they are received from kdb+
+    std::cout << "Preparing tables...";
+    K symbols = Table({ { "Id", KH }, { "Time", KJ }, { "Name", KS }, { "Type", KH }, { "Multiplier", KJ }, { "QuantityDivisor", KJ } }, symbol_count);
+    for (size_t i = 0; i < symbol_count; ++i)
+    {
+        std::string name = "SYM" + std::to_string(i);
+        Column<H>(symbols, "Id")[i] = (H)i;
+        Column<J>(symbols, "Time")[i] = 0;
+        Column<S>(symbols, "Name")[i] = ss((S)name.c_str());
+        Column<H>(symbols, "Type")[i] = (H)SymbolType::VANILLAPERP;
+        Column<J>(symbols, "Multiplier")[i] = 1000;
+        Column<J>(symbols, "QuantityDivisor")[i] = 10;
+    }
+
+    K positions = Table({ { "Id", KJ }, { "SymbolId", KH }, { "AvgEntryPrice", KF }, { "Quantity", KJ }, { "Side", KH }, { "Time", KJ },
+                          { "AccountId", KJ }, { "RiskZ", KF }, { "RiskC", KF }, { "Funding", KF }, { "MarkPrice", KJ }, { "IndexPrice", KJ },
+                          { "RealizedPnL", KF }, { "UnrealizedPnL", KF }, { "FundingTime", KJ } }, position_count);
+    for (size_t i = 0; i < position_count; ++i)
+    {
+        Column<J>(positions, "Id")[i] = (J)(i + 1);
+        Column<H>(positions, "SymbolId")[i] = (H)(i % symbol_count);
+        Column<F>(positions, "AvgEntryPrice")[i] = 1000.0 + (double)(i % 100);
+        Column<J>(positions, "Quantity")[i] = (J)(i % 10);
+        Column<H>(positions, "Side")[i] = (H)(i % 2);
+        Column<J>(positions, "Time")[i] = 0;
+        Column<J>(positions, "AccountId")[i] = (J)(i / symbol_count);
+        Column<F>(positions, "RiskZ")[i] = 0.0;
+        Column<F>(positions, "RiskC")[i] = 0.0;
+        Column<F>(positions, "Funding")[i] = 0.0;
+        Column<J>(positions, "MarkPrice")[i] = 1000;
+        Column<J>(positions, "IndexPrice")[i] = 1000;
+        Column<F>(positions, "RealizedPnL")[i] = 0.0;
+        Column<F>(positions, "UnrealizedPnL")[i] = 0.0;
+        Column<J>(positions, "FundingTime")[i] = 0;
+    }
+
+    K orders = Table({ { "Id", KJ }, { "SymbolId", KH }, { "ExecutedQuantity", KJ }, { "LeavesQuantity", KJ }, { "MaxVisibleQuantity", KJ },
+                       { "Price", KJ }, { "Quantity", KJ }, { "Side", KH }, { "Slippage", KJ }, { "StopPrice", KJ }, { "TimeInForce", KH },
+                       { "TrailingDistance", KJ }, { "TrailingStep", KJ }, { "Type", KH }, { "Time", KJ }, { "AccountId", KJ },
+                       { "CurrentExecutedPrice", KJ }, { "CurrentExecutedQuantity", KJ }, { "Status", KH } }, order_count);
+    for (size_t i = 0; i < order_count; ++i)
+    {
+        // Bids are below asks, so restored order books are not crossed
+        bool buy = ((i % 2) == 0);
+        Column<J>(orders, "Id")[i] = (J)(i + 1);
+        Column<H>(orders, "SymbolId")[i] = (H)(i % symbol_count);
+        Column<J>(orders, "ExecutedQuantity")[i] = 0;
+        Column<J>(orders, "LeavesQuantity")[i] = (J)(10 + (i % 10));
+        Column<J>(orders, "MaxVisibleQuantity")[i] = (J)ORDER_INT_MAX;
+        Column<J>(orders, "Price")[i] = (J)(buy ? (1000 - (i % 100)) : (1001 + (i % 100)));
+        Column<J>(orders, "Quantity")[i] = (J)(10 + (i % 10));
+        Column<H>(orders, "Side")[i] = (H)(buy ? OrderSide::BUY : OrderSide::SELL);
+        Column<J>(orders, "Slippage")[i] = (J)ORDER_INT_MAX;
+        Column<J>(orders, "StopPrice")[i] = 0;
+        Column<H>(orders, "TimeInForce")[i] = (H)OrderTimeInForce::GTC;
+        Column<J>(orders, "TrailingDistance")[i] = 0;
+        Column<J>(orders, "TrailingStep")[i] = 0;
+        Column<H>(orders, "Type")[i] = (H)OrderType::LIMIT;
+        Column<J>(orders, "Time")[i] = 0;
+        Column<J>(orders, "AccountId")[i] = (J)(i % 1000);
+        Column<J>(orders, "CurrentExecutedPrice")[i] = 0;
+        Column<J>(orders, "CurrentExecutedQuantity")[i] = 0;
+        Column<H>(orders, "Status")[i] = (H)OrderStatus::PENDING;
+    }
+    std::cout << "Done!" << std::endl;
+
+    MarketManager market;
+    PositionBook book;
+
+    std::vector<LoadResult> results;
+    auto run = [&](const std::string& name, size_t rows, const std::function<int64_t()>& load)
+    {
+        std::cout << "Loading " << name << "...";
+        uint64_t timestamp_start = Timestamp::nano();
+        int64_t loaded = load();
+        uint64_t timestamp_stop = Timestamp::nano();
+        results.push_back(LoadResult{ name, timestamp_stop - timestamp_start, rows, loaded == (int64_t)rows });
+        std::cout << "Done!" << std::endl;
+    };
+
+    run("symbols", symbol_count, [&]() { return KdbLoader::LoadSymbols(symbols, market); });
+    run("positions", position_count, [&]() { return KdbLoader::LoadPositions(positions, book); });
+    run("orders", order_count, [&]() { return KdbLoader::LoadOrders(orders, market); });
+
+    r0(orders);
+    r0(positions);
+    r0(symbols);
+
+    std::cout << std::endl;
+    std::cout << "kdb+ startup load statistics: " << std::endl;
+    std::cout << std::setw(10) << "Table" << std::setw(12) << "Rows" << std::setw(14) << "Time, ms" << std::setw(16) << "Throughput" << std::setw(14) << "Row latency" << std::setw(10) << "Valid" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::setw(10) << result.Name << std::setw(12) << result.Rows
+            << std::setw(14) << std::fixed << std::setprecision(1) << (double)result.Duration / 1000000.0
+            << std::setw(16) << (uint64_t)result.throughput() << std::setw(14) << (double)result.Duration / (double)result.Rows
+            << std::setw(10) << (result.Valid ? "yes" : "no") << std::defaultfloat << std::endl;
+    }
+
+    bool valid = true;
+    for (const auto& result : results)
+        valid = valid && result.Valid;
+    if (!valid)
+        std::cerr << "Not all rows were loaded!" << std::endl;
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("kdb_loader");
+        for (const auto& result : results)
+            report.Add(result.Name + "_throughput", result.throughput(), "rows/s", MetricDirection::HIGHER_IS_BETTER);
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return valid ? 0 : -1;
+}
@@ -0,0 +1,234 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/matching/order.h"
+#include "trader/statistics/benchmark_report.h"
+
+#include "time/timestamp.h"
+
+// kdb+ C API macros (e.g. R) clash with the names used in other headers
+#include "trader/kdb_ipc.h"
+#include "trader/kdb_server.h"
+#include "trader/kdb_sink.h"
+
+#include <OptionParser.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace CppCommon;
+using namespace CppTrader;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+// Order log row
+struct OrderRow
+{
+    Order Data;
+    uint64_t Time;
+};
+
+uint64_t order_id(const OrderRow& row) { return row.Data.Id; }
+uint32_t order_symbol_id(const OrderRow& row) { return row.Data.SymbolId; }
+uint8_t order_side(const OrderRow& row) { return (uint8_t)row.Data.Side; }
+uint8_t order_type(const OrderRow& row) { return (uint8_t)row.Data.Type; }
+uint64_t order_price(const OrderRow& row) { return row.Data.Price; }
+uint64_t order_quantity(const OrderRow& row) { return row.Data.Quantity; }
+uint64_t order_executed_quantity(const OrderRow& row) { return row.Data.ExecutedQuantity; }
+uint64_t order_leaves_quantity(const OrderRow& row) { return row.Data.LeavesQuantity; }
+
+// Order log columns
+template <template <typename, typename...> class TColumns>
+using OrderColumns = TColumns<OrderRow,
+    KdbField<KJ, &order_id>,
+    KdbField<KH, &order_symbol_id>,
+    KdbField<KH, &order_side>,
+    KdbField<KH, &order_type>,
+    KdbField<KJ, &order_price>,
+    KdbField<KJ, &order_quantity>,
+    KdbField<KJ, &order_executed_quantity>,
+    KdbField<KJ, &order_leaves_quantity>,
+    KdbField<KJ, &OrderRow::Time>>;
+
+typedef OrderColumns<KdbColumnBatch> OrdersBatch;
+typedef OrderColumns<KdbIpcMessage> OrdersMessage;
+
+// Build kdb+ columns object by object (the original orders_prep() way)
+K orders_objects(const std::vector<OrderRow>& rows)
+{
+    J n = (J)rows.size();
+    K ids = ktn(KJ, n), symbols = ktn(KH, n), sides = ktn(KH, n), types = ktn(KH, n), prices = ktn(KJ, n);
+    K quantities = ktn(KJ, n), executed = ktn(KJ, n), leaves = ktn(KJ, n), times = ktn(KJ, n);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        const Order& order = rows[i].Data;
+        kJ(ids)[i] = order.Id;
+        kH(symbols)[i] = order.SymbolId;
+        kH(sides)[i] = (uint8_t)order.Side;
+        kH(types)[i] = (uint8_t)order.Type;
+        kJ(prices)[i] = order.Price;
+        kJ(quantities)[i] = order.Quantity;
+        kJ(executed)[i] = order.ExecutedQuantity;
+        kJ(leaves)[i] = order.LeavesQuantity;
+        kJ(times)[i] = rows[i].Time;
+    }
+    return knk(9, ids, symbols, sides, types, prices, quantities, executed, leaves, times);
+}
+
+// Persistence path result (end-to-end until the server has received all rows and in the client only)
+struct PathResult
+{
+    std::string Name;
+    uint64_t Duration;
+    uint64_t Client;
+    uint64_t Rows;
+    bool Valid;
+
+    double throughput() const noexcept { return (double)Rows * 1000000000.0 / (double)std::max(Duration, (uint64_t)1); }
+    double client_throughput() const noexcept { return (double)Rows * 1000000000.0 / (double)std::max(Client, (uint64_t)1); }
+};
+
+// Wait until the server has received all rows (synchronous count query)
+bool Sync(I handle, uint64_t rows)
+{
+    K result = k(handle, (S)"count orders", (K)0);
+    bool valid = (result != nullptr) && (result->t == -KJ) && ((uint64_t)result->j == rows);
+    if (result != nullptr)
+        r0(result);
+    return valid;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-n", "--rows").dest("rows").action("store").type("int").set_default(1000000).help("Count of persisted order rows for each path. Default: %default");
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(10000).help("Count of rows in a single insert. Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    size_t count = (size_t)std::max((int)options.get("rows"), 1);
+    size_t batch_size = (size_t)std::max((int)options.get("batch"), 1);
+
+    // Prepare order rows
+    std::vector<OrderRow> rows;
+    rows.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        rows.push_back(OrderRow{ Order::Limit(i + 1, (uint32_t)(i % 64), ((i % 2) == 0) ? OrderSide::BUY : OrderSide::SELL, 1000 + (i % 100), 10 + (i % 10)), i });
+
+    // Start the local kdb+ stand-in server
+    KdbServer server;
+    if (!server.Start())
+    {
+        std::cerr << "Failed to start the kdb+ stand-in server!" << std::endl;
+        return -1;
+    }
+    I handle = khpu((S)"localhost", server.port(), (S)"");
+    if (handle <= 0)
+    {
+        std::cerr << "Failed to connect to the kdb+ stand-in server!" << std::endl;
+        return -1;
+    }
+    Kdbp kdb(handle);
+
+    OrdersBatch orders_batch(batch_size);
+    OrdersMessage orders_message("insert", "orders", 1024 * 1024);
+
+    std::vector<PathResult> results;
+    uint64_t total = 0;
+    auto run = [&](const std::string& name, const std::function<void(const std::vector<OrderRow>&)>& ship)
+    {
+        std::cout << "Persisting orders with " << name << "...";
+        std::vector<OrderRow> batch;
+        batch.reserve(batch_size);
+        uint64_t timestamp_start = Timestamp::nano();
+        for (size_t i = 0; i < rows.size(); i += batch_size)
+        {
+            batch.assign(rows.begin() + i, rows.begin() + std::min(i + batch_size, rows.size()));
+            ship(batch);
+        }
+        uint64_t timestamp_client = Timestamp::nano();
+        total += rows.size();
+        bool valid = Sync(handle, total);
+        uint64_t timestamp_stop = Timestamp::nano();
+        results.push_back(PathResult{ name, timestamp_stop - timestamp_start, timestamp_client - timestamp_start, rows.size(), valid });
+        std::cout << "Done!" << std::endl;
+    };
+
+    run("objects", [&](const std::vector<OrderRow>& batch) { kdb.insertMultRow("insert", "orders", orders_objects(batch)); });
+    run("batch", [&](const std::vector<OrderRow>& batch) { kdb.insertMultRow("insert", "orders", orders_batch.Emit(batch)); });
+    run("ipc", [&](const std::vector<OrderRow>& batch) { orders_message.Send(handle, batch); });
+
+    // kdb+ sink producer with the writer thread shipping IPC messages over its own connection
+    {
+        I sink_handle = khpu((S)"localhost", server.port(), (S)"");
+        KdbSinkSettings settings;
+        settings.BatchSize = batch_size;
+        KdbSink sink(settings);
+        OrdersMessage sink_message("insert", "orders", 1024 * 1024);
+        auto& table = sink.AddTable<OrderRow>("orders", [&](const std::vector<OrderRow>& batch) { return sink_message.Send(sink_handle, batch); });
+        sink.Start();
+
+        std::cout << "Persisting orders with sink...";
+        uint64_t timestamp_start = Timestamp::nano();
+        for (const auto& row : rows)
+            table.Push(row);
+        uint64_t timestamp_client = Timestamp::nano();
+        sink.Stop();
+        total += rows.size();
+        bool valid = Sync(sink_handle, total);
+        uint64_t timestamp_stop = Timestamp::nano();
+        results.push_back(PathResult{ "sink", timestamp_stop - timestamp_start, timestamp_client - timestamp_start, rows.size(), valid });
+        std::cout << "Done!" << std::endl;
+
+        kclose(sink_handle);
+    }
+
+    kclose(handle);
+    server.Stop();
+
+    std::cout << std::endl;
+    std::cout << "kdb+ persistence statistics (" << batch_size << " rows per insert): " << std::endl;
+    std::cout << std::setw(10) << "Path" << std::setw(16) << "Throughput" << std::setw(14) << "Row latency" << std::setw(16) << "Client" << std::setw(14) << "Client row" << std::setw(10) << "Valid" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::setw(10) << result.Name << std::setw(16) << (uint64_t)result.throughput()
+            << std::setw(14) << std::fixed << std::setprecision(1) << (double)result.Duration / (double)result.Rows
+            << std::setw(16) << (uint64_t)result.client_throughput() << std::setw(14) << (double)result.Client / (double)result.Rows
+            << std::setw(10) << (result.Valid ? "yes" : "no") << std::defaultfloat << std::endl;
+    }
+    std::cout << "Server: " << server.stats() << std::endl;
+
+    bool valid = true;
+    for (const auto& result : results)
+        valid = valid && result.Valid;
+    if (!valid)
+        std::cerr << "kdb+ stand-in server did not receive all rows!" << std::endl;
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("kdb_persistence");
+        for (const auto& result : results)
+        {
+            report.Add(result.Name + "_throughput", result.throughput(), "rows/s", MetricDirection::HIGHER_IS_BETTER);
+            report.Add(result.Name + "_client_throughput", result.client_throughput(), "rows/s", MetricDirection::HIGHER_IS_BETTER);
+        }
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return valid ? 0 : -1;
+}
@@ -2,6 +2,8 @@
 // Created by Ivan Shynkarenka on 05.08.2017
 //
 
+#include "market_report.h"
+
 #include "trader/matching/market_manager.h"
 #include "trader/providers/nasdaq/itch_handler.h"
 
@@ -12,9 +14,12 @@
 
 #include <OptionParser.h>
 
+#include <sstream>
+
 using namespace CppCommon;
 using namespace CppTrader::ITCH;
 using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
 
 class MyMarketHandler : public MarketHandler
 {
@@ -123,6 +128,10 @@ int main(int argc, char** argv)
     auto parser = optparse::OptionParser().version("1.0.0.0");
 
     parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+#if defined(CPPTRADER_PERF_COUNTERS)
+    parser.add_option("-r", "--regions").dest("regions").help("Comma separated market operations to profile with hardware performance counters (e.g. ADD_LIMIT,MATCH_ORDER). Default: all");
+#endif
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -137,6 +146,22 @@ int main(int argc, char** argv)
     MarketManager market(market_handler);
     MyITCHHandler itch_handler(market);
 
+#if defined(CPPTRADER_PERF_COUNTERS)
+    // Profile only the given market operations
+    if (options.is_set("regions"))
+    {
+        market.perf_profile().EnableAll(false);
+        std::stringstream ss(options.get("regions"));
+        std::string region;
+        while (std::getline(ss, region, ','))
+            for (size_t i = 0; i < market.perf_profile().regions(); ++i)
+                if (market.perf_profile().name(i) == region)
+                    market.perf_profile().Enable(i);
+    }
+    if (!market.perf_profile().Open())
+        std::cerr << "Hardware performance counters are not available!" << std::endl;
+#endif
+
     // Open the input file or stdin
     std::unique_ptr<Reader> input(new StdInput());
     if (options.is_set("input"))
@@ -193,5 +218,48 @@ int main(int argc, char** argv)
     std::cout << "Delete order operations: " << market_handler.delete_orders() << std::endl;
     std::cout << "Execute order operations: " << market_handler.execute_orders() << std::endl;
 
+    std::cout << std::endl;
+
+    MarketMemoryStats memory = market.GetMemoryStats();
+    std::cout << "Memory statistics: " << std::endl;
+    std::cout << "Order pool: " << memory.OrderPool << std::endl;
+    std::cout << "Level pool: " << memory.LevelPool << std::endl;
+    std::cout << "Symbol pool: " << memory.SymbolPool << std::endl;
+    std::cout << "Order book pool: " << memory.OrderBookPool << std::endl;
+    std::cout << "Orders index: size=" << memory.OrdersSize << ", capacity=" << memory.OrdersCapacity << ", load factor=" << memory.OrdersLoadFactor << std::endl;
+    std::cout << "Total used memory: " << memory.used() << " bytes" << std::endl;
+    std::cout << "Total reserved memory: " << memory.reserved() << " bytes" << std::endl;
+
+#if defined(CPPTRADER_STATISTICS)
+    std::cout << std::endl;
+
+    std::cout << "Operation latency statistics (ns): " << std::endl;
+    market.statistics().Dump(std::cout);
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    std::cout << std::endl;
+
+    std::cout << "Operation hardware performance counters (per operation): " << std::endl;
+    market.perf_profile().Dump(std::cout);
+#endif
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("market_manager");
+        report.Add("errors", (double)itch_handler.errors(), "", MetricDirection::LOWER_IS_BETTER, 0.0);
+        report.Add("message_latency", (double)(timestamp_stop - timestamp_start) / total_messages, "ns", MetricDirection::LOWER_IS_BETTER);
+        report.Add("message_throughput", (double)total_messages * 1000000000 / (timestamp_stop - timestamp_start), "msg/s", MetricDirection::HIGHER_IS_BETTER);
+        report.Add("update_latency", (double)(timestamp_stop - timestamp_start) / total_updates, "ns", MetricDirection::LOWER_IS_BETTER);
+        report.Add("update_throughput", (double)total_updates * 1000000000 / (timestamp_stop - timestamp_start), "upd/s", MetricDirection::HIGHER_IS_BETTER);
+        AddMarketMetrics(report, market);
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
     return 0;
 }
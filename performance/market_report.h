@@ -0,0 +1,75 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#ifndef CPPTRADER_PERFORMANCE_MARKET_REPORT_H
+#define CPPTRADER_PERFORMANCE_MARKET_REPORT_H
+
+#include "trader/matching/market_manager.h"
+#include "trader/statistics/benchmark_report.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <string>
+
+//! Add market manager statistics into the benchmark report
+/*!
+    Reports memory usage, per-operation latency percentiles (with
+    CPPTRADER_STATISTICS) and per-operation hardware counters (with
+    CPPTRADER_PERF_COUNTERS). Tail latencies and counters are noisier
+    than throughput, so they get wider tolerances.
+*/
+inline void AddMarketMetrics(CppTrader::Statistics::BenchmarkReport& report, const CppTrader::Matching::MarketManager& market)
+{
+    using namespace CppTrader::Matching;
+    using namespace CppTrader::Statistics;
+
+    MarketMemoryStats memory = market.GetMemoryStats();
+    report.Add("memory_used", (double)memory.used(), "bytes", MetricDirection::LOWER_IS_BETTER);
+    report.Add("memory_reserved", (double)memory.reserved(), "bytes", MetricDirection::LOWER_IS_BETTER);
+
+    auto lower = [](std::string name)
+    {
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return name;
+    };
+
+#if defined(CPPTRADER_STATISTICS)
+    for (size_t i = 0; i < MarketStatistics::OPERATIONS; ++i)
+    {
+        MarketOperationSummary summary = market.statistics().Summary((MarketOperation)i);
+        if (summary.Count == 0)
+            continue;
+
+        std::string name = lower(MarketOperationNames()[i]);
+        report.Add(name + "_p50", (double)summary.P50, "ns", MetricDirection::LOWER_IS_BETTER);
+        report.Add(name + "_p99", (double)summary.P99, "ns", MetricDirection::LOWER_IS_BETTER, 0.25);
+        report.Add(name + "_p999", (double)summary.P999, "ns", MetricDirection::LOWER_IS_BETTER, 0.5);
+    }
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    const PerfProfile& profile = market.perf_profile();
+    for (size_t i = 0; i < profile.regions(); ++i)
+    {
+        if (profile.count(i) == 0)
+            continue;
+
+        PerfRegionSummary summary = profile.Summary(i);
+        std::string name = lower(summary.Region);
+        for (size_t j = 0; j < PERF_COUNTERS; ++j)
+        {
+            if (!profile.counters().available((PerfCounter)j))
+                continue;
+
+            std::stringstream counter;
+            counter << (PerfCounter)j;
+            report.Add(name + "_" + lower(counter.str()), summary.Values[j], "events", MetricDirection::LOWER_IS_BETTER, 0.25);
+        }
+        report.Add(name + "_ipc", summary.IPC, "ipc", MetricDirection::HIGHER_IS_BETTER, 0.25);
+    }
+#endif
+}
+
+#endif // CPPTRADER_PERFORMANCE_MARKET_REPORT_H
@@ -0,0 +1,126 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "trader/providers/nasdaq/moldudp64_handler.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+
+class MyITCHHandler : public ITCHHandler
+{
+public:
+    MyITCHHandler()
+        : _messages(0),
+          _errors(0)
+    {}
+
+    size_t messages() const { return _messages; }
+    size_t errors() const { return _errors; }
+
+protected:
+    bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const StockDirectoryMessage& message) override { ++_messages; return true; }
+    bool onMessage(const StockTradingActionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RegSHOMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MarketParticipantPositionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBDeclineMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBStatusMessage& message) override { ++_messages; return true; }
+    bool onMessage(const IPOQuotingMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMPIDMessage& message) override { ++_messages; return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { ++_messages; return true; }
+    bool onMessage(const OrderExecutedWithPriceMessage& message) override { ++_messages; return true; }
+    bool onMessage(const OrderCancelMessage& message) override { ++_messages; return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { ++_messages; return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { ++_messages; return true; }
+    bool onMessage(const TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const CrossTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const BrokenTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const NOIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RPIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const LULDAuctionCollarMessage& message) override { ++_messages; return true; }
+    bool onMessage(const UnknownMessage& message) override { ++_errors; return true; }
+
+private:
+    size_t _messages;
+    size_t _errors;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input pcap/pcapng file name");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(0).help("UDP destination port filter. Default: %default (any port)");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    MyITCHHandler itch_handler;
+    MoldUDP64Handler mold_handler(itch_handler, (uint16_t)options.get("port"));
+
+    // Open the input file or stdin
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input"))
+    {
+        File* file = new File(Path(options.get("input")));
+        file->Open(true, false);
+        input.reset(file);
+    }
+
+    // Perform input
+    size_t size;
+    std::vector<uint8_t> buffer(1024 * 1024);
+    std::cout << "MoldUDP64 processing...";
+    uint64_t timestamp_start = Timestamp::nano();
+    while ((size = input->Read(buffer.data(), buffer.size())) > 0)
+    {
+        // Process the buffer
+        if (!mold_handler.Process(buffer.data(), size))
+        {
+            std::cout << "Failed!" << std::endl;
+            return -1;
+        }
+    }
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << itch_handler.errors() << std::endl;
+    std::cout << "Sequence gaps: " << mold_handler.gaps() << std::endl;
+    std::cout << "Lost messages: " << mold_handler.lost() << std::endl;
+    std::cout << "Duplicate messages: " << mold_handler.duplicates() << std::endl;
+    std::cout << "Skipped capture records: " << mold_handler.skipped() << std::endl;
+
+    std::cout << std::endl;
+
+    size_t total_packets = mold_handler.packets();
+    size_t total_messages = itch_handler.messages();
+
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total MoldUDP64 packets: " << total_packets << std::endl;
+    std::cout << "MoldUDP64 packet throughput: " << total_packets * 1000000000 / (timestamp_stop - timestamp_start) << " pkt/s" << std::endl;
+    std::cout << "Total ITCH messages: " << total_messages << std::endl;
+    std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(total_messages, (size_t)1)) << std::endl;
+    std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+
+    return 0;
+}
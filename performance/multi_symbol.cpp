@@ -0,0 +1,177 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/generator/order_flow.h"
+#include "trader/statistics/benchmark_report.h"
+#include "trader/statistics/perf_counters.h"
+
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace CppCommon;
+using namespace CppTrader;
+using namespace CppTrader::Generator;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+// Multi-symbol run results of the single symbols count
+struct SymbolsResult
+{
+    uint32_t Symbols;
+    uint64_t Duration;
+    size_t Commands;
+    size_t Books;
+    bool Counted;
+    PerfSample Counters;
+    size_t Reserved;
+
+    double throughput() const noexcept { return (double)Commands * 1000000000.0 / (double)std::max(Duration, (uint64_t)1); }
+    double per_command(PerfCounter counter) const noexcept { return (double)Counters[counter] / (double)std::max(Commands, (size_t)1); }
+};
+
+// Replay the order flow with the given count of symbols
+/*
+    Order books are touched in the Zipf order of symbols activity, so hot
+    books stay in caches while the long tail of cold books evicts their
+    levels and orders. Counters and time are measured after the warm up
+    part of the order flow, which fills all order books.
+*/
+void RunSymbols(SymbolsResult& result, OrderFlowSettings settings, size_t warmup, size_t count)
+{
+    settings.Symbols = result.Symbols;
+
+    std::vector<OrderFlowCommand> commands;
+    OrderFlowGenerator generator(settings);
+    generator.Generate(warmup + count, commands);
+
+    MarketHandler market_handler;
+    MarketManager market(market_handler);
+    market.EnableMatching();
+    generator.Initialize(market);
+
+    for (size_t i = 0; i < warmup; ++i)
+        commands[i].Apply(market);
+
+    PerfCounters counters;
+    PerfSample start, stop;
+    counters.Open();
+    bool counted = counters.Read(start);
+
+    uint64_t timestamp_start = Timestamp::nano();
+    for (size_t i = warmup; i < commands.size(); ++i)
+        commands[i].Apply(market);
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    counted = counted && counters.Read(stop);
+    counters.Close();
+
+    result.Duration = timestamp_stop - timestamp_start;
+    result.Commands = count;
+    result.Books = 0;
+    for (uint32_t i = 0; i < result.Symbols; ++i)
+        if ((market.GetOrderBook(i) != nullptr) && !market.GetOrderBook(i)->empty())
+            ++result.Books;
+    result.Counted = counted && counters.available(PerfCounter::LLC_MISSES);
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+        result.Counters.Values[i] = counted ? (stop.Values[i] - start.Values[i]) : 0;
+    result.Reserved = market.GetMemoryStats().reserved();
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-n", "--commands").dest("commands").action("store").type("int").set_default(1000000).help("Count of measured commands for each symbols count. Default: %default");
+    parser.add_option("-w", "--warmup").dest("warmup").action("store").type("int").set_default(200000).help("Count of warm up commands. Default: %default");
+    parser.add_option("--symbols").dest("symbols").set_default("1,10,100,1000,10000").help("Comma separated active symbols counts sweep. Default: %default");
+    parser.add_option("--skew").dest("skew").action("store").type("float").set_default(1.0).help("Zipf exponent of symbols activity (0 - uniform). Default: %default");
+    parser.add_option("-s", "--seed").dest("seed").action("store").type("int").set_default(1).help("Random generator seed. Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    std::vector<SymbolsResult> results;
+    std::stringstream ss(options.get("symbols"));
+    std::string symbols;
+    while (std::getline(ss, symbols, ','))
+        if (std::stoul(symbols) > 0)
+            results.push_back(SymbolsResult{ (uint32_t)std::stoul(symbols) });
+    if (results.empty())
+    {
+        std::cerr << "No symbols counts!" << std::endl;
+        return -1;
+    }
+
+    OrderFlowSettings settings;
+    settings.Seed = (unsigned long)options.get("seed");
+    settings.SymbolSkew = std::max((double)options.get("skew"), 0.0);
+
+    size_t warmup = (size_t)std::max((int)options.get("warmup"), 0);
+    size_t count = (size_t)std::max((int)options.get("commands"), 1);
+
+    for (auto& result : results)
+    {
+        std::cout << "Order flow processing with " << result.Symbols << " symbols...";
+        RunSymbols(result, settings, warmup, count);
+        std::cout << "Done!" << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    if (!results.front().Counted)
+        std::cerr << "LLC misses hardware performance counter is not available!" << std::endl;
+
+    std::cout << "Multi-symbol statistics (Zipf exponent " << settings.SymbolSkew << "): " << std::endl;
+    std::cout << std::setw(10) << "Symbols" << std::setw(10) << "Books" << std::setw(14) << "Throughput" << std::setw(12) << "Latency"
+        << std::setw(14) << "LLC miss/cmd" << std::setw(14) << "L1D miss/cmd" << std::setw(10) << "IPC" << std::setw(16) << "Reserved" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::setw(10) << result.Symbols << std::setw(10) << result.Books << std::setw(14) << (uint64_t)result.throughput()
+            << std::setw(12) << std::fixed << std::setprecision(1) << (double)result.Duration / (double)result.Commands;
+        if (result.Counted)
+        {
+            double cycles = (double)result.Counters[PerfCounter::CYCLES];
+            std::cout << std::setw(14) << std::setprecision(3) << result.per_command(PerfCounter::LLC_MISSES)
+                << std::setw(14) << result.per_command(PerfCounter::L1D_MISSES)
+                << std::setw(10) << std::setprecision(2) << ((cycles > 0) ? ((double)result.Counters[PerfCounter::INSTRUCTIONS] / cycles) : 0.0);
+        }
+        else
+            std::cout << std::setw(14) << "n/a" << std::setw(14) << "n/a" << std::setw(10) << "n/a";
+        std::cout << std::setw(16) << result.Reserved << std::defaultfloat << std::endl;
+    }
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("multi_symbol");
+        for (const auto& result : results)
+        {
+            std::string name = "symbols_" + std::to_string(result.Symbols);
+            report.Add(name + "_throughput", result.throughput(), "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+            report.Add(name + "_reserved", (double)result.Reserved, "bytes", MetricDirection::LOWER_IS_BETTER, 0.0);
+            if (result.Counted)
+                report.Add(name + "_llc_misses", result.per_command(PerfCounter::LLC_MISSES), "miss/cmd", MetricDirection::LOWER_IS_BETTER, 0.25);
+        }
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
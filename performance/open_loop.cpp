@@ -0,0 +1,195 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/generator/order_flow.h"
+#include "trader/statistics/benchmark_report.h"
+#include "trader/statistics/latency_histogram.h"
+#include "trader/statistics/tsc_clock.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace CppTrader;
+using namespace CppTrader::Generator;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+// Open-loop run results of the single target rate
+struct RateResult
+{
+    uint64_t Target;
+    double Achieved;
+    LatencyHistogram Response;
+    LatencyHistogram Service;
+};
+
+// Replay commands at the fixed target rate
+/*
+    Each command has the intended send time on the fixed schedule from the
+    run start. If the market manager falls behind the schedule, commands are
+    sent immediately, but their response latency is still measured from the
+    intended send time. That is what the client of the open system observes
+    and it is free of the coordinated omission: stalls are accounted for all
+    commands which should have been sent during them, not only for the one
+    which was stuck. Service latency is measured from the actual send time
+    and shows the same run as a closed-loop benchmark would see it.
+*/
+void RunRate(RateResult& result, const OrderFlowSettings& settings, const std::vector<OrderFlowCommand>& commands, size_t warmup)
+{
+    MarketHandler market_handler;
+    MarketManager market(market_handler);
+    market.EnableMatching();
+
+    OrderFlowGenerator generator(settings);
+    generator.Initialize(market);
+
+    // Warm up order books without pacing
+    for (size_t i = 0; i < warmup; ++i)
+        commands[i].Apply(market);
+
+    double period = 1000000000.0 / (double)result.Target / TscClock::nanoseconds_per_tick();
+    size_t count = commands.size() - warmup;
+
+    uint64_t start = TscClock::ticks();
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t intended = start + (uint64_t)((double)i * period);
+        uint64_t sent = TscClock::ticks();
+        while (sent < intended)
+            sent = TscClock::ticks();
+
+        commands[warmup + i].Apply(market);
+
+        uint64_t done = TscClock::ticks();
+        result.Response.Record(done - intended);
+        result.Service.Record(done - sent);
+    }
+    uint64_t stop = TscClock::ticks();
+
+    result.Achieved = (double)count * 1000000000.0 / std::max((double)TscClock::ToNanoseconds(stop - start), 1.0);
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-n", "--commands").dest("commands").action("store").type("int").set_default(1000000).help("Count of measured commands for each rate. Default: %default");
+    parser.add_option("-w", "--warmup").dest("warmup").action("store").type("int").set_default(100000).help("Count of unpaced warm up commands. Default: %default");
+    parser.add_option("-r", "--rates").dest("rates").set_default("100000,250000,500000,1000000,2000000,4000000").help("Comma separated target rates sweep (commands per second). Default: %default");
+    parser.add_option("-s", "--seed").dest("seed").action("store").type("int").set_default(1).help("Random generator seed. Default: %default");
+    parser.add_option("--symbols").dest("symbols").action("store").type("int").set_default(1).help("Count of symbols. Default: %default");
+    parser.add_option("-k", "--knee").dest("knee").action("store").type("float").set_default(10.0).help("Knee factor: p99.9 response latency growth against lower rates. Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    std::vector<uint64_t> rates;
+    std::stringstream ss(options.get("rates"));
+    std::string rate;
+    while (std::getline(ss, rate, ','))
+        if (std::stoull(rate) > 0)
+            rates.push_back(std::stoull(rate));
+    std::sort(rates.begin(), rates.end());
+    if (rates.empty())
+    {
+        std::cerr << "No target rates!" << std::endl;
+        return -1;
+    }
+
+    OrderFlowSettings settings;
+    settings.Seed = (unsigned long)options.get("seed");
+    settings.Symbols = (uint32_t)std::max((int)options.get("symbols"), 1);
+
+    // The same pre-generated order flow is replayed at all rates
+    size_t warmup = (size_t)std::max((int)options.get("warmup"), 0);
+    size_t count = (size_t)std::max((int)options.get("commands"), 1);
+    std::vector<OrderFlowCommand> commands;
+    std::cout << "Order flow generation...";
+    OrderFlowGenerator generator(settings);
+    generator.Generate(warmup + count, commands);
+    std::cout << "Done!" << std::endl;
+
+    // Calibrate the TSC clock before measurements
+    TscClock::nanoseconds_per_tick();
+
+    std::vector<RateResult> results(rates.size());
+    for (size_t i = 0; i < rates.size(); ++i)
+    {
+        std::cout << "Open-loop run at " << rates[i] << " cmd/s...";
+        results[i].Target = rates[i];
+        RunRate(results[i], settings, commands, warmup);
+        std::cout << "Done!" << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    auto ns = [](uint64_t ticks) { return TscClock::ToNanoseconds(ticks); };
+
+    std::cout << "Latency statistics (ns): " << std::endl;
+    std::cout << std::setw(12) << "Target" << std::setw(12) << "Achieved"
+        << std::setw(12) << "Resp p50" << std::setw(12) << "Resp p99" << std::setw(12) << "Resp p99.9" << std::setw(14) << "Resp max"
+        << std::setw(12) << "Serv p50" << std::setw(12) << "Serv p99" << std::setw(12) << "Serv p99.9" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::setw(12) << result.Target << std::setw(12) << (uint64_t)result.Achieved
+            << std::setw(12) << ns(result.Response.Percentile(50)) << std::setw(12) << ns(result.Response.Percentile(99)) << std::setw(12) << ns(result.Response.Percentile(99.9)) << std::setw(14) << ns(result.Response.max())
+            << std::setw(12) << ns(result.Service.Percentile(50)) << std::setw(12) << ns(result.Service.Percentile(99)) << std::setw(12) << ns(result.Service.Percentile(99.9)) << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    // The knee is the first rate which is not sustained or where the tail latency explodes
+    // against the best tail latency of lower rates (single stalls of lower rates are ignored)
+    double factor = std::max((double)options.get("knee"), 1.0);
+    uint64_t base = std::max(results.front().Response.Percentile(99.9), (uint64_t)1);
+    size_t knee = results.size();
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        uint64_t p999 = results[i].Response.Percentile(99.9);
+        if ((results[i].Achieved < 0.95 * (double)results[i].Target) || ((double)p999 > factor * (double)base))
+        {
+            knee = i;
+            break;
+        }
+        base = std::max(std::min(base, p999), (uint64_t)1);
+    }
+    uint64_t sustained = (knee > 0) ? results[knee - 1].Target : 0;
+    if (knee < results.size())
+        std::cout << "Knee rate: " << results[knee].Target << " cmd/s (max sustained rate: " << sustained << " cmd/s)" << std::endl;
+    else
+        std::cout << "Knee rate: not found (max sustained rate: " << sustained << " cmd/s)" << std::endl;
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("open_loop");
+        report.Add("sustained_rate", (double)sustained, "cmd/s", MetricDirection::HIGHER_IS_BETTER, 0.0);
+        for (const auto& result : results)
+        {
+            std::string name = "rate_" + std::to_string(result.Target);
+            report.Add(name + "_achieved", result.Achieved, "cmd/s", MetricDirection::HIGHER_IS_BETTER, 0.05);
+            report.Add(name + "_response_p50", (double)ns(result.Response.Percentile(50)), "ns", MetricDirection::LOWER_IS_BETTER, 0.25);
+            report.Add(name + "_response_p99", (double)ns(result.Response.Percentile(99)), "ns", MetricDirection::LOWER_IS_BETTER, 0.5);
+            report.Add(name + "_response_p999", (double)ns(result.Response.Percentile(99.9)), "ns", MetricDirection::LOWER_IS_BETTER, 1.0);
+        }
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
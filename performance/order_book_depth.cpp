@@ -0,0 +1,191 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/matching/market_manager.h"
+
+#include "benchmark/cppbenchmark.h"
+
+#include <memory>
+
+using namespace CppTrader::Matching;
+
+// Order book shapes: price levels of each side and orders of each price level
+// (the deepest books are limited with a million of orders for each side)
+const auto settings = CppBenchmark::Settings().Pair(10, 1).Pair(10, 1000).Pair(1000, 1).Pair(1000, 1000).Pair(100000, 1).Pair(100000, 10);
+
+// Book prices: bid levels go down from the best bid, ask levels go up from the best ask
+const uint32_t SYMBOL = 0;
+const uint64_t BID_PRICE = 1000000000;
+const uint64_t ASK_PRICE = BID_PRICE + 1;
+const uint64_t QUANTITY = 10;
+
+// Base order book fixture with an empty market manager
+class OrderBookFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::unique_ptr<MarketManager> _market;
+    uint64_t _levels;
+    uint64_t _orders;
+    uint64_t _id;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        _market.reset(new MarketManager());
+        _market->AddSymbol(Symbol(SYMBOL, "ORDRBOOK"));
+        _market->AddOrderBook(Symbol(SYMBOL, "ORDRBOOK"));
+        _levels = (uint64_t)context.x();
+        _orders = (uint64_t)context.y();
+        _id = 0;
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        _market.reset();
+    }
+
+    // Price of the given bid level (0 is the best one)
+    uint64_t BidPrice(uint64_t level) const noexcept { return BID_PRICE - level; }
+    // Price of the given ask level (0 is the best one)
+    uint64_t AskPrice(uint64_t level) const noexcept { return ASK_PRICE + level; }
+};
+
+// Limit order book with bid and ask levels and automatic matching
+class LimitBookFixture : public OrderBookFixture
+{
+protected:
+    uint64_t _top;
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        OrderBookFixture::Initialize(context);
+        _market->EnableMatching();
+
+        _top = _id + 1;
+        for (uint64_t level = 0; level < _levels; ++level)
+            AddBidLevel(level);
+        for (uint64_t level = 0; level < _levels; ++level)
+            for (uint64_t i = 0; i < _orders; ++i)
+                _market->AddOrder(Order::SellLimit(++_id, SYMBOL, AskPrice(level), QUANTITY));
+    }
+
+    void AddBidLevel(uint64_t level)
+    {
+        for (uint64_t i = 0; i < _orders; ++i)
+            _market->AddOrder(Order::BuyLimit(++_id, SYMBOL, BidPrice(level), QUANTITY));
+    }
+
+    // Add and cancel the limit order at the given bid level
+    void AddCancel(CppBenchmark::Context& context, uint64_t level)
+    {
+        uint64_t id = ++_id;
+
+        auto add = context.StartPhase("Add");
+        _market->AddOrder(Order::BuyLimit(id, SYMBOL, BidPrice(level), QUANTITY));
+        add->StopPhase();
+
+        auto cancel = context.StartPhase("Cancel");
+        _market->DeleteOrder(id);
+        cancel->StopPhase();
+    }
+
+    // Sweep the given count of bid levels with the aggressive order and restore them
+    void Sweep(CppBenchmark::Context& context, uint64_t levels)
+    {
+        levels = std::min(levels, _levels);
+
+        auto sweep = context.StartPhase("Sweep");
+        _market->AddOrder(Order::SellLimit(++_id, SYMBOL, BidPrice(levels - 1), levels * _orders * QUANTITY, OrderTimeInForce::IOC));
+        sweep->StopPhase();
+
+        for (uint64_t level = 0; level < levels; ++level)
+            AddBidLevel(level);
+    }
+};
+
+// Stop and trailing stop order books of the same shape without matching
+class StopBookFixture : public OrderBookFixture
+{
+protected:
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        OrderBookFixture::Initialize(context);
+
+        // Trailing stop prices are kept while there are no trades in the order book
+        for (uint64_t level = 0; level < _levels; ++level)
+        {
+            for (uint64_t i = 0; i < _orders; ++i)
+            {
+                _market->AddOrder(Order::BuyStop(++_id, SYMBOL, AskPrice(level), QUANTITY));
+                _market->AddOrder(Order::SellStop(++_id, SYMBOL, BidPrice(level), QUANTITY));
+                _market->AddOrder(Order::TrailingBuyStop(++_id, SYMBOL, AskPrice(level), QUANTITY, 100));
+                _market->AddOrder(Order::TrailingSellStop(++_id, SYMBOL, BidPrice(level), QUANTITY, 100));
+            }
+        }
+    }
+
+    // Add and cancel the stop order at the given buy stop level
+    void AddCancel(CppBenchmark::Context& context, uint64_t level, bool trailing)
+    {
+        uint64_t id = ++_id;
+
+        auto add = context.StartPhase("Add");
+        _market->AddOrder(trailing ? Order::TrailingBuyStop(id, SYMBOL, AskPrice(level), QUANTITY, 100) : Order::BuyStop(id, SYMBOL, AskPrice(level), QUANTITY));
+        add->StopPhase();
+
+        auto cancel = context.StartPhase("Cancel");
+        _market->DeleteOrder(id);
+        cancel->StopPhase();
+    }
+};
+
+BENCHMARK_FIXTURE(LimitBookFixture, "Limit.Top", settings)
+{
+    AddCancel(context, 0);
+}
+
+BENCHMARK_FIXTURE(LimitBookFixture, "Limit.Deep", settings)
+{
+    AddCancel(context, _levels - 1);
+}
+
+BENCHMARK_FIXTURE(LimitBookFixture, "Limit.ModifyPrice", settings)
+{
+    // Move the order from the top level to the deepest one and back
+    auto modify = context.StartPhase("Modify");
+    _market->ModifyOrder(_top, BidPrice(_levels - 1), QUANTITY);
+    _market->ModifyOrder(_top, BidPrice(0), QUANTITY);
+    modify->StopPhase();
+}
+
+BENCHMARK_FIXTURE(LimitBookFixture, "Limit.Sweep1", settings)
+{
+    Sweep(context, 1);
+}
+
+BENCHMARK_FIXTURE(LimitBookFixture, "Limit.Sweep10", settings)
+{
+    Sweep(context, 10);
+}
+
+BENCHMARK_FIXTURE(StopBookFixture, "Stop.Top", settings)
+{
+    AddCancel(context, 0, false);
+}
+
+BENCHMARK_FIXTURE(StopBookFixture, "Stop.Deep", settings)
+{
+    AddCancel(context, _levels - 1, false);
+}
+
+BENCHMARK_FIXTURE(StopBookFixture, "TrailingStop.Top", settings)
+{
+    AddCancel(context, 0, true);
+}
+
+BENCHMARK_FIXTURE(StopBookFixture, "TrailingStop.Deep", settings)
+{
+    AddCancel(context, _levels - 1, true);
+}
+
+BENCHMARK_MAIN()
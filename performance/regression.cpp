@@ -0,0 +1,83 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "trader/statistics/benchmark_report.h"
+
+#include <OptionParser.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace CppTrader::Statistics;
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0").usage("%prog -b BASELINE -c CURRENT [-t TOLERANCE]");
+
+    parser.add_option("-b", "--baseline").dest("baseline").help("Baseline JSON benchmark report file name");
+    parser.add_option("-c", "--current").dest("current").help("Current JSON benchmark report file name");
+    parser.add_option("-t", "--tolerance").dest("tolerance").action("store").type("float").set_default(0.10).help("Default relative tolerance of metrics without their own tolerance. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || !options.is_set("baseline") || !options.is_set("current"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    BenchmarkReport baseline;
+    if (!baseline.Load(options.get("baseline")))
+    {
+        std::cerr << "Failed to load the baseline benchmark report: " << (std::string)options.get("baseline") << std::endl;
+        return -1;
+    }
+
+    BenchmarkReport current;
+    if (!current.Load(options.get("current")))
+    {
+        std::cerr << "Failed to load the current benchmark report: " << (std::string)options.get("current") << std::endl;
+        return -1;
+    }
+
+    if (baseline.name() != current.name())
+        std::cerr << "Warning: comparing different benchmarks '" << baseline.name() << "' and '" << current.name() << "'" << std::endl;
+
+    std::vector<BenchmarkVerdict> verdicts = current.Compare(baseline, (double)options.get("tolerance"));
+
+    std::cout << "Benchmark: " << current.name() << std::endl;
+    std::cout << std::endl;
+
+    size_t failed = 0;
+    for (const auto& verdict : verdicts)
+    {
+        const BenchmarkMetric* metric = baseline.Find(verdict.Name);
+        std::cout << (verdict.Passed ? "[ PASS ] " : "[ FAIL ] ") << std::left << std::setw(32) << verdict.Name << std::right;
+        if (verdict.Missing)
+            std::cout << " missing in the current report";
+        else
+        {
+            std::cout << " baseline=" << std::setw(14) << verdict.Baseline
+                << " current=" << std::setw(14) << verdict.Current
+                << " change=" << std::showpos << std::fixed << std::setprecision(1) << std::setw(8) << verdict.Change * 100 << "%" << std::noshowpos
+                << " tolerance=" << verdict.Tolerance * 100 << "%" << std::defaultfloat << std::setprecision(6)
+                << " " << metric->Unit << " (" << metric->Direction << " is better)";
+        }
+        std::cout << std::endl;
+        if (!verdict.Passed)
+            ++failed;
+    }
+
+    std::cout << std::endl;
+
+    if (failed > 0)
+    {
+        std::cout << "Performance regression: " << failed << " of " << verdicts.size() << " metrics failed!" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Performance check passed: " << verdicts.size() << " metrics" << std::endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "trader/matching/market_manager.h"
+#include "trader/replay/event_file.h"
+#include "trader/replay/event_replayer.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <iostream>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Replay;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0),
+          _orders(0),
+          _max_orders(0)
+    {}
+
+    size_t updates() const { return _updates; }
+    size_t max_orders() const { return _max_orders; }
+
+protected:
+    void onAddSymbol(const Symbol& symbol) override { ++_updates; }
+    void onDeleteSymbol(const Symbol& symbol) override { ++_updates; }
+    void onAddOrderBook(const OrderBook& order_book) override { ++_updates; }
+    void onDeleteOrderBook(const OrderBook& order_book) override { ++_updates; }
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; ++_orders; _max_orders = std::max(_orders, _max_orders); }
+    void onUpdateOrder(const Order& order) override { ++_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; --_orders; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+    size_t _orders;
+    size_t _max_orders;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input events file name (see cpptrader-example-itch_convert)");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || !options.is_set("input"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    EventFile events;
+    if (!events.Open(Path(options.get("input"))))
+    {
+        std::cerr << "Invalid events file: " << options.get("input") << std::endl;
+        return -1;
+    }
+
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+    EventReplayer replayer(market);
+
+    // Perform replay
+    std::cout << "Events replaying...";
+    uint64_t timestamp_start = Timestamp::nano();
+    replayer.Replay(events.begin(), events.end());
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << replayer.errors() << std::endl;
+
+    std::cout << std::endl;
+
+    size_t total_events = replayer.events();
+    size_t total_updates = market_handler.updates();
+
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total events: " << total_events << std::endl;
+    std::cout << "Event latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(total_events, (size_t)1)) << std::endl;
+    std::cout << "Event throughput: " << total_events * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " evt/s" << std::endl;
+    std::cout << "Total market updates: " << total_updates << std::endl;
+    std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(total_updates, (size_t)1)) << std::endl;
+    std::cout << "Market update throughput: " << total_updates * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " upd/s" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Market statistics: " << std::endl;
+    std::cout << "Max orders: " << market_handler.max_orders() << std::endl;
+
+    return 0;
+}
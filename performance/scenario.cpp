@@ -0,0 +1,237 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "market_report.h"
+
+#include "trader/generator/order_flow.h"
+#include "trader/matching/market_scenario.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+using namespace CppCommon;
+using namespace CppTrader;
+using namespace CppTrader::Generator;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler() : _updates(0) {}
+
+    size_t updates() const { return _updates; }
+
+protected:
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; }
+    void onUpdateOrder(const Order& order) override { ++_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+};
+
+// Write the synthetic order flow as a scenario text ('Iceberg' and 'Fill-Or-Kill' market orders are written as regular ones)
+void WriteScenario(std::ostream& stream, const OrderFlowSettings& settings, const std::vector<OrderFlowCommand>& commands)
+{
+    stream << "enable matching\n";
+    for (uint32_t i = 0; i < settings.Symbols; ++i)
+    {
+        char name[9];
+        std::snprintf(name, sizeof(name), "SYM%05u", (unsigned)(i % 100000));
+        stream << "add symbol " << i << " " << name << "\n";
+        stream << "add book " << i << "\n";
+    }
+
+    for (const auto& command : commands)
+    {
+        const Order& order = command.Order;
+        const char* side = order.IsBuy() ? "buy" : "sell";
+        switch (command.Type)
+        {
+            case OrderFlowCommandType::ADD:
+                switch (order.Type)
+                {
+                    case OrderType::MARKET:
+                        stream << "add market " << side << " " << order.Id << " " << order.SymbolId << " " << order.Quantity << "\n";
+                        break;
+                    case OrderType::LIMIT:
+                        stream << "add " << (order.IsIOC() ? "ioc " : (order.IsFOK() ? "fok " : (order.IsAON() ? "aon " : ""))) << "limit " << side << " " << order.Id << " " << order.SymbolId << " " << order.Price << " " << order.Quantity << "\n";
+                        break;
+                    case OrderType::STOP:
+                        stream << "add stop " << side << " " << order.Id << " " << order.SymbolId << " " << order.StopPrice << " " << order.Quantity << "\n";
+                        break;
+                    case OrderType::STOP_LIMIT:
+                        stream << "add stop-limit " << side << " " << order.Id << " " << order.SymbolId << " " << order.StopPrice << " " << order.Price << " " << order.Quantity << "\n";
+                        break;
+                    case OrderType::TRAILING_STOP:
+                        stream << "add trailing stop " << side << " " << order.Id << " " << order.SymbolId << " " << order.StopPrice << " " << order.Quantity << " " << order.TrailingDistance << " " << order.TrailingStep << "\n";
+                        break;
+                    case OrderType::TRAILING_STOP_LIMIT:
+                        stream << "add trailing stop-limit " << side << " " << order.Id << " " << order.SymbolId << " " << order.StopPrice << " " << order.Price << " " << order.Quantity << " " << order.TrailingDistance << " " << order.TrailingStep << "\n";
+                        break;
+                    default:
+                        break;
+                }
+                break;
+            case OrderFlowCommandType::MODIFY:
+                stream << "modify order " << order.Id << " " << order.Price << " " << order.Quantity << "\n";
+                break;
+            case OrderFlowCommandType::CANCEL:
+                stream << "delete order " << order.Id << "\n";
+                break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0").usage("%prog [options] [scenario files...]");
+
+    parser.add_option("-g", "--generate").dest("generate").action("store").type("int").set_default(0).help("Count of synthetic order flow commands to generate into the scenario. Default: %default");
+    parser.add_option("-s", "--seed").dest("seed").action("store").type("int").set_default(1).help("Synthetic order flow seed. Default: %default");
+    parser.add_option("--symbols").dest("symbols").action("store").type("int").set_default(1).help("Count of synthetic order flow symbols. Default: %default");
+    parser.add_option("-o", "--output").dest("output").help("Output file name of the generated scenario");
+    parser.add_option("-n", "--repeat").dest("repeat").action("store").type("int").set_default(1).help("Count of replays of all scenarios (each into a new market manager). Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || (parser.args().empty() && ((int)options.get("generate") <= 0)))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Prepare scenario texts (each scenario is replayed into its own market manager)
+    std::vector<std::string> texts;
+    for (const auto& path : parser.args())
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "Cannot open the scenario file: " << path << std::endl;
+            return -1;
+        }
+        std::stringstream ss;
+        ss << file.rdbuf();
+        texts.push_back(ss.str());
+    }
+    if ((int)options.get("generate") > 0)
+    {
+        OrderFlowSettings settings;
+        settings.Seed = (unsigned long)options.get("seed");
+        settings.Symbols = (uint32_t)std::max((int)options.get("symbols"), 1);
+
+        std::cout << "Scenario generation...";
+        std::vector<OrderFlowCommand> commands;
+        OrderFlowGenerator generator(settings);
+        generator.Generate((size_t)(int)options.get("generate"), commands);
+        std::stringstream ss;
+        WriteScenario(ss, settings, commands);
+        texts.push_back(ss.str());
+        std::cout << "Done!" << std::endl;
+
+        if (options.is_set("output"))
+        {
+            std::ofstream output(options.get("output"), std::ios::binary);
+            output << texts.back();
+        }
+    }
+
+    // Parse scenarios
+    std::vector<std::unique_ptr<MarketScenario>> scenarios;
+    size_t lines = 0, commands = 0;
+    std::cout << "Scenario parsing...";
+    uint64_t timestamp_parse = Timestamp::nano();
+    for (const auto& text : texts)
+    {
+        scenarios.emplace_back(new MarketScenario());
+        if (!scenarios.back()->Parse(text))
+        {
+            std::cerr << "Scenario #" << scenarios.size() << " parse error at line " << scenarios.back()->error_line() << ": " << scenarios.back()->error() << std::endl;
+            return -1;
+        }
+        lines += scenarios.back()->lines();
+        commands += scenarios.back()->commands().size();
+    }
+    uint64_t timestamp_parsed = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    // Replay scenarios into new market managers
+    size_t repeat = (size_t)std::max((int)options.get("repeat"), 1);
+    size_t errors = 0;
+    uint64_t duration = 0;
+    MyMarketHandler market_handler;
+    std::unique_ptr<MarketManager> market;
+    std::cout << "Scenario replaying...";
+    for (size_t i = 0; i < repeat; ++i)
+    {
+        for (const auto& scenario : scenarios)
+        {
+            market.reset(new MarketManager(market_handler));
+            uint64_t timestamp_start = Timestamp::nano();
+            errors += scenario->Replay(*market);
+            uint64_t timestamp_stop = Timestamp::nano();
+            duration += timestamp_stop - timestamp_start;
+        }
+    }
+    duration = std::max(duration, (uint64_t)1);
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << errors << std::endl;
+
+    std::cout << std::endl;
+
+    uint64_t parse_duration = std::max(timestamp_parsed - timestamp_parse, (uint64_t)1);
+    size_t total_commands = std::max(commands * repeat, (size_t)1);
+    size_t total_updates = std::max(market_handler.updates(), (size_t)1);
+
+    std::cout << "Scenarios: " << scenarios.size() << std::endl;
+    std::cout << "Scenario lines: " << lines << std::endl;
+    std::cout << "Scenario commands: " << commands << std::endl;
+    std::cout << "Parse time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(parse_duration) << std::endl;
+    std::cout << "Parse throughput: " << lines * 1000000000 / parse_duration << " lines/s" << std::endl;
+    std::cout << "Replay count: " << repeat << std::endl;
+    std::cout << "Replay time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration) << std::endl;
+    std::cout << "Command latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration / total_commands) << std::endl;
+    std::cout << "Command throughput: " << total_commands * 1000000000 / duration << " cmd/s" << std::endl;
+    std::cout << "Total market updates: " << market_handler.updates() << std::endl;
+    std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration / total_updates) << std::endl;
+    std::cout << "Market update throughput: " << total_updates * 1000000000 / duration << " upd/s" << std::endl;
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        BenchmarkReport report("scenario");
+        report.Add("errors", (double)errors, "", MetricDirection::LOWER_IS_BETTER, 0.0);
+        report.Add("parse_throughput", (double)lines * 1000000000 / parse_duration, "lines/s", MetricDirection::HIGHER_IS_BETTER);
+        report.Add("command_latency", (double)duration / total_commands, "ns", MetricDirection::LOWER_IS_BETTER);
+        report.Add("command_throughput", (double)total_commands * 1000000000 / duration, "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+        report.Add("update_throughput", (double)total_updates * 1000000000 / duration, "upd/s", MetricDirection::HIGHER_IS_BETTER);
+        AddMarketMetrics(report, *market);
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
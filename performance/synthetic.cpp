@@ -0,0 +1,280 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "market_report.h"
+
+#include "trader/generator/order_flow.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+using namespace CppCommon;
+using namespace CppTrader;
+using namespace CppTrader::Generator;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0),
+          _max_order_book_levels(0),
+          _orders(0),
+          _max_orders(0),
+          _add_orders(0),
+          _update_orders(0),
+          _delete_orders(0),
+          _execute_orders(0)
+    {}
+
+    size_t updates() const { return _updates; }
+    size_t max_order_book_levels() const { return _max_order_book_levels; }
+    size_t max_orders() const { return _max_orders; }
+    size_t add_orders() const { return _add_orders; }
+    size_t update_orders() const { return _update_orders; }
+    size_t delete_orders() const { return _delete_orders; }
+    size_t execute_orders() const { return _execute_orders; }
+
+protected:
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) override { _max_order_book_levels = std::max(std::max(order_book.bids().size(), order_book.asks().size()), _max_order_book_levels); }
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; ++_orders; _max_orders = std::max(_orders, _max_orders); ++_add_orders; }
+    void onUpdateOrder(const Order& order) override { ++_updates; ++_update_orders; }
+    void onDeleteOrder(const Order& order) override { ++_updates; --_orders; ++_delete_orders; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; ++_execute_orders; }
+
+private:
+    size_t _updates;
+    size_t _max_order_book_levels;
+    size_t _orders;
+    size_t _max_orders;
+    size_t _add_orders;
+    size_t _update_orders;
+    size_t _delete_orders;
+    size_t _execute_orders;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-n", "--commands").dest("commands").action("store").type("int").set_default(1000000).help("Count of order flow commands. Default: %default");
+    parser.add_option("-j", "--json").dest("json").help("Output JSON benchmark report file name");
+    parser.add_option("-s", "--seed").dest("seed").action("store").type("int").set_default(1).help("Random generator seed. Default: %default");
+    parser.add_option("--symbols").dest("symbols").action("store").type("int").set_default(1).help("Count of symbols. Default: %default");
+    parser.add_option("--skew").dest("skew").action("store").type("float").set_default(0.0).help("Zipf exponent of symbols activity (0 - uniform). Default: %default");
+    parser.add_option("--accounts").dest("accounts").action("store").type("int").set_default(1).help("Count of accounts. Default: %default");
+    parser.add_option("--distribution").dest("distribution").set_default("normal").help("Prices distribution around the mid price: uniform, normal or exponential. Default: %default");
+    parser.add_option("--scale").dest("scale").action("store").type("float").set_default(50.0).help("Prices distribution scale in ticks. Default: %default");
+    parser.add_option("--volatility").dest("volatility").action("store").type("float").set_default(0.0).help("Mid price random walk volatility in ticks. Default: %default");
+    parser.add_option("--aggressive").dest("aggressive").action("store").type("float").set_default(0.10).help("Share of aggressive limit orders. Default: %default");
+    parser.add_option("--cancel").dest("cancel").action("store").type("float").set_default(0.30).help("Share of cancel commands. Default: %default");
+    parser.add_option("--modify").dest("modify").action("store").type("float").set_default(0.10).help("Share of modify commands. Default: %default");
+    parser.add_option("--market").dest("market").action("store").type("float").set_default(0.10).help("Market orders weight (limit orders weight is 0.75). Default: %default");
+    parser.add_option("--stop").dest("stop").action("store").type("float").set_default(0.03).help("Stop orders weight. Default: %default");
+    parser.add_option("--stop-limit").dest("stop_limit").action("store").type("float").set_default(0.03).help("Stop-limit orders weight. Default: %default");
+    parser.add_option("--trailing").dest("trailing").action("store").type("float").set_default(0.0).help("Trailing stop orders weight. Default: %default");
+    parser.add_option("--trailing-limit").dest("trailing_limit").action("store").type("float").set_default(0.0).help("Trailing stop-limit orders weight. Default: %default");
+    parser.add_option("--iceberg").dest("iceberg").action("store").type("float").set_default(0.05).help("Share of 'Iceberg' limit orders. Default: %default");
+    parser.add_option("--ioc").dest("ioc").action("store").type("float").set_default(0.05).help("Share of 'Immediate-Or-Cancel' limit orders. Default: %default");
+    parser.add_option("--fok").dest("fok").action("store").type("float").set_default(0.02).help("Share of 'Fill-Or-Kill' limit and market orders. Default: %default");
+    parser.add_option("--aon").dest("aon").action("store").type("float").set_default(0.0).help("Share of 'All-Or-None' limit orders. Default: %default");
+#if defined(CPPTRADER_PERF_COUNTERS)
+    parser.add_option("-r", "--regions").dest("regions").help("Comma separated market operations to profile with hardware performance counters (e.g. ADD_LIMIT,MATCH_ORDER). Default: all");
+#endif
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    OrderFlowSettings settings;
+    settings.Seed = (unsigned long)options.get("seed");
+    settings.Symbols = (uint32_t)std::max((int)options.get("symbols"), 1);
+    settings.SymbolSkew = std::max((double)options.get("skew"), 0.0);
+    settings.Accounts = (uint64_t)std::max((int)options.get("accounts"), 1);
+    settings.PriceScale = (double)options.get("scale");
+    settings.Volatility = (double)options.get("volatility");
+    settings.Aggressive = (double)options.get("aggressive");
+    settings.CancelRatio = (double)options.get("cancel");
+    settings.ModifyRatio = (double)options.get("modify");
+    settings.Mix.Market = (double)options.get("market");
+    settings.Mix.Stop = (double)options.get("stop");
+    settings.Mix.StopLimit = (double)options.get("stop_limit");
+    settings.Mix.TrailingStop = (double)options.get("trailing");
+    settings.Mix.TrailingStopLimit = (double)options.get("trailing_limit");
+    settings.Mix.Iceberg = (double)options.get("iceberg");
+    settings.Mix.IOC = (double)options.get("ioc");
+    settings.Mix.FOK = (double)options.get("fok");
+    settings.Mix.AON = (double)options.get("aon");
+
+    std::string distribution = options.get("distribution");
+    if (distribution == "uniform")
+        settings.Distribution = PriceDistribution::UNIFORM;
+    else if (distribution == "exponential")
+        settings.Distribution = PriceDistribution::EXPONENTIAL;
+    else
+        settings.Distribution = PriceDistribution::NORMAL;
+
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+    market.EnableMatching();
+
+    OrderFlowGenerator generator(settings);
+    generator.Initialize(market);
+
+    // Pre-generate the order flow to measure the market manager only
+    size_t count = (size_t)std::max((int)options.get("commands"), 0);
+    std::vector<OrderFlowCommand> commands;
+    std::cout << "Order flow generation...";
+    uint64_t timestamp_generate = Timestamp::nano();
+    generator.Generate(count, commands);
+    uint64_t timestamp_start = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    size_t adds = 0, modifies = 0, cancels = 0, missing = 0, errors = 0;
+#if defined(CPPTRADER_PERF_COUNTERS)
+    // Profile only the given market operations
+    if (options.is_set("regions"))
+    {
+        market.perf_profile().EnableAll(false);
+        std::stringstream ss(options.get("regions"));
+        std::string region;
+        while (std::getline(ss, region, ','))
+            for (size_t i = 0; i < market.perf_profile().regions(); ++i)
+                if (market.perf_profile().name(i) == region)
+                    market.perf_profile().Enable(i);
+    }
+    if (!market.perf_profile().Open())
+        std::cerr << "Hardware performance counters are not available!" << std::endl;
+#endif
+
+    std::cout << "Order flow processing...";
+    for (const auto& command : commands)
+    {
+        ErrorCode result = command.Apply(market);
+        if (result == ErrorCode::ORDER_NOT_FOUND)
+            ++missing;
+        else if (result != ErrorCode::OK)
+            ++errors;
+    }
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    for (const auto& command : commands)
+    {
+        switch (command.Type)
+        {
+            case OrderFlowCommandType::ADD:
+                ++adds;
+                break;
+            case OrderFlowCommandType::MODIFY:
+                ++modifies;
+                break;
+            case OrderFlowCommandType::CANCEL:
+                ++cancels;
+                break;
+        }
+    }
+
+    std::cout << std::endl;
+
+    std::cout << "Settings: seed=" << settings.Seed << ", symbols=" << settings.Symbols << ", skew=" << settings.SymbolSkew << ", accounts=" << settings.Accounts << ", distribution=" << settings.Distribution << std::endl;
+    std::cout << "Errors: " << errors << std::endl;
+    std::cout << "Missing orders: " << missing << std::endl;
+
+    std::cout << std::endl;
+
+    size_t total_commands = std::max(commands.size(), (size_t)1);
+    size_t total_updates = market_handler.updates();
+
+    std::cout << "Generation time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_start - timestamp_generate) << std::endl;
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total commands: " << commands.size() << std::endl;
+    std::cout << "Command latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_commands) << std::endl;
+    std::cout << "Command throughput: " << total_commands * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " cmd/s" << std::endl;
+    std::cout << "Total market updates: " << total_updates << std::endl;
+    std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(total_updates, (size_t)1)) << std::endl;
+    std::cout << "Market update throughput: " << total_updates * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " upd/s" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Order flow statistics: " << std::endl;
+    std::cout << "Add commands: " << adds << std::endl;
+    std::cout << "Modify commands: " << modifies << std::endl;
+    std::cout << "Cancel commands: " << cancels << std::endl;
+    std::cout << "Live orders: " << generator.live() << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Market statistics: " << std::endl;
+    std::cout << "Max order book levels: " << market_handler.max_order_book_levels() << std::endl;
+    std::cout << "Max orders: " << market_handler.max_orders() << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Order statistics: " << std::endl;
+    std::cout << "Add order operations: " << market_handler.add_orders() << std::endl;
+    std::cout << "Update order operations: " << market_handler.update_orders() << std::endl;
+    std::cout << "Delete order operations: " << market_handler.delete_orders() << std::endl;
+    std::cout << "Execute order operations: " << market_handler.execute_orders() << std::endl;
+
+    std::cout << std::endl;
+
+    MarketMemoryStats memory = market.GetMemoryStats();
+    std::cout << "Memory statistics: " << std::endl;
+    std::cout << "Order pool: " << memory.OrderPool << std::endl;
+    std::cout << "Level pool: " << memory.LevelPool << std::endl;
+    std::cout << "Symbol pool: " << memory.SymbolPool << std::endl;
+    std::cout << "Order book pool: " << memory.OrderBookPool << std::endl;
+    std::cout << "Orders index: size=" << memory.OrdersSize << ", capacity=" << memory.OrdersCapacity << ", load factor=" << memory.OrdersLoadFactor << std::endl;
+    std::cout << "Total used memory: " << memory.used() << " bytes" << std::endl;
+    std::cout << "Total reserved memory: " << memory.reserved() << " bytes" << std::endl;
+
+#if defined(CPPTRADER_STATISTICS)
+    std::cout << std::endl;
+
+    std::cout << "Operation latency statistics (ns): " << std::endl;
+    market.statistics().Dump(std::cout);
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    std::cout << std::endl;
+
+    std::cout << "Operation hardware performance counters (per operation): " << std::endl;
+    market.perf_profile().Dump(std::cout);
+#endif
+
+    // Save the JSON benchmark report
+    if (options.is_set("json"))
+    {
+        uint64_t duration = std::max(timestamp_stop - timestamp_start, (uint64_t)1);
+        Statistics::BenchmarkReport report("synthetic");
+        report.Add("errors", (double)errors, "", Statistics::MetricDirection::LOWER_IS_BETTER, 0.0);
+        report.Add("command_latency", (double)duration / total_commands, "ns", Statistics::MetricDirection::LOWER_IS_BETTER);
+        report.Add("command_throughput", (double)total_commands * 1000000000 / duration, "cmd/s", Statistics::MetricDirection::HIGHER_IS_BETTER);
+        report.Add("update_latency", (double)duration / std::max(total_updates, (size_t)1), "ns", Statistics::MetricDirection::LOWER_IS_BETTER);
+        report.Add("update_throughput", (double)total_updates * 1000000000 / duration, "upd/s", Statistics::MetricDirection::HIGHER_IS_BETTER);
+        AddMarketMetrics(report, market);
+        if (!report.Save(options.get("json")))
+        {
+            std::cerr << "Failed to save the JSON benchmark report!" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+/*!
+    \file order_flow.cpp
+    \brief Synthetic order flow generator implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/generator/order_flow.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace CppTrader {
+namespace Generator {
+
+using namespace CppTrader::Matching;
+
+OrderFlowGenerator::OrderFlowGenerator(const OrderFlowSettings& settings)
+    : _settings(settings)
+{
+    // Prepare cumulative order type weights
+    const double weights[6] =
+    {
+        std::max(_settings.Mix.Limit, 0.0),
+        std::max(_settings.Mix.Market, 0.0),
+        std::max(_settings.Mix.Stop, 0.0),
+        std::max(_settings.Mix.StopLimit, 0.0),
+        std::max(_settings.Mix.TrailingStop, 0.0),
+        std::max(_settings.Mix.TrailingStopLimit, 0.0)
+    };
+    double total = 0.0;
+    for (size_t i = 0; i < 6; ++i)
+    {
+        total += weights[i];
+        _weights[i] = total;
+    }
+
+    // Empty mix generates limit orders only
+    if (total <= 0.0)
+    {
+        _weights[0] = 1.0;
+        total = 1.0;
+    }
+    for (size_t i = 0; i < 6; ++i)
+        _weights[i] /= total;
+
+    if (_settings.Symbols == 0)
+        _settings.Symbols = 1;
+    if (_settings.Accounts == 0)
+        _settings.Accounts = 1;
+    if (_settings.TickSize == 0)
+        _settings.TickSize = 1;
+    if (_settings.MinQuantity == 0)
+        _settings.MinQuantity = 1;
+    if (_settings.MaxQuantity < _settings.MinQuantity)
+        _settings.MaxQuantity = _settings.MinQuantity;
+
+    // Cumulative Zipf distribution of symbols activity
+    if ((_settings.SymbolSkew > 0.0) && (_settings.Symbols > 1))
+    {
+        double sum = 0.0;
+        _symbols.resize(_settings.Symbols);
+        for (uint32_t i = 0; i < _settings.Symbols; ++i)
+        {
+            sum += 1.0 / std::pow((double)(i + 1), _settings.SymbolSkew);
+            _symbols[i] = sum;
+        }
+        for (auto& probability : _symbols)
+            probability /= sum;
+    }
+
+    Reset();
+}
+
+ErrorCode OrderFlowGenerator::Initialize(MarketManager& market) const
+{
+    for (uint32_t i = 0; i < _settings.Symbols; ++i)
+    {
+        char name[9];
+        std::snprintf(name, sizeof(name), "SYM%05u", (unsigned)(i % 100000));
+
+        Symbol symbol(i, name);
+        ErrorCode result = market.AddSymbol(symbol);
+        if (result != ErrorCode::OK)
+            return result;
+        result = market.AddOrderBook(symbol);
+        if (result != ErrorCode::OK)
+            return result;
+    }
+    return ErrorCode::OK;
+}
+
+OrderFlowCommand OrderFlowGenerator::Next()
+{
+    ++_commands;
+
+    double choice = Uniform();
+    if ((choice < _settings.CancelRatio) && (live() > 0))
+        return NextCancel();
+    if ((choice < (_settings.CancelRatio + _settings.ModifyRatio)) && !_live_limits.empty())
+        return NextModify();
+    return NextAdd();
+}
+
+void OrderFlowGenerator::Generate(size_t count, std::vector<OrderFlowCommand>& commands)
+{
+    commands.reserve(commands.size() + count);
+    for (size_t i = 0; i < count; ++i)
+        commands.push_back(Next());
+}
+
+void OrderFlowGenerator::Reset()
+{
+    _state = _settings.Seed;
+    _commands = 0;
+    _id = 0;
+    _mids.assign(_settings.Symbols, std::max(_settings.MidPrice, _settings.TickSize));
+    _live_limits.clear();
+    _live_stops.clear();
+}
+
+double OrderFlowGenerator::Normal() noexcept
+{
+    // Box-Muller transform
+    double u1 = 1.0 - Uniform();
+    double u2 = Uniform();
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+uint32_t OrderFlowGenerator::NextSymbol() noexcept
+{
+    if (_symbols.empty())
+        return (uint32_t)Range(0, _settings.Symbols - 1);
+
+    auto it = std::upper_bound(_symbols.begin(), _symbols.end(), Uniform());
+    return (uint32_t)std::min((size_t)(it - _symbols.begin()), _symbols.size() - 1);
+}
+
+uint64_t OrderFlowGenerator::Offset() noexcept
+{
+    switch (_settings.Distribution)
+    {
+        case PriceDistribution::UNIFORM:
+            return Range(0, (uint64_t)std::max(_settings.PriceScale, 0.0));
+        case PriceDistribution::NORMAL:
+            return (uint64_t)std::fabs(Normal() * _settings.PriceScale);
+        case PriceDistribution::EXPONENTIAL:
+            return (uint64_t)(-std::log(1.0 - Uniform()) * std::max(_settings.PriceScale, 0.0));
+        default:
+            return 0;
+    }
+}
+
+uint64_t OrderFlowGenerator::PassivePrice(uint32_t symbol, OrderSide side, uint64_t offset) const noexcept
+{
+    uint64_t mid = _mids[symbol];
+    uint64_t delta = (offset + 1) * _settings.TickSize;
+    if (side == OrderSide::BUY)
+        return (mid > (delta + _settings.TickSize)) ? (mid - delta) : _settings.TickSize;
+    else
+        return mid + delta;
+}
+
+uint64_t OrderFlowGenerator::AggressivePrice(uint32_t symbol, OrderSide side, uint64_t offset) const noexcept
+{
+    uint64_t mid = _mids[symbol];
+    uint64_t delta = offset * _settings.TickSize;
+    if (side == OrderSide::BUY)
+        return mid + delta;
+    else
+        return (mid > (delta + _settings.TickSize)) ? (mid - delta) : _settings.TickSize;
+}
+
+uint64_t OrderFlowGenerator::LimitPrice(uint64_t stop_price, OrderSide side, uint64_t ticks) const noexcept
+{
+    // Stop-limit orders are allowed to chase the market for a few ticks
+    uint64_t delta = ticks * _settings.TickSize;
+    if (side == OrderSide::BUY)
+        return stop_price + delta;
+    else
+        return (stop_price > (delta + _settings.TickSize)) ? (stop_price - delta) : _settings.TickSize;
+}
+
+uint64_t OrderFlowGenerator::Quantity() noexcept
+{
+    return Range(_settings.MinQuantity, _settings.MaxQuantity);
+}
+
+OrderFlowCommand OrderFlowGenerator::NextAdd()
+{
+    uint32_t symbol = NextSymbol();
+    UpdateMid(symbol);
+
+    OrderSide side = Chance(0.5) ? OrderSide::BUY : OrderSide::SELL;
+    OrderSide opposite = (side == OrderSide::BUY) ? OrderSide::SELL : OrderSide::BUY;
+    uint64_t id = ++_id;
+    uint64_t quantity = Quantity();
+    uint64_t offset = Offset();
+
+    // Choose the order type
+    double choice = Uniform();
+    size_t type = 0;
+    while ((type < 5) && (choice >= _weights[type]))
+        ++type;
+
+    OrderFlowCommand command;
+    command.Type = OrderFlowCommandType::ADD;
+
+    switch (type)
+    {
+        case 0:
+        {
+            uint64_t price = Chance(_settings.Aggressive) ? AggressivePrice(symbol, side, offset) : PassivePrice(symbol, side, offset);
+
+            OrderTimeInForce tif = OrderTimeInForce::GTC;
+            double share = Uniform();
+            if (share < _settings.Mix.IOC)
+                tif = OrderTimeInForce::IOC;
+            else if (share < (_settings.Mix.IOC + _settings.Mix.FOK))
+                tif = OrderTimeInForce::FOK;
+            else if (share < (_settings.Mix.IOC + _settings.Mix.FOK + _settings.Mix.AON))
+                tif = OrderTimeInForce::AON;
+
+            uint64_t visible = ORDER_INT_MAX;
+            if ((tif == OrderTimeInForce::GTC) && Chance(_settings.Mix.Iceberg))
+                visible = std::max<uint64_t>(quantity / 10, 1);
+
+            command.Order = Order::Limit(id, symbol, side, price, quantity, tif, visible);
+            if ((tif == OrderTimeInForce::GTC) || (tif == OrderTimeInForce::AON))
+                _live_limits.push_back({ id, symbol, side });
+            break;
+        }
+        case 1:
+        {
+            OrderTimeInForce tif = Chance(_settings.Mix.FOK) ? OrderTimeInForce::FOK : OrderTimeInForce::IOC;
+            command.Order = Order(id, symbol, OrderType::MARKET, side, 0, 0, quantity, tif);
+            break;
+        }
+        case 2:
+        {
+            // Buy stops are above the mid price, sell stops are below
+            uint64_t stop_price = PassivePrice(symbol, opposite, offset);
+            command.Order = Order::Stop(id, symbol, side, stop_price, quantity);
+            _live_stops.push_back({ id, symbol, side });
+            break;
+        }
+        case 3:
+        {
+            uint64_t stop_price = PassivePrice(symbol, opposite, offset);
+            uint64_t price = LimitPrice(stop_price, side, Range(0, 5));
+            command.Order = Order::StopLimit(id, symbol, side, stop_price, price, quantity);
+            _live_stops.push_back({ id, symbol, side });
+            break;
+        }
+        case 4:
+        {
+            uint64_t stop_price = PassivePrice(symbol, opposite, offset);
+            int64_t distance = (int64_t)((offset + 1) * _settings.TickSize);
+            command.Order = Order::TrailingStop(id, symbol, side, stop_price, quantity, distance);
+            _live_stops.push_back({ id, symbol, side });
+            break;
+        }
+        default:
+        {
+            uint64_t stop_price = PassivePrice(symbol, opposite, offset);
+            uint64_t price = LimitPrice(stop_price, side, Range(0, 5));
+            int64_t distance = (int64_t)((offset + 1) * _settings.TickSize);
+            command.Order = Order::TrailingStopLimit(id, symbol, side, stop_price, price, quantity, distance);
+            _live_stops.push_back({ id, symbol, side });
+            break;
+        }
+    }
+
+    command.Order.AccountId = Range(1, _settings.Accounts);
+    return command;
+}
+
+OrderFlowCommand OrderFlowGenerator::NextModify()
+{
+    // Modified orders stay alive
+    const LiveOrder& target = _live_limits[Range(0, _live_limits.size() - 1)];
+
+    OrderFlowCommand command;
+    command.Type = OrderFlowCommandType::MODIFY;
+    command.Order = Order::Limit(target.Id, target.Symbol, target.Side, PassivePrice(target.Symbol, target.Side, Offset()), Quantity());
+    return command;
+}
+
+OrderFlowCommand OrderFlowGenerator::NextCancel()
+{
+    // Pick the cancel target from both live orders lists and swap-remove it
+    size_t index = (size_t)Range(0, live() - 1);
+    std::vector<LiveOrder>& orders = (index < _live_limits.size()) ? _live_limits : _live_stops;
+    if (index >= _live_limits.size())
+        index -= _live_limits.size();
+
+    LiveOrder target = orders[index];
+    orders[index] = orders.back();
+    orders.pop_back();
+
+    OrderFlowCommand command;
+    command.Type = OrderFlowCommandType::CANCEL;
+    command.Order = Order::Limit(target.Id, target.Symbol, target.Side, 0, 0);
+    return command;
+}
+
+void OrderFlowGenerator::UpdateMid(uint32_t symbol) noexcept
+{
+    if (_settings.Volatility <= 0.0)
+        return;
+
+    int64_t step = (int64_t)std::llround(Normal() * _settings.Volatility);
+    uint64_t& mid = _mids[symbol];
+    if (step >= 0)
+        mid += (uint64_t)step * _settings.TickSize;
+    else
+    {
+        uint64_t delta = (uint64_t)(-step) * _settings.TickSize;
+        mid = (mid > (delta + _settings.TickSize)) ? (mid - delta) : _settings.TickSize;
+    }
+}
+
+} // namespace Generator
+} // namespace CppTrader
@@ -0,0 +1,162 @@
+/*!
+    \file kdb_ipc.cpp
+    \brief kdb+ IPC message serializer implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/kdb_ipc.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+
+#include <sys/socket.h>
+
+namespace CppTrader {
+
+namespace {
+
+bool SendAll(I handle, const uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t sent = ::send(handle, data, size, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += sent;
+        size -= (size_t)sent;
+    }
+    return true;
+}
+
+bool ReceiveAll(I handle, uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t received = ::recv(handle, data, size, 0);
+        if (received <= 0)
+        {
+            if ((received < 0) && (errno == EINTR))
+                continue;
+            return false;
+        }
+        data += received;
+        size -= (size_t)received;
+    }
+    return true;
+}
+
+} // namespace
+
+KdbIpcMessageBase::KdbIpcMessageBase(const std::string& query, const std::string& table, size_t capacity)
+    : _query(query),
+      _table(table),
+      _buffer(new uint8_t[std::max(capacity, (size_t)HEADER_SIZE)]),
+      _size(0),
+      _capacity(std::max(capacity, (size_t)HEADER_SIZE)),
+      _ptr(_buffer.get())
+{
+}
+
+void KdbIpcMessageBase::Begin(size_t size, size_t columns, bool sync)
+{
+    // Grow the buffer geometrically
+    if (size > _capacity)
+    {
+        size_t capacity = _capacity;
+        while (capacity < size)
+            capacity *= 2;
+        _buffer.reset(new uint8_t[capacity]);
+        _capacity = capacity;
+    }
+
+    _size = size;
+    _ptr = _buffer.get();
+
+    // Header: endianness, message type (0 - async, 1 - sync), compression, reserved and total size
+    const uint16_t endianness = 1;
+    *_ptr++ = *(const uint8_t*)&endianness;
+    *_ptr++ = sync ? 1 : 0;
+    *_ptr++ = 0;
+    *_ptr++ = 0;
+    Write((uint32_t)size);
+
+    // (query; `table; columns)
+    Vector(0, 3);
+    Vector(KC, _query.size());
+    std::memcpy(_ptr, _query.data(), _query.size());
+    _ptr += _query.size();
+    *_ptr++ = (uint8_t)-KS;
+    Symbol(_table.data(), _table.size());
+    Vector(0, columns);
+}
+
+bool KdbIpcMessageBase::Send(I handle)
+{
+    if ((_size == 0) || !SendAll(handle, _buffer.get(), _size))
+    {
+        fprintf(stderr, "Network error: %s\n", strerror(errno));
+        return false;
+    }
+
+    // Message type is written into the header by Begin()
+    if (_buffer[1] == 0)
+        return true;
+
+    // Read the response message
+    uint8_t header[HEADER_SIZE];
+    if (!ReceiveAll(handle, header, HEADER_SIZE))
+    {
+        fprintf(stderr, "Network error: %s\n", strerror(errno));
+        return false;
+    }
+    if (header[2] != 0)
+    {
+        fprintf(stderr, "Compressed response is not supported\n");
+        return false;
+    }
+    uint32_t size;
+    std::memcpy(&size, header + 4, sizeof(size));
+    if ((size < HEADER_SIZE) || (size > MAX_RESPONSE_SIZE))
+    {
+        fprintf(stderr, "Invalid response size: %u\n", size);
+        return false;
+    }
+
+    // Only the response prefix is kept, the rest is read into the same chunk and discarded
+    uint8_t response[RESPONSE_CHUNK_SIZE + 1] = { 0 };
+    size_t prefix = std::min((size_t)(size - HEADER_SIZE), RESPONSE_CHUNK_SIZE);
+    if (!ReceiveAll(handle, response, prefix))
+    {
+        fprintf(stderr, "Network error: %s\n", strerror(errno));
+        return false;
+    }
+    uint8_t chunk[RESPONSE_CHUNK_SIZE];
+    for (size_t remaining = size - HEADER_SIZE - prefix; remaining > 0;)
+    {
+        size_t part = std::min(remaining, RESPONSE_CHUNK_SIZE);
+        if (!ReceiveAll(handle, chunk, part))
+        {
+            fprintf(stderr, "Network error: %s\n", strerror(errno));
+            return false;
+        }
+        remaining -= part;
+    }
+
+    // Error response is the null terminated error message
+    if ((prefix > 0) && ((int8_t)response[0] == -128))
+    {
+        fprintf(stderr, "Error message returned : %s\n", (const char*)response + 1);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace CppTrader
@@ -0,0 +1,170 @@
+/*!
+    \file kdb_loader.cpp
+    \brief kdb+ startup state loader implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/kdb_loader.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace CppTrader {
+
+using namespace Matching;
+using namespace Risk;
+
+const char KdbLoader::SYMBOLS_QUERY[] = "0!symbols";
+const char KdbLoader::POSITIONS_QUERY[] = "0!positions";
+const char KdbLoader::ORDERS_QUERY[] = "`Id xasc select from (0!select by Id from orders) where Status in 0 2 5h, LeavesQuantity > 0";
+
+K KdbLoader::Query(const char* query)
+{
+    K result = k(_handle, (S)query, (K)0);
+    if (result == nullptr)
+    {
+        std::cerr << "kdb+ connection error: " << query << std::endl;
+        return nullptr;
+    }
+    if (result->t == -128)
+    {
+        std::cerr << "kdb+ error '" << result->s << "': " << query << std::endl;
+        r0(result);
+        return nullptr;
+    }
+    return result;
+}
+
+int64_t KdbLoader::NextId(const std::string& table)
+{
+    std::string query = "1+max 0,exec Id from " + table;
+    K result = Query(query.c_str());
+    if (result == nullptr)
+        return -1;
+
+    int64_t id = (result->t == -KJ) ? (int64_t)result->j : -1;
+    r0(result);
+    return id;
+}
+
+int64_t KdbLoader::LoadSymbols(K table, MarketManager& market)
+{
+    KdbTable view(table);
+    const H* ids = view.column<KH>("Id");
+    const S* names = view.column<KS>("Name");
+    const H* types = view.column<KH>("Type");
+    const J* multipliers = view.column<KJ>("Multiplier");
+    const J* divisors = view.column<KJ>("QuantityDivisor");
+    if ((ids == nullptr) || (names == nullptr) || (types == nullptr) || (multipliers == nullptr) || (divisors == nullptr))
+        return -1;
+
+    for (size_t i = 0; i < view.rows(); ++i)
+    {
+        // Name is padded with zeros up to the fixed size
+        char name[sizeof(Symbol::Name)] = {};
+        std::memcpy(name, names[i], strnlen(names[i], sizeof(name)));
+
+        Symbol symbol((uint32_t)ids[i], name, (SymbolType)types[i], (uint64_t)multipliers[i], (uint64_t)divisors[i]);
+        if ((market.AddSymbol(symbol) != ErrorCode::OK) || (market.AddOrderBook(symbol) != ErrorCode::OK))
+            return -1;
+    }
+    return (int64_t)view.rows();
+}
+
+int64_t KdbLoader::LoadPositions(K table, PositionBook& positions)
+{
+    KdbTable view(table);
+    const J* ids = view.column<KJ>("Id");
+    const H* symbols = view.column<KH>("SymbolId");
+    const F* prices = view.column<KF>("AvgEntryPrice");
+    const J* quantities = view.column<KJ>("Quantity");
+    const H* sides = view.column<KH>("Side");
+    const J* accounts = view.column<KJ>("AccountId");
+    const F* risks_z = view.column<KF>("RiskZ");
+    const F* risks_c = view.column<KF>("RiskC");
+    const F* fundings = view.column<KF>("Funding");
+    const J* mark_prices = view.column<KJ>("MarkPrice");
+    const J* index_prices = view.column<KJ>("IndexPrice");
+    const F* realized = view.column<KF>("RealizedPnL");
+    const F* unrealized = view.column<KF>("UnrealizedPnL");
+    const J* funding_times = view.column<KJ>("FundingTime");
+    if ((ids == nullptr) || (symbols == nullptr) || (prices == nullptr) || (quantities == nullptr) || (sides == nullptr) ||
+        (accounts == nullptr) || (risks_z == nullptr) || (risks_c == nullptr) || (fundings == nullptr) || (mark_prices == nullptr) ||
+        (index_prices == nullptr) || (realized == nullptr) || (unrealized == nullptr) || (funding_times == nullptr))
+        return -1;
+
+    for (size_t i = 0; i < view.rows(); ++i)
+    {
+        uint32_t symbol = (uint32_t)symbols[i];
+        uint64_t account = (uint64_t)accounts[i];
+
+        Position& position = positions.AddPosition(symbol, account);
+        position = Position((uint64_t)ids[i], symbol, sides[i] ? PositionSide::SHORT : PositionSide::LONG, prices[i], (uint64_t)quantities[i],
+                            account, (uint64_t)mark_prices[i], (uint64_t)index_prices[i], risks_z[i], risks_c[i], fundings[i],
+                            realized[i], unrealized[i], (uint64_t)funding_times[i]);
+
+        // Loaded positions are already persisted, so only holders are refreshed
+        positions.UpdateHolder(PositionBook::Key{ symbol, (uint32_t)positions.GetAccount(account) });
+    }
+    return (int64_t)view.rows();
+}
+
+int64_t KdbLoader::LoadOrders(K table, MarketManager& market)
+{
+    KdbTable view(table);
+    const J* ids = view.column<KJ>("Id");
+    const H* symbols = view.column<KH>("SymbolId");
+    const J* executed = view.column<KJ>("ExecutedQuantity");
+    const J* leaves = view.column<KJ>("LeavesQuantity");
+    const J* max_visible = view.column<KJ>("MaxVisibleQuantity");
+    const J* prices = view.column<KJ>("Price");
+    const J* quantities = view.column<KJ>("Quantity");
+    const H* sides = view.column<KH>("Side");
+    const J* slippages = view.column<KJ>("Slippage");
+    const J* stop_prices = view.column<KJ>("StopPrice");
+    const H* tifs = view.column<KH>("TimeInForce");
+    const J* trailing_distances = view.column<KJ>("TrailingDistance");
+    const J* trailing_steps = view.column<KJ>("TrailingStep");
+    const H* types = view.column<KH>("Type");
+    const J* accounts = view.column<KJ>("AccountId");
+    const H* statuses = view.column<KH>("Status");
+    if ((ids == nullptr) || (symbols == nullptr) || (executed == nullptr) || (leaves == nullptr) || (max_visible == nullptr) ||
+        (prices == nullptr) || (quantities == nullptr) || (sides == nullptr) || (slippages == nullptr) || (stop_prices == nullptr) ||
+        (tifs == nullptr) || (trailing_distances == nullptr) || (trailing_steps == nullptr) || (types == nullptr) ||
+        (accounts == nullptr) || (statuses == nullptr))
+        return -1;
+
+    std::vector<Order> orders;
+    orders.reserve(view.rows());
+    for (size_t i = 0; i < view.rows(); ++i)
+    {
+        // Only open orders are restored
+        OrderStatus status = (OrderStatus)statuses[i];
+        if ((status != OrderStatus::PENDING) && (status != OrderStatus::REPLACED) && (status != OrderStatus::PARTIALLY_FILLED))
+            continue;
+
+        Order order((uint64_t)ids[i], (uint32_t)symbols[i], (OrderType)types[i], (OrderSide)sides[i], (uint64_t)prices[i], (uint64_t)stop_prices[i],
+                    (uint64_t)quantities[i], (OrderTimeInForce)tifs[i], (uint64_t)max_visible[i], (uint64_t)slippages[i],
+                    (int64_t)trailing_distances[i], (int64_t)trailing_steps[i]);
+        order.ExecutedQuantity = (uint64_t)executed[i];
+        order.LeavesQuantity = (uint64_t)leaves[i];
+        order.AccountId = (uint64_t)accounts[i];
+        order.Status = status;
+        orders.push_back(order);
+    }
+
+    // Market and fully executed orders are skipped by the market manager
+    size_t count = market.orders().size();
+    ErrorCode result = market.RestoreOrders(orders.data(), orders.size());
+    if (result != ErrorCode::OK)
+    {
+        std::cerr << "Failed to restore orders: " << result << std::endl;
+        return -1;
+    }
+    return (int64_t)(market.orders().size() - count);
+}
+
+} // namespace CppTrader
@@ -0,0 +1,630 @@
+/*!
+    \file kdb_server.cpp
+    \brief Local kdb+ IPC stand-in server implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/kdb_server.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace CppTrader {
+
+namespace {
+
+const size_t HEADER_SIZE = 8;
+
+bool ReceiveAll(int socket, uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t received = ::recv(socket, data, size, 0);
+        if (received <= 0)
+        {
+            if ((received < 0) && (errno == EINTR))
+                continue;
+            return false;
+        }
+        data += received;
+        size -= (size_t)received;
+    }
+    return true;
+}
+
+bool SendAll(int socket, const uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t sent = ::send(socket, data, size, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += sent;
+        size -= (size_t)sent;
+    }
+    return true;
+}
+
+// Size of the kdb+ atom or vector element of the given type (0 - variable or unknown)
+size_t ElementSize(int type)
+{
+    switch (type < 0 ? -type : type)
+    {
+        case 1: case 4: case 10: return 1;
+        case 2: return 16;
+        case 5: return 2;
+        case 6: case 8: case 13: case 14: case 17: case 18: case 19: return 4;
+        case 7: case 9: case 12: case 15: case 16: return 8;
+        default: return 0;
+    }
+}
+
+// kdb+ IPC message body reader
+class Reader
+{
+public:
+    Reader(const uint8_t* data, size_t size) : _ptr(data), _end(data + size) {}
+
+    bool Byte(int8_t& value)
+    {
+        if (_ptr + 1 > _end)
+            return false;
+        value = (int8_t)*_ptr++;
+        return true;
+    }
+
+    bool Int(int32_t& value)
+    {
+        if (_ptr + 4 > _end)
+            return false;
+        std::memcpy(&value, _ptr, 4);
+        _ptr += 4;
+        return true;
+    }
+
+    bool Peek(int8_t& type) const
+    {
+        if (_ptr >= _end)
+            return false;
+        type = (int8_t)*_ptr;
+        return true;
+    }
+
+    bool Symbol(std::string& value)
+    {
+        const uint8_t* terminator = (const uint8_t*)std::memchr(_ptr, 0, _end - _ptr);
+        if (terminator == nullptr)
+            return false;
+        value.assign((const char*)_ptr, terminator - _ptr);
+        _ptr = terminator + 1;
+        return true;
+    }
+
+    bool Skip(size_t size)
+    {
+        if (_ptr + size > _end)
+            return false;
+        _ptr += size;
+        return true;
+    }
+
+    // Read the vector attribute and count
+    bool Count(int32_t& count)
+    {
+        int8_t attribute;
+        return Byte(attribute) && Int(count) && (count >= 0);
+    }
+
+    // Read the char vector or the symbol atom
+    bool String(std::string& value)
+    {
+        int8_t type;
+        if (!Byte(type))
+            return false;
+        if (type == -11)
+            return Symbol(value);
+        if (type == -10)
+        {
+            if (_ptr >= _end)
+                return false;
+            value.assign(1, (char)*_ptr++);
+            return true;
+        }
+        int32_t count;
+        if ((type != 10) || !Count(count) || (_ptr + count > _end))
+            return false;
+        value.assign((const char*)_ptr, count);
+        _ptr += count;
+        return true;
+    }
+
+    // Skip the data of the object with the given type
+    bool Object(int8_t type)
+    {
+        std::string symbol;
+        int32_t count;
+        if (type < 0)
+        {
+            if (type == -11)
+                return Symbol(symbol);
+            if (type == -128)
+                return Symbol(symbol);
+            size_t size = ElementSize(type);
+            return (size > 0) && Skip(size);
+        }
+        if (type == 0)
+        {
+            if (!Count(count))
+                return false;
+            for (int32_t i = 0; i < count; ++i)
+                if (!Object())
+                    return false;
+            return true;
+        }
+        if (type == 11)
+        {
+            if (!Count(count))
+                return false;
+            for (int32_t i = 0; i < count; ++i)
+                if (!Symbol(symbol))
+                    return false;
+            return true;
+        }
+        if (type < 20)
+        {
+            size_t size = ElementSize(type);
+            return (size > 0) && Count(count) && Skip(count * size);
+        }
+        if (type == 98)
+            return Skip(1) && Object();
+        if ((type == 99) || (type == 127))
+            return Object() && Object();
+        if (type == 100)
+            return Symbol(symbol) && Object();
+        if ((type >= 101) && (type <= 103))
+            return Skip(1);
+        if ((type == 104) || (type == 105))
+        {
+            if (!Int(count) || (count < 0))
+                return false;
+            for (int32_t i = 0; i < count; ++i)
+                if (!Object())
+                    return false;
+            return true;
+        }
+        if ((type >= 106) && (type <= 111))
+            return Object();
+        return false;
+    }
+
+    // Skip the object
+    bool Object()
+    {
+        int8_t type;
+        return Byte(type) && Object(type);
+    }
+
+    // Count rows of the inserted data and skip it
+    bool Rows(uint64_t& rows)
+    {
+        int8_t type;
+        if (!Byte(type))
+            return false;
+
+        // Table is the flipped dictionary of column names and column values
+        if (type == 98)
+        {
+            int8_t dictionary;
+            if (!Skip(1) || !Byte(dictionary) || (dictionary != 99) || !Object() || !Byte(type) || (type != 0))
+                return false;
+        }
+
+        if (type == 0)
+        {
+            int32_t count;
+            if (!Count(count))
+                return false;
+            rows = (count > 0) ? 1 : 0;
+            for (int32_t i = 0; i < count; ++i)
+            {
+                int8_t column;
+                if (!Peek(column))
+                    return false;
+                // List of column vectors or a single row of atoms
+                if ((i == 0) && (column >= 0) && (column < 20))
+                {
+                    Reader reader(_ptr + 1, _end - _ptr - 1);
+                    int32_t length;
+                    if (!reader.Count(length))
+                        return false;
+                    rows = (uint64_t)length;
+                }
+                if (!Object())
+                    return false;
+            }
+            return true;
+        }
+
+        rows = 1;
+        return Object(type);
+    }
+
+private:
+    const uint8_t* _ptr;
+    const uint8_t* _end;
+};
+
+// kdb+ IPC response writer
+void Begin(std::vector<uint8_t>& response)
+{
+    response.assign(HEADER_SIZE, 0);
+    response[0] = 1;
+    response[1] = 2;
+}
+
+template <typename T>
+void Write(std::vector<uint8_t>& response, T value)
+{
+    const uint8_t* data = (const uint8_t*)&value;
+    response.insert(response.end(), data, data + sizeof(T));
+}
+
+void WriteSymbol(std::vector<uint8_t>& response, int8_t type, const std::string& symbol)
+{
+    response.push_back((uint8_t)type);
+    response.insert(response.end(), symbol.begin(), symbol.end());
+    response.push_back(0);
+}
+
+void End(std::vector<uint8_t>& response)
+{
+    uint32_t size = (uint32_t)response.size();
+    std::memcpy(response.data() + 4, &size, sizeof(size));
+}
+
+void WriteNull(std::vector<uint8_t>& response)
+{
+    Begin(response);
+    response.push_back(101);
+    response.push_back(0);
+    End(response);
+}
+
+void WriteError(std::vector<uint8_t>& response, const std::string& error)
+{
+    Begin(response);
+    WriteSymbol(response, -128, error);
+    End(response);
+}
+
+std::string Trim(const std::string& value)
+{
+    size_t first = value.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+        return std::string();
+    size_t last = value.find_last_not_of(" \t\r\n");
+    return value.substr(first, last - first + 1);
+}
+
+bool IsName(const std::string& value)
+{
+    if (value.empty())
+        return false;
+    for (char ch : value)
+        if (!isalnum((unsigned char)ch) && (ch != '_') && (ch != '.'))
+            return false;
+    return true;
+}
+
+} // namespace
+
+KdbServer::KdbServer(int port)
+    : _port(port),
+      _listener(-1),
+      _running(false)
+{
+}
+
+KdbServerStats KdbServer::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+uint64_t KdbServer::rows(const std::string& table) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _tables.find(table);
+    return (it != _tables.end()) ? it->second : 0;
+}
+
+bool KdbServer::Start()
+{
+    if (_running)
+        return false;
+
+    _listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (_listener < 0)
+        return false;
+
+    int reuse = 1;
+    ::setsockopt(_listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Listen on the loopback interface only
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons((uint16_t)_port);
+    socklen_t length = sizeof(address);
+    if ((::bind(_listener, (sockaddr*)&address, sizeof(address)) != 0) ||
+        (::listen(_listener, SOMAXCONN) != 0) ||
+        (::getsockname(_listener, (sockaddr*)&address, &length) != 0))
+    {
+        ::close(_listener);
+        _listener = -1;
+        return false;
+    }
+    _port = ntohs(address.sin_port);
+
+    _running = true;
+    _thread = std::thread([this]() { Accept(); });
+    return true;
+}
+
+void KdbServer::Stop()
+{
+    if (!_running)
+        return;
+
+    _running = false;
+
+    // Wake up the accepting thread
+    ::shutdown(_listener, SHUT_RDWR);
+    _thread.join();
+    ::close(_listener);
+    _listener = -1;
+
+    // Wake up and join all connection threads
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (int socket : _sockets)
+            ::shutdown(socket, SHUT_RDWR);
+        threads.swap(_threads);
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (int socket : _sockets)
+        ::close(socket);
+    _sockets.clear();
+}
+
+void KdbServer::Accept()
+{
+    while (_running)
+    {
+        int socket = ::accept(_listener, nullptr, nullptr);
+        if (socket < 0)
+        {
+            if ((errno == EINTR) || (errno == ECONNABORTED))
+                continue;
+            break;
+        }
+
+        int nodelay = 1;
+        ::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running)
+        {
+            ::close(socket);
+            break;
+        }
+        ++_stats.Connections;
+        _sockets.push_back(socket);
+        _threads.emplace_back([this, socket]() { Serve(socket); });
+    }
+}
+
+void KdbServer::Serve(int socket)
+{
+    // Handshake: "user:password" followed by the capability byte and the null terminator
+    uint8_t byte = 0;
+    uint8_t capability = 0;
+    size_t length = 0;
+    for (;;)
+    {
+        if (!ReceiveAll(socket, &byte, 1))
+            return;
+        if (byte == 0)
+            break;
+        capability = byte;
+        ++length;
+    }
+    capability = ((length > 0) && (capability < 32)) ? std::min(capability, (uint8_t)3) : 0;
+    if (!SendAll(socket, &capability, 1))
+        return;
+
+    std::vector<uint8_t> message;
+    std::vector<uint8_t> response;
+    for (;;)
+    {
+        uint8_t header[HEADER_SIZE];
+        if (!ReceiveAll(socket, header, HEADER_SIZE))
+            return;
+
+        uint32_t size;
+        std::memcpy(&size, header + 4, sizeof(size));
+        bool sync = (header[1] == 1);
+
+        // Only little endian and uncompressed messages are supported
+        if ((header[0] != 1) || (header[2] != 0) || (size < HEADER_SIZE))
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_stats.Errors;
+            return;
+        }
+
+        message.resize(size - HEADER_SIZE);
+        if (!ReceiveAll(socket, message.data(), message.size()))
+            return;
+
+        bool result = Process(message.data(), message.size(), response);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_stats.Messages;
+            _stats.Bytes += size;
+            if (sync)
+                ++_stats.SyncMessages;
+            if (!result)
+                ++_stats.Errors;
+        }
+
+        if (sync && !SendAll(socket, response.data(), response.size()))
+            return;
+    }
+}
+
+bool KdbServer::Process(const uint8_t* data, size_t size, std::vector<uint8_t>& response)
+{
+    Reader reader(data, size);
+
+    int8_t type;
+    if (!reader.Peek(type))
+    {
+        WriteError(response, "type");
+        return false;
+    }
+
+    // String query
+    if (type == 10)
+    {
+        std::string query;
+        if (!reader.String(query))
+        {
+            WriteError(response, "type");
+            return false;
+        }
+        Query(query, response);
+        return true;
+    }
+
+    // Any other object than the list is evaluated into itself
+    if (type != 0)
+    {
+        WriteNull(response);
+        return reader.Object();
+    }
+
+    // Function call: (function; args...)
+    int32_t count;
+    if (!reader.Byte(type) || !reader.Count(count))
+    {
+        WriteError(response, "type");
+        return false;
+    }
+    int32_t args = count;
+    std::string function;
+    int8_t first;
+    if ((count > 0) && reader.Peek(first) && ((first == 10) || (first == -11)))
+    {
+        if (!reader.String(function))
+        {
+            WriteError(response, "type");
+            return false;
+        }
+        --args;
+    }
+
+    function = Trim(function);
+    if (((function != "insert") && (function != "upsert")) || (count != 3))
+    {
+        for (int32_t i = 0; i < args; ++i)
+        {
+            if (!reader.Object())
+            {
+                WriteError(response, "type");
+                return false;
+            }
+        }
+        WriteNull(response);
+        return true;
+    }
+
+    std::string table;
+    uint64_t rows = 0;
+    if (!reader.Peek(type) || (type != -11) || !reader.String(table) || !reader.Rows(rows))
+    {
+        WriteError(response, "type");
+        return false;
+    }
+
+    uint64_t index;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        index = _tables[table];
+        _tables[table] = index + rows;
+        _stats.Rows += rows;
+    }
+
+    // insert returns indexes of inserted rows, upsert returns the table name
+    Begin(response);
+    if (function == "insert")
+    {
+        response.push_back(7);
+        response.push_back(0);
+        Write(response, (int32_t)rows);
+        for (uint64_t i = 0; i < rows; ++i)
+            Write(response, (int64_t)(index + i));
+    }
+    else
+        WriteSymbol(response, -11, table);
+    End(response);
+    return true;
+}
+
+void KdbServer::Query(const std::string& query, std::vector<uint8_t>& response)
+{
+    std::string text = Trim(query);
+
+    // count table
+    if (text.compare(0, 6, "count ") == 0)
+    {
+        std::string table = Trim(text.substr(6));
+        if (IsName(table))
+        {
+            Begin(response);
+            response.push_back((uint8_t)-7);
+            Write(response, (int64_t)rows(table));
+            End(response);
+            return;
+        }
+    }
+
+    // table:([] ...) definition
+    size_t colon = text.find(':');
+    if ((colon != std::string::npos) && IsName(Trim(text.substr(0, colon))) && (text.find("([", colon) != std::string::npos))
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tables[Trim(text.substr(0, colon))] = 0;
+    }
+
+    WriteNull(response);
+}
+
+} // namespace CppTrader
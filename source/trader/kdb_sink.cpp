@@ -0,0 +1,156 @@
+/*!
+    \file kdb_sink.cpp
+    \brief Asynchronous kdb+ writer implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/kdb_sink.h"
+
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+namespace CppTrader {
+
+KdbSinkTableBase::KdbSinkTableBase(KdbSink& sink, const std::string& name)
+    : _sink(sink),
+      _name(name),
+      _pending(false),
+      _rows(0),
+      _overflows(0),
+      _blocks(0),
+      _blocked_time(0),
+      _max_buffered(0),
+      _batches(0),
+      _shipped(0),
+      _errors(0),
+      _ship_time(0),
+      _max_ship_time(0)
+{
+}
+
+KdbSinkStats KdbSinkTableBase::stats() const noexcept
+{
+    KdbSinkStats stats;
+    stats.Rows = _rows.load(std::memory_order_relaxed);
+    stats.Overflows = _overflows.load(std::memory_order_relaxed);
+    stats.Blocks = _blocks.load(std::memory_order_relaxed);
+    stats.BlockedTime = _blocked_time.load(std::memory_order_relaxed);
+    stats.MaxBuffered = _max_buffered.load(std::memory_order_relaxed);
+    stats.Batches = _batches.load(std::memory_order_relaxed);
+    stats.Shipped = _shipped.load(std::memory_order_relaxed);
+    stats.Errors = _errors.load(std::memory_order_relaxed);
+    stats.ShipTime = _ship_time.load(std::memory_order_relaxed);
+    stats.MaxShipTime = _max_ship_time.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void KdbSinkTableBase::WaitPending()
+{
+    if (!_pending.load(std::memory_order_acquire))
+        return;
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+
+    // Spin for a while, then give up the time slice
+    size_t spins = 0;
+    while (_pending.load(std::memory_order_acquire))
+        if (++spins > 128)
+            CppCommon::Thread::Yield();
+
+    Increment(_blocks);
+    Increment(_blocked_time, CppCommon::Timestamp::nano() - timestamp);
+}
+
+void KdbSinkTableBase::ShipPending()
+{
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+
+    size_t rows = 0;
+    bool result = Ship(rows);
+
+    uint64_t duration = CppCommon::Timestamp::nano() - timestamp;
+    Increment(_batches);
+    Increment(_shipped, rows);
+    if (!result)
+        Increment(_errors);
+    Increment(_ship_time, duration);
+    Maximum(_max_ship_time, duration);
+
+    _pending.store(false, std::memory_order_release);
+}
+
+KdbSink::KdbSink(const KdbSinkSettings& settings)
+    : _settings(settings),
+      _signaled(false),
+      _stop(false),
+      _running(false)
+{
+    if (_settings.BatchSize == 0)
+        _settings.BatchSize = 1;
+    if ((_settings.MaxRows > 0) && (_settings.MaxRows < _settings.BatchSize))
+        _settings.MaxRows = _settings.BatchSize;
+}
+
+bool KdbSink::Start()
+{
+    if (_running)
+        return false;
+
+    _signaled = false;
+    _stop = false;
+    _running = true;
+    _thread = std::thread([this]() { Run(); });
+    return true;
+}
+
+void KdbSink::Stop()
+{
+    if (!_running)
+        return;
+
+    for (auto& table : _tables)
+        table->Flush();
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+    _running = false;
+}
+
+void KdbSink::Notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _signaled = true;
+    }
+    _cv.notify_one();
+}
+
+void KdbSink::Run()
+{
+    for (;;)
+    {
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return _signaled || _stop; });
+            _signaled = false;
+            stop = _stop;
+        }
+
+        // Ship all pending batches (the stop request comes after the last flush)
+        for (auto& table : _tables)
+            if (table->_pending.load(std::memory_order_acquire))
+                table->ShipPending();
+
+        if (stop)
+            break;
+    }
+}
+
+} // namespace CppTrader
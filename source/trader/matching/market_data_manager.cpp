@@ -0,0 +1,279 @@
+/*!
+    \file market_data_manager.cpp
+    \brief Market data manager implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_data_manager.h"
+
+#include <algorithm>
+
+namespace CppTrader {
+namespace Matching {
+
+ErrorCode MarketDataManager::AddSymbol(const Symbol& symbol)
+{
+    // Resize the symbols container
+    if (_symbols.size() <= symbol.Id)
+    {
+        _symbols.resize(symbol.Id + 1);
+        _symbols_active.resize(symbol.Id + 1, false);
+    }
+
+    if (_symbols_active[symbol.Id])
+        return ErrorCode::SYMBOL_DUPLICATE;
+
+    // Insert the symbol
+    _symbols[symbol.Id] = symbol;
+    _symbols_active[symbol.Id] = true;
+
+    // Call the corresponding handler
+    _market_handler.onAddSymbol(_symbols[symbol.Id]);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::DeleteSymbol(uint32_t id)
+{
+    if ((_symbols.size() <= id) || !_symbols_active[id])
+        return ErrorCode::SYMBOL_NOT_FOUND;
+
+    // Call the corresponding handler
+    _market_handler.onDeleteSymbol(_symbols[id]);
+
+    // Erase the symbol
+    _symbols_active[id] = false;
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::AddOrderBook(const Symbol& symbol)
+{
+    // Resize the order books container
+    if (_order_books.size() <= symbol.Id)
+        _order_books.resize(symbol.Id + 1);
+
+    MarketDataBook& order_book = _order_books[symbol.Id];
+    if (order_book._pool != nullptr)
+        return ErrorCode::ORDER_BOOK_DUPLICATE;
+
+    // Initialize the order book
+    order_book.Initialize(_levels, symbol);
+
+    // Call the corresponding handler
+    _market_handler.onAddOrderBook(order_book);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::DeleteOrderBook(uint32_t id)
+{
+    if ((_order_books.size() <= id) || (_order_books[id]._pool == nullptr))
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    MarketDataBook& order_book = _order_books[id];
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrderBook(order_book);
+
+    // Erase all orders of the order book
+    if (!order_book.empty())
+        for (auto& order : _orders)
+            if (order.SymbolId == id)
+                order.Quantity = 0;
+
+    // Release the order book
+    order_book.Release();
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::AddOrder(uint64_t id, uint32_t symbol, OrderSide side, uint32_t price, uint32_t quantity)
+{
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    if ((_order_books.size() <= symbol) || (_order_books[symbol]._pool == nullptr))
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Resize the orders container
+    if (_orders.size() <= id)
+        _orders.resize(std::max((size_t)id + 1, 2 * _orders.size()));
+
+    MarketDataOrder* order_ptr = &_orders[id];
+    if (order_ptr->Quantity > 0)
+        return ErrorCode::ORDER_DUPLICATE;
+
+    // Insert the order
+    order_ptr->Id = id;
+    order_ptr->SymbolId = symbol;
+    order_ptr->Side = side;
+    order_ptr->Price = price;
+    order_ptr->Quantity = quantity;
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(*order_ptr);
+
+    // Add the new order into the order book
+    MarketDataBook& order_book = _order_books[symbol];
+    UpdateLevel(order_book, order_book.AddOrder(order_ptr));
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::ReduceOrder(uint64_t id, uint32_t quantity)
+{
+    MarketDataOrder* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    return ReduceOrder(order_ptr, quantity, false, 0);
+}
+
+ErrorCode MarketDataManager::ReduceOrder(MarketDataOrder* order_ptr, uint32_t quantity, bool execute, uint32_t price)
+{
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Calculate the minimal possible order quantity to reduce
+    quantity = std::min(quantity, order_ptr->Quantity);
+
+    // Call the corresponding handler
+    if (execute)
+        _market_handler.onExecuteOrder(*order_ptr, price, quantity);
+
+    // Reduce the order quantity
+    order_ptr->Quantity -= quantity;
+
+    // Reduce the order in the order book
+    MarketDataBook& order_book = _order_books[order_ptr->SymbolId];
+    MarketDataLevelUpdate update = order_book.ReduceOrder(order_ptr, quantity);
+
+    // Call the corresponding handler
+    if (order_ptr->Quantity > 0)
+        _market_handler.onUpdateOrder(*order_ptr);
+    else
+        _market_handler.onDeleteOrder(*order_ptr);
+
+    UpdateLevel(order_book, update);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::ModifyOrder(uint64_t id, uint32_t new_price, uint32_t new_quantity)
+{
+    MarketDataOrder* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Delete the order from the order book
+    MarketDataBook& order_book = _order_books[order_ptr->SymbolId];
+    UpdateLevel(order_book, order_book.DeleteOrder(order_ptr));
+
+    // Modify the order
+    order_ptr->Price = new_price;
+    order_ptr->Quantity = new_quantity;
+
+    // Update the order or delete the empty order
+    if (order_ptr->Quantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+
+        // Add the modified order into the order book
+        UpdateLevel(order_book, order_book.AddOrder(order_ptr));
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::ReplaceOrder(uint64_t id, uint64_t new_id, uint32_t new_price, uint32_t new_quantity)
+{
+    if ((new_quantity > 0) && (new_id != id) && (FindOrder(new_id) != nullptr))
+        return ErrorCode::ORDER_DUPLICATE;
+    if (FindOrder(id) == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Resize the orders container before taking order pointers
+    if ((new_quantity > 0) && (_orders.size() <= new_id))
+        _orders.resize(std::max((size_t)new_id + 1, 2 * _orders.size()));
+
+    MarketDataOrder* order_ptr = &_orders[id];
+    MarketDataOrder old_order = *order_ptr;
+
+    // Delete the old order from the order book
+    MarketDataBook& order_book = _order_books[order_ptr->SymbolId];
+    UpdateLevel(order_book, order_book.DeleteOrder(order_ptr));
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the old order
+    order_ptr->Quantity = 0;
+
+    if (new_quantity > 0)
+    {
+        // Replace the order
+        MarketDataOrder* new_order_ptr = &_orders[new_id];
+        new_order_ptr->Id = new_id;
+        new_order_ptr->SymbolId = old_order.SymbolId;
+        new_order_ptr->Side = old_order.Side;
+        new_order_ptr->Price = new_price;
+        new_order_ptr->Quantity = new_quantity;
+
+        // Call the corresponding handler
+        _market_handler.onAddOrder(*new_order_ptr);
+
+        // Add the replaced order into the order book
+        UpdateLevel(order_book, order_book.AddOrder(new_order_ptr));
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::DeleteOrder(uint64_t id)
+{
+    MarketDataOrder* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Delete the order from the order book
+    MarketDataBook& order_book = _order_books[order_ptr->SymbolId];
+    UpdateLevel(order_book, order_book.DeleteOrder(order_ptr));
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the order
+    order_ptr->Quantity = 0;
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketDataManager::ExecuteOrder(uint64_t id, uint32_t quantity)
+{
+    MarketDataOrder* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    return ReduceOrder(order_ptr, quantity, true, order_ptr->Price);
+}
+
+ErrorCode MarketDataManager::ExecuteOrder(uint64_t id, uint32_t price, uint32_t quantity)
+{
+    MarketDataOrder* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    return ReduceOrder(order_ptr, quantity, true, price);
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -8,6 +8,23 @@
 
 #include "trader/matching/market_manager.h"
 
+#include <unordered_set>
+
+#if defined(CPPTRADER_STATISTICS)
+#define MARKET_OPERATION_TIMER(operation) MarketOperationTimer market_operation_timer(_statistics, MarketOperation::operation);
+#else
+#define MARKET_OPERATION_TIMER(operation)
+#endif
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+#define MARKET_OPERATION_PERF(operation) Statistics::PerfScope market_operation_perf(_perf_profile, (size_t)MarketOperation::operation);
+#else
+#define MARKET_OPERATION_PERF(operation)
+#endif
+
+// Counters are read outside of the timed scope
+#define MARKET_OPERATION(operation) MARKET_OPERATION_PERF(operation) MARKET_OPERATION_TIMER(operation)
+
 namespace CppTrader {
 namespace Matching {
 
@@ -33,6 +50,46 @@ MarketManager::~MarketManager()
     _symbols.clear();
 }
 
+MarketMemoryStats MarketManager::GetMemoryStats() const
+{
+    MarketMemoryStats stats;
+
+    // Pools
+    stats.OrderPool = { sizeof(OrderNode), _order_memory_manager.allocations(), _order_memory_manager.allocated(), _order_auxiliary_memory_manager.allocated() };
+    stats.LevelPool = { sizeof(LevelNode), _level_memory_manager.allocations(), _level_memory_manager.allocated(), _level_auxiliary_memory_manager.allocated() };
+    stats.SymbolPool = { sizeof(Symbol), _symbol_memory_manager.allocations(), _symbol_memory_manager.allocated(), _symbol_auxiliary_memory_manager.allocated() };
+    stats.OrderBookPool = { sizeof(OrderBook), _order_book_memory_manager.allocations(), _order_book_memory_manager.allocated(), _order_book_auxiliary_memory_manager.allocated() };
+
+    // Orders hash table
+    stats.OrdersSize = _orders.size();
+    stats.OrdersCapacity = _orders.bucket_count();
+    stats.OrdersLoadFactor = (stats.OrdersCapacity > 0) ? ((double)stats.OrdersSize / (double)stats.OrdersCapacity) : 0.0;
+    stats.OrdersReserved = stats.OrdersCapacity * sizeof(std::pair<uint64_t, OrderNode*>);
+
+    // Symbols and order books indexes
+    stats.IndexesReserved = _symbols.capacity() * sizeof(Symbol*) + _order_books.capacity() * sizeof(OrderBook*);
+
+    // Order books
+    for (const auto order_book_ptr : _order_books)
+    {
+        if (order_book_ptr == nullptr)
+            continue;
+
+        OrderBookMemoryStats book;
+        book.SymbolId = order_book_ptr->symbol().Id;
+        book.BidLevels = order_book_ptr->bids().size();
+        book.AskLevels = order_book_ptr->asks().size();
+        book.StopLevels = order_book_ptr->buy_stop().size() + order_book_ptr->sell_stop().size() + order_book_ptr->trailing_buy_stop().size() + order_book_ptr->trailing_sell_stop().size();
+        book.Orders = 0;
+        for (const auto* levels : { &order_book_ptr->bids(), &order_book_ptr->asks(), &order_book_ptr->buy_stop(), &order_book_ptr->sell_stop(), &order_book_ptr->trailing_buy_stop(), &order_book_ptr->trailing_sell_stop() })
+            for (const auto& level : *levels)
+                book.Orders += level.Orders;
+        stats.OrderBooks.push_back(book);
+    }
+
+    return stats;
+}
+
 ErrorCode MarketManager::AddSymbol(const Symbol& symbol)
 {
     // Resize the symbol container
@@ -143,20 +200,108 @@ ErrorCode MarketManager::AddOrder(const Order& order)
     switch (order.Type)
     {
         case OrderType::MARKET:
+        {
+            MARKET_OPERATION(ADD_MARKET);
             return AddMarketOrder(order, false);
+        }
         case OrderType::LIMIT:
+        {
+            MARKET_OPERATION(ADD_LIMIT);
             return AddLimitOrder(order, false);
+        }
         case OrderType::STOP:
         case OrderType::TRAILING_STOP:
+        {
+            MARKET_OPERATION(ADD_STOP);
             return AddStopOrder(order, false);
+        }
         case OrderType::STOP_LIMIT:
         case OrderType::TRAILING_STOP_LIMIT:
+        {
+            MARKET_OPERATION(ADD_STOP);
             return AddStopLimitOrder(order, false);
+        }
         default:
             return ErrorCode::ORDER_TYPE_INVALID;
     }
 }
 
+ErrorCode MarketManager::RestoreOrders(const Order* orders, size_t count)
+{
+    // Orders which could not rest in the order book are skipped
+    auto resting = [](const Order& order) { return !order.IsMarket() && !order.IsIOC() && !order.IsFOK() && (order.LeavesQuantity > 0); };
+
+    // Validate the whole batch first, so an invalid order leaves the market unchanged
+    std::unordered_set<uint64_t> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Order& order = orders[i];
+        if (!resting(order))
+            continue;
+
+        // Validate order parameters
+        ErrorCode result = order.Validate();
+        if (result != ErrorCode::OK)
+            return result;
+
+        // Check the valid order book for the order
+        if (GetOrderBook(order.SymbolId) == nullptr)
+            return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+        // Check duplicates in the market and in the batch
+        if ((_orders.find(order.Id) != _orders.end()) || !ids.insert(order.Id).second)
+            return ErrorCode::ORDER_DUPLICATE;
+    }
+
+    // Grow the orders index once for all restored orders
+    _orders.reserve(_orders.size() + ids.size());
+
+    std::vector<bool> restored(_order_books.size(), false);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Order& order = orders[i];
+        if (!resting(order))
+            continue;
+
+        OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order.SymbolId);
+        restored[order.SymbolId] = true;
+
+        // Create and insert a new order
+        OrderNode* order_ptr = _order_pool.Create(order);
+        _orders.insert(std::make_pair(order_ptr->Id, order_ptr));
+
+        // Add the order into the order book
+        if (order_ptr->IsLimit())
+            UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+        else if (order_ptr->IsTrailingStop() || order_ptr->IsTrailingStopLimit())
+        {
+            // Recalculate the persisted stop price as for a new trailing stop order. Book-wide
+            // RecalculateTrailingStopPrice() only follows market moves since its previous call.
+            order_ptr->StopPrice = order_book_ptr->CalculateTrailingStopPrice(*order_ptr);
+            order_book_ptr->AddTrailingStopOrder(order_ptr);
+        }
+        else
+            order_book_ptr->AddStopOrder(order_ptr);
+    }
+
+    // Activate stop orders triggered by the current prices once per restored order book
+    // (without matching they are activated by EnableMatching())
+    if (_matching)
+    {
+        for (size_t i = 0; i < restored.size(); ++i)
+        {
+            if (!restored[i])
+                continue;
+
+            Match(_order_books[i], false);
+            _order_books[i]->ResetMatchingPrice();
+        }
+    }
+
+    return ErrorCode::OK;
+}
+
 ErrorCode MarketManager::AddMarketOrder(const Order& order, bool internal)
 {
     // Get the valid order book for the order
@@ -451,6 +596,7 @@ ErrorCode MarketManager::AddStopLimitOrder(const Order& order, bool internal)
 
 ErrorCode MarketManager::ReduceOrder(uint64_t id, uint64_t quantity)
 {
+    MARKET_OPERATION(REDUCE);
     return ReduceOrder(id, quantity, false);
 }
 
@@ -556,11 +702,13 @@ ErrorCode MarketManager::ReduceOrder(uint64_t id, uint64_t quantity, bool intern
 
 ErrorCode MarketManager::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
 {
+    MARKET_OPERATION(MODIFY);
     return ModifyOrder(id, new_price, new_quantity, false, false);
 }
 
 ErrorCode MarketManager::MitigateOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
 {
+    MARKET_OPERATION(MODIFY);
     return ModifyOrder(id, new_price, new_quantity, true, false);
 }
 
@@ -679,6 +827,7 @@ ErrorCode MarketManager::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t n
 
 ErrorCode MarketManager::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity)
 {
+    MARKET_OPERATION(REPLACE);
     return ReplaceOrder(id, new_id, new_price, new_quantity, false);
 }
 
@@ -803,6 +952,8 @@ ErrorCode MarketManager::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new
 
 ErrorCode MarketManager::ReplaceOrder(uint64_t id, const Order& new_order)
 {
+    MARKET_OPERATION(REPLACE);
+
     // Delete the previous order by Id
     ErrorCode result = DeleteOrder(id);
     if (result != ErrorCode::OK)
@@ -814,6 +965,7 @@ ErrorCode MarketManager::ReplaceOrder(uint64_t id, const Order& new_order)
 
 ErrorCode MarketManager::DeleteOrder(uint64_t id)
 {
+    MARKET_OPERATION(CANCEL);
     return DeleteOrder(id, false);
 }
 
@@ -876,6 +1028,8 @@ ErrorCode MarketManager::DeleteOrder(uint64_t id, bool internal)
 
 ErrorCode MarketManager::ExecuteOrder(uint64_t id, uint64_t quantity)
 {
+    MARKET_OPERATION(EXECUTE);
+
     // Validate parameters
     assert((id > 0) && "Order Id must be greater than zero!");
     if (id == 0)
@@ -967,6 +1121,8 @@ ErrorCode MarketManager::ExecuteOrder(uint64_t id, uint64_t quantity)
 
 ErrorCode MarketManager::ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity)
 {
+    MARKET_OPERATION(EXECUTE);
+
     // Validate parameters
     assert((id > 0) && "Order Id must be greater than zero!");
     if (id == 0)
@@ -1065,6 +1221,8 @@ void MarketManager::Match()
 
 void MarketManager::Match(OrderBook* order_book_ptr, bool internal)
 {
+    MARKET_OPERATION(MATCH);
+
     // Matching loop
     for (;;)
     {
@@ -1206,6 +1364,8 @@ void MarketManager::MatchLimit(OrderBook* order_book_ptr, Order* order_ptr)
 
 void MarketManager::MatchOrder(OrderBook* order_book_ptr, Order* order_ptr)
 {
+    MARKET_OPERATION(MATCH_ORDER);
+
     // Start the matching from the top of the book
     LevelNode* level_ptr;
     while ((level_ptr = order_ptr->IsBuy() ? order_book_ptr->_best_ask : order_book_ptr->_best_bid) != nullptr)
@@ -1379,6 +1539,8 @@ bool MarketManager::ActivateStopOrders(OrderBook* order_book_ptr, LevelNode* lev
 
 bool MarketManager::ActivateStopOrder(OrderBook* order_book_ptr, OrderNode* order_ptr)
 {
+    MARKET_OPERATION(ACTIVATE_STOP);
+
     // Delete the stop order from the order book
     order_book_ptr->DeleteStopOrder(order_ptr);
 
@@ -1408,6 +1570,8 @@ bool MarketManager::ActivateStopOrder(OrderBook* order_book_ptr, OrderNode* orde
 
 bool MarketManager::ActivateStopLimitOrder(OrderBook* order_book_ptr, OrderNode* order_ptr)
 {
+    MARKET_OPERATION(ACTIVATE_STOP);
+
     // Delete the stop order from the order book
     order_book_ptr->DeleteStopOrder(order_ptr);
 
@@ -0,0 +1,391 @@
+/*!
+    \file market_scenario.cpp
+    \brief Market scenario implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_scenario.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace CppTrader {
+namespace Matching {
+
+namespace {
+
+//! Scenario line token
+struct Token
+{
+    const char* Data;
+    size_t Size;
+
+    bool operator==(const char* keyword) const noexcept
+    {
+        size_t size = std::strlen(keyword);
+        return (Size == size) && (std::memcmp(Data, keyword, size) == 0);
+    }
+    bool operator!=(const char* keyword) const noexcept { return !operator==(keyword); }
+};
+
+//! Maximal count of tokens in a scenario line
+const size_t MAX_TOKENS = 12;
+
+size_t Tokenize(const char* line, size_t size, Token tokens[MAX_TOKENS + 1])
+{
+    size_t count = 0;
+    size_t i = 0;
+    while (i < size)
+    {
+        while ((i < size) && ((line[i] == ' ') || (line[i] == '\t')))
+            ++i;
+        if (i == size)
+            break;
+
+        size_t start = i;
+        while ((i < size) && (line[i] != ' ') && (line[i] != '\t'))
+            ++i;
+
+        // Too many tokens are reported as a separate token count
+        if (count == MAX_TOKENS)
+            return MAX_TOKENS + 1;
+        tokens[count++] = Token{ line + start, i - start };
+    }
+    return count;
+}
+
+bool ParseUnsigned(const Token& token, uint64_t& value) noexcept
+{
+    if ((token.Size == 0) || (token.Size > 20))
+        return false;
+
+    value = 0;
+    for (size_t i = 0; i < token.Size; ++i)
+    {
+        char c = token.Data[i];
+        if ((c < '0') || (c > '9'))
+            return false;
+        uint64_t digit = (uint64_t)(c - '0');
+        if (value > ((UINT64_MAX - digit) / 10))
+            return false;
+        value = value * 10 + digit;
+    }
+    return true;
+}
+
+bool ParseSigned(const Token& token, int64_t& value) noexcept
+{
+    bool negative = (token.Size > 0) && (token.Data[0] == '-');
+    uint64_t absolute;
+    if (!ParseUnsigned(negative ? Token{ token.Data + 1, token.Size - 1 } : token, absolute) || (absolute > (uint64_t)INT64_MAX))
+        return false;
+    value = negative ? -(int64_t)absolute : (int64_t)absolute;
+    return true;
+}
+
+bool ParseSide(const Token& token, OrderSide& side) noexcept
+{
+    if (token == "buy")
+        side = OrderSide::BUY;
+    else if (token == "sell")
+        side = OrderSide::SELL;
+    else
+        return false;
+    return true;
+}
+
+bool ParseUnsigned(const Token* tokens, size_t count, uint64_t* values) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        if (!ParseUnsigned(tokens[i], values[i]))
+            return false;
+    return true;
+}
+
+} // namespace
+
+bool MarketScenario::Parse(const char* text, size_t size)
+{
+    const char* end = text + size;
+
+    // Reserve commands for all lines to avoid reallocations of large scenarios
+    size_t lines = 1;
+    for (const char* it = text; (it = (const char*)std::memchr(it, '\n', (size_t)(end - it))) != nullptr; ++it)
+        ++lines;
+    _commands.reserve(_commands.size() + lines);
+
+    while (text < end)
+    {
+        const char* next = (const char*)std::memchr(text, '\n', (size_t)(end - text));
+        if (next == nullptr)
+            next = end;
+
+        size_t length = (size_t)(next - text);
+        if ((length > 0) && (text[length - 1] == '\r'))
+            --length;
+
+        ++_lines;
+
+        // Parse the command in place of the reserved one
+        bool skip = false;
+        ScenarioCommand& command = _commands.emplace_back();
+        if (!ParseLine(text, length, command, skip))
+        {
+            _commands.pop_back();
+            _error_line = _lines;
+            return false;
+        }
+        if (skip)
+            _commands.pop_back();
+
+        text = (next < end) ? (next + 1) : end;
+    }
+    return true;
+}
+
+bool MarketScenario::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        _error_line = 0;
+        _error = "Cannot open the scenario file: " + path;
+        return false;
+    }
+
+    std::stringstream text;
+    text << file.rdbuf();
+    return Parse(text.str());
+}
+
+size_t MarketScenario::Replay(MarketManager& market) const
+{
+    size_t errors = 0;
+    for (const auto& command : _commands)
+        if (command.Apply(market) != ErrorCode::OK)
+            ++errors;
+    return errors;
+}
+
+void MarketScenario::Clear()
+{
+    _commands.clear();
+    _lines = 0;
+    _error_line = 0;
+    _error.clear();
+}
+
+bool MarketScenario::ParseLine(const char* line, size_t size, ScenarioCommand& command, bool& skip)
+{
+    Token tokens[MAX_TOKENS + 1];
+    size_t count = Tokenize(line, size, tokens);
+
+    // Skip empty lines and comments
+    if ((count == 0) || (tokens[0].Data[0] == '#'))
+    {
+        skip = true;
+        return true;
+    }
+
+    uint64_t values[7];
+
+    if ((count == 2) && ((tokens[0] == "enable") || (tokens[0] == "disable")) && (tokens[1] == "matching"))
+    {
+        command.Type = (tokens[0] == "enable") ? ScenarioCommandType::ENABLE_MATCHING : ScenarioCommandType::DISABLE_MATCHING;
+        return true;
+    }
+    if ((count == 1) && (tokens[0] == "match"))
+    {
+        command.Type = ScenarioCommandType::MATCH;
+        return true;
+    }
+
+    if ((count < 3) || ((tokens[0] != "add") && (tokens[0] != "delete") && (tokens[0] != "reduce") && (tokens[0] != "modify") && (tokens[0] != "mitigate") && (tokens[0] != "replace")))
+    {
+        _error = "Unknown command";
+        return false;
+    }
+
+    // Symbol and order book commands
+    if ((tokens[1] == "symbol") || (tokens[1] == "book"))
+    {
+        bool add = (tokens[0] == "add");
+        bool symbol = (tokens[1] == "symbol");
+        if ((!add && (tokens[0] != "delete")) || (count != ((add && symbol) ? 4 : 3)))
+        {
+            _error = "Invalid symbol or order book command";
+            return false;
+        }
+        if (!ParseUnsigned(tokens[2], values[0]) || (values[0] > UINT32_MAX))
+        {
+            _error = "Invalid symbol Id";
+            return false;
+        }
+        if (add && symbol)
+        {
+            char name[8] = { 0 };
+            std::memcpy(name, tokens[3].Data, std::min(tokens[3].Size, sizeof(name)));
+            command.Symbol = Symbol((uint32_t)values[0], name);
+            command.Type = ScenarioCommandType::ADD_SYMBOL;
+        }
+        else
+        {
+            command.Symbol.Id = (uint32_t)values[0];
+            command.Type = symbol ? (add ? ScenarioCommandType::ADD_SYMBOL : ScenarioCommandType::DELETE_SYMBOL) : (add ? ScenarioCommandType::ADD_BOOK : ScenarioCommandType::DELETE_BOOK);
+        }
+        return true;
+    }
+
+    // Existing order commands
+    if (tokens[1] == "order")
+    {
+        size_t arguments;
+        if (tokens[0] == "reduce")
+        {
+            command.Type = ScenarioCommandType::REDUCE_ORDER;
+            arguments = 2;
+        }
+        else if (tokens[0] == "modify")
+        {
+            command.Type = ScenarioCommandType::MODIFY_ORDER;
+            arguments = 3;
+        }
+        else if (tokens[0] == "mitigate")
+        {
+            command.Type = ScenarioCommandType::MITIGATE_ORDER;
+            arguments = 3;
+        }
+        else if (tokens[0] == "replace")
+        {
+            command.Type = ScenarioCommandType::REPLACE_ORDER;
+            arguments = 4;
+        }
+        else if (tokens[0] == "delete")
+        {
+            command.Type = ScenarioCommandType::DELETE_ORDER;
+            arguments = 1;
+        }
+        else
+        {
+            _error = "Unknown order command";
+            return false;
+        }
+
+        if ((count != (arguments + 2)) || !ParseUnsigned(tokens + 2, arguments, values))
+        {
+            _error = "Invalid order command arguments";
+            return false;
+        }
+
+        command.Order.Id = values[0];
+        switch (command.Type)
+        {
+            case ScenarioCommandType::REDUCE_ORDER:
+                command.Order.Quantity = values[1];
+                break;
+            case ScenarioCommandType::MODIFY_ORDER:
+            case ScenarioCommandType::MITIGATE_ORDER:
+                command.Order.Price = values[1];
+                command.Order.Quantity = values[2];
+                break;
+            case ScenarioCommandType::REPLACE_ORDER:
+                command.NewId = values[1];
+                command.Order.Price = values[2];
+                command.Order.Quantity = values[3];
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    if (tokens[0] != "add")
+    {
+        _error = "Unknown command";
+        return false;
+    }
+
+    // New order commands: "add [modifier] type side id symbol arguments..."
+    size_t index = 1;
+    OrderTimeInForce tif = OrderTimeInForce::GTC;
+    bool slippage = false;
+    bool trailing = false;
+    if (tokens[index] == "ioc")
+        tif = OrderTimeInForce::IOC;
+    else if (tokens[index] == "fok")
+        tif = OrderTimeInForce::FOK;
+    else if (tokens[index] == "aon")
+        tif = OrderTimeInForce::AON;
+    else if (tokens[index] == "slippage")
+        slippage = true;
+    else if (tokens[index] == "trailing")
+        trailing = true;
+    if ((tif != OrderTimeInForce::GTC) || slippage || trailing)
+        ++index;
+
+    if (index + 3 >= count)
+    {
+        _error = "Invalid order command arguments";
+        return false;
+    }
+
+    Token type = tokens[index++];
+    OrderSide side;
+    if (!ParseSide(tokens[index++], side))
+    {
+        _error = "Invalid order side";
+        return false;
+    }
+
+    // Count of unsigned arguments after the side (Id, SymbolId, ...) and signed trailing arguments
+    size_t arguments;
+    if ((type == "market") && (tif == OrderTimeInForce::GTC) && !trailing)
+        arguments = slippage ? 4 : 3;
+    else if ((type == "limit") && !slippage && !trailing)
+        arguments = 4;
+    else if ((type == "stop") && (tif == OrderTimeInForce::GTC) && !slippage)
+        arguments = 4;
+    else if ((type == "stop-limit") && (tif == OrderTimeInForce::GTC) && !slippage)
+        arguments = 5;
+    else
+    {
+        _error = "Unknown order type";
+        return false;
+    }
+
+    if ((count != (index + arguments + (trailing ? 2 : 0))) || !ParseUnsigned(tokens + index, arguments, values) || (values[1] > UINT32_MAX))
+    {
+        _error = "Invalid order command arguments";
+        return false;
+    }
+
+    int64_t distance = 0;
+    int64_t step = 0;
+    if (trailing && (!ParseSigned(tokens[index + arguments], distance) || !ParseSigned(tokens[index + arguments + 1], step)))
+    {
+        _error = "Invalid trailing distance or step";
+        return false;
+    }
+
+    uint64_t id = values[0];
+    uint32_t symbol = (uint32_t)values[1];
+    if (type == "market")
+        command.Order = Order::Market(id, symbol, side, values[2], slippage ? values[3] : ORDER_INT_MAX);
+    else if (type == "limit")
+        command.Order = Order::Limit(id, symbol, side, values[2], values[3], tif);
+    else if (type == "stop")
+        command.Order = trailing ? Order::TrailingStop(id, symbol, side, values[2], values[3], distance, step) : Order::Stop(id, symbol, side, values[2], values[3]);
+    else
+        command.Order = trailing ? Order::TrailingStopLimit(id, symbol, side, values[2], values[3], values[4], distance, step) : Order::StopLimit(id, symbol, side, values[2], values[3], values[4]);
+
+    command.Type = ScenarioCommandType::ADD_ORDER;
+    return true;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,214 @@
+/*!
+    \file symbol_registry.cpp
+    \brief Symbol registry implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/symbol_registry.h"
+#include "trader/redis_db.h"
+
+#include <charconv>
+#include <chrono>
+#include <iostream>
+
+namespace CppTrader {
+namespace Matching {
+
+namespace {
+
+const char SYMBOL_PATTERN[] = "symbol:*";
+const char NOTIFICATIONS_PATTERN[] = "__keyspace@*__:symbol:*";
+const std::chrono::milliseconds CONSUME_TIMEOUT(100);
+
+// Parse the symbol Id from the 'symbol:<Id>' key
+bool ParseKey(const std::string& key, uint32_t& id)
+{
+    size_t separator = key.rfind(':');
+    if (separator == std::string::npos)
+        return false;
+    const char* last = key.data() + key.size();
+    auto result = std::from_chars(key.data() + separator + 1, last, id);
+    return (result.ec == std::errc()) && (result.ptr == last);
+}
+
+// Is the keyspace event removing the key?
+bool IsRemoval(const std::string& event)
+{
+    return (event == "del") || (event == "expired") || (event == "evicted") || (event == "rename_from");
+}
+
+// Make the symbol change from the fetched 'symbol:<Id>' hash (empty hash of the removed key)
+bool MakeChange(const std::string& key, const std::unordered_map<std::string, std::string>& hash, uint32_t& id, bool& removed, Symbol& symbol)
+{
+    removed = hash.empty();
+    if (removed)
+        return ParseKey(key, id);
+    if (!Symbol::Parse(hash, symbol))
+    {
+        std::cout << "Malformed symbol: " << key << std::endl;
+        return false;
+    }
+    id = symbol.Id;
+    return true;
+}
+
+} // namespace
+
+SymbolRegistry::SymbolRegistry() : _redis(std::make_unique<MyRedis>())
+{
+}
+
+SymbolRegistry::~SymbolRegistry()
+{
+    Stop();
+}
+
+size_t SymbolRegistry::Load()
+{
+    std::vector<Change> changes;
+    Fetch(changes, _redis->_scan_db(SYMBOL_PATTERN));
+
+    size_t count = 0;
+    for (const auto& change : changes)
+        if (Apply(change) && !change.Removed)
+            ++count;
+    return count;
+}
+
+bool SymbolRegistry::Start()
+{
+    if (IsStarted())
+        return false;
+
+    _stop = false;
+    _thread = std::thread([this]() { Run(); });
+    return true;
+}
+
+bool SymbolRegistry::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    _stop = true;
+    _thread.join();
+    return true;
+}
+
+void SymbolRegistry::Push(const Symbol& symbol)
+{
+    std::scoped_lock locker(_mutex);
+    Queue(Change{ symbol.Id, false, symbol });
+}
+
+void SymbolRegistry::Remove(uint32_t id)
+{
+    std::scoped_lock locker(_mutex);
+    Queue(Change{ id, true, Symbol() });
+}
+
+void SymbolRegistry::Queue(const Change& change)
+{
+    // Called under the queue lock
+    // The latest change of the symbol replaces the one not applied yet
+    auto it = _queued.find(change.Id);
+    if (it != _queued.end())
+        _changes[it->second] = change;
+    else
+    {
+        _queued.emplace(change.Id, _changes.size());
+        _changes.push_back(change);
+    }
+    _pending.store(true, std::memory_order_release);
+}
+
+void SymbolRegistry::Queue(std::vector<Change>& changes)
+{
+    if (changes.empty())
+        return;
+
+    std::scoped_lock locker(_mutex);
+    for (const auto& change : changes)
+        Queue(change);
+    changes.clear();
+}
+
+void SymbolRegistry::Fetch(std::vector<Change>& changes, const std::vector<std::string>& keys)
+{
+    // Hashes are read with a single pipelined round trip over the shared connection
+    auto hashes = _redis->_hgetall_db(keys);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        Change change = { 0, false, Symbol() };
+        if (MakeChange(keys[i], hashes[i], change.Id, change.Removed, change.Data))
+            changes.push_back(change);
+    }
+}
+
+void SymbolRegistry::Notify(const std::string& channel, const std::string& event)
+{
+    // Channel is '__keyspace@<db>__:<key>'
+    size_t separator = channel.find("__:");
+    if (separator == std::string::npos)
+        return;
+    std::string key = channel.substr(separator + 3);
+
+    Change change = { 0, true, Symbol() };
+    if (IsRemoval(event))
+    {
+        if (ParseKey(key, change.Id))
+            Remove(change.Id);
+        return;
+    }
+
+    // Plain HGETALL over the shared connection
+    if (!MakeChange(key, _redis->_hgetall_db(key), change.Id, change.Removed, change.Data))
+        return;
+    if (change.Removed)
+        Remove(change.Id);
+    else
+        Push(change.Data);
+}
+
+void SymbolRegistry::Run()
+{
+    std::vector<Change> changes;
+
+    while (!_stop)
+    {
+        auto subscriber = _redis->_subscriber_db(CONSUME_TIMEOUT);
+        if (subscriber)
+        {
+            try {
+                subscriber->on_pmessage([this](std::string pattern, std::string channel, std::string event) { Notify(channel, event); });
+                subscriber->psubscribe(NOTIFICATIONS_PATTERN);
+                // Wait for the subscription confirmation
+                subscriber->consume();
+
+                // Changes made before the subscription have no notifications
+                Fetch(changes, _redis->_scan_db(SYMBOL_PATTERN));
+                Queue(changes);
+
+                while (!_stop)
+                {
+                    try {
+                        subscriber->consume();
+                    }catch (const sw::redis::TimeoutError&) {
+                    }
+                }
+                return;
+            }catch (const sw::redis::Error &e) {
+                std::cout << e.what() << std::endl;
+            }
+        }
+
+        // Reconnect after the timeout
+        for (int i = 0; (i < 10) && !_stop; ++i)
+            std::this_thread::sleep_for(CONSUME_TIMEOUT);
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
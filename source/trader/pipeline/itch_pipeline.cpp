@@ -0,0 +1,342 @@
+/*!
+    \file itch_pipeline.cpp
+    \brief NASDAQ ITCH processing pipeline implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/pipeline/itch_pipeline.h"
+
+#include "trader/providers/nasdaq/moldudp64_handler.h"
+#include "trader/replay/event_replayer.h"
+#include "trader/replay/itch_converter.h"
+
+#include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <bitset>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace CppTrader {
+namespace Pipeline {
+
+namespace {
+
+const size_t EXTERNAL_SLOT = std::numeric_limits<size_t>::max();
+
+} // namespace
+
+class ITCHPipeline::Queues
+{
+public:
+    CppCommon::SPSCRingQueue<size_t> Free;
+    CppCommon::SPSCRingQueue<Chunk> Chunks;
+    CppCommon::SPSCRingQueue<EventItem> Events;
+    std::vector<std::unique_ptr<CppCommon::SPSCRingQueue<UpdateItem>>> Updates;
+    std::vector<uint8_t> Pool;
+
+    std::atomic<bool> ReaderDone;
+    std::atomic<bool> ParserDone;
+    std::atomic<bool> BookDone;
+
+    explicit Queues(const PipelineSettings& settings)
+        : Free(settings.Chunks * 2),
+          Chunks(settings.Chunks * 2),
+          Events(settings.EventsQueue),
+          ReaderDone(false),
+          ParserDone(false),
+          BookDone(false)
+    {
+        for (size_t i = 0; i < settings.Consumers; ++i)
+            Updates.emplace_back(new CppCommon::SPSCRingQueue<UpdateItem>(settings.UpdatesQueue));
+    }
+};
+
+class ITCHPipeline::Converter : public Replay::ITCHConverter
+{
+public:
+    Converter(ITCHPipeline& pipeline, Queues& queues) : _pipeline(pipeline), _queues(queues) {}
+
+protected:
+    bool onEvent(const Replay::Event& event) override
+    {
+        EventItem item;
+        item.Event = event;
+        item.Timestamp = CppCommon::Timestamp::nano();
+        _pipeline.Push(_queues.Events, item, _pipeline._parser);
+        return !_pipeline._failed.load(std::memory_order_relaxed);
+    }
+
+private:
+    ITCHPipeline& _pipeline;
+    Queues& _queues;
+};
+
+ITCHPipeline::ITCHPipeline(Matching::MarketManager& market, const PipelineSettings& settings)
+    : _market(market),
+      _settings(settings),
+      _consumers(settings.Consumers),
+      _bytes(0),
+      _messages(0),
+      _errors(0),
+      _parser_errors(0),
+      _book_errors(0),
+      _failed(false)
+{
+    assert((_settings.ChunkSize > 0) && "Pipeline chunk size must be positive!");
+    assert(((_settings.Chunks & (_settings.Chunks - 1)) == 0) && "Pipeline chunks count must be a power of two!");
+    assert(((_settings.EventsQueue & (_settings.EventsQueue - 1)) == 0) && "Pipeline events queue capacity must be a power of two!");
+    assert(((_settings.UpdatesQueue & (_settings.UpdatesQueue - 1)) == 0) && "Pipeline updates queue capacity must be a power of two!");
+}
+
+bool ITCHPipeline::Run(CppCommon::Reader* input, const uint8_t* buffer, size_t size)
+{
+    // Reset statistics
+    _reader = PipelineStage();
+    _parser = PipelineStage();
+    _book = PipelineStage();
+    _consumers.assign(_settings.Consumers, PipelineStage());
+    _bytes = 0;
+    _messages = 0;
+    _errors = 0;
+    _parser_errors = 0;
+    _book_errors = 0;
+    _failed = false;
+
+    Queues queues(_settings);
+
+    // Prepare recycled input chunks
+    if (input != nullptr)
+    {
+        queues.Pool.resize(_settings.Chunks * _settings.ChunkSize);
+        for (size_t i = 0; i < _settings.Chunks; ++i)
+            queues.Free.Enqueue(i);
+    }
+
+    // Start pipeline threads from the last stage to the first one
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < _settings.Consumers; ++i)
+        threads.emplace_back([this, &queues, i]() { ConsumerThread(queues, i); });
+    threads.emplace_back([this, &queues]() { BookThread(queues); });
+    threads.emplace_back([this, &queues]() { ParserThread(queues); });
+    threads.emplace_back([this, &queues, input, buffer, size]() { ReaderThread(queues, input, buffer, size); });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Errors are collected by each stage and summed when all stages are stopped
+    _errors = _parser_errors + _book_errors;
+
+    return !_failed;
+}
+
+void ITCHPipeline::ReaderThread(Queues& queues, CppCommon::Reader* input, const uint8_t* buffer, size_t size)
+{
+    Pin(_settings.ReaderCore);
+
+    size_t offset = 0;
+    while (!_failed.load(std::memory_order_relaxed))
+    {
+        uint64_t start = CppCommon::Timestamp::nano();
+
+        Chunk chunk;
+        if (input != nullptr)
+        {
+            // Wait for the free chunk
+            size_t slot = 0;
+            size_t spins = 0;
+            bool dequeued = queues.Free.Dequeue(slot);
+            while (!dequeued && !_failed.load(std::memory_order_relaxed))
+            {
+                Wait(spins);
+                dequeued = queues.Free.Dequeue(slot);
+            }
+            if (!dequeued)
+                break;
+
+            uint64_t ready = CppCommon::Timestamp::nano();
+            _reader.Queueing.Record(ready - start);
+            start = ready;
+
+            uint8_t* data = queues.Pool.data() + slot * _settings.ChunkSize;
+            size_t read = input->Read(data, _settings.ChunkSize);
+            if (read == 0)
+                break;
+
+            chunk.Data = data;
+            chunk.Size = read;
+            chunk.Slot = slot;
+        }
+        else
+        {
+            if (offset >= size)
+                break;
+
+            chunk.Data = buffer + offset;
+            chunk.Size = std::min(_settings.ChunkSize, size - offset);
+            chunk.Slot = EXTERNAL_SLOT;
+            offset += chunk.Size;
+        }
+
+        chunk.Timestamp = CppCommon::Timestamp::nano();
+        _reader.Service.Record(chunk.Timestamp - start);
+        _bytes += chunk.Size;
+        ++_reader.Items;
+
+        Push(queues.Chunks, chunk, _reader);
+    }
+
+    queues.ReaderDone.store(true, std::memory_order_release);
+}
+
+void ITCHPipeline::ParserThread(Queues& queues)
+{
+    Pin(_settings.ParserCore);
+
+    Converter converter(*this, queues);
+    ITCH::MoldUDP64Handler mold(converter, _settings.Port);
+
+    Chunk chunk;
+    while (Pop(queues.Chunks, chunk, queues.ReaderDone))
+    {
+        uint64_t start = CppCommon::Timestamp::nano();
+        _parser.Queueing.Record(start - chunk.Timestamp);
+
+        bool result = (_settings.Format == InputFormat::PCAP) ? mold.Process((void*)chunk.Data, chunk.Size) : converter.Process((void*)chunk.Data, chunk.Size);
+
+        // Recycle the chunk
+        if (chunk.Slot != EXTERNAL_SLOT)
+            queues.Free.Enqueue(chunk.Slot);
+
+        _parser.Service.Record(CppCommon::Timestamp::nano() - start);
+        ++_parser.Items;
+
+        if (!result)
+        {
+            _failed = true;
+            break;
+        }
+    }
+
+    _messages = converter.messages();
+    _parser_errors = converter.errors();
+
+    queues.ParserDone.store(true, std::memory_order_release);
+}
+
+void ITCHPipeline::BookThread(Queues& queues)
+{
+    Pin(_settings.BookCore);
+
+    Replay::EventReplayer replayer(_market);
+
+    EventItem item;
+    while (Pop(queues.Events, item, queues.ParserDone))
+    {
+        uint64_t start = CppCommon::Timestamp::nano();
+        _book.Queueing.Record(start - item.Timestamp);
+
+        replayer.Replay(item.Event);
+
+        UpdateItem update;
+        update.Update.Event = item.Event;
+        const Matching::OrderBook* order_book_ptr = _market.GetOrderBook(item.Event.Symbol);
+        const Matching::LevelNode* bid_ptr = (order_book_ptr != nullptr) ? order_book_ptr->best_bid() : nullptr;
+        const Matching::LevelNode* ask_ptr = (order_book_ptr != nullptr) ? order_book_ptr->best_ask() : nullptr;
+        update.Update.BidPrice = (bid_ptr != nullptr) ? bid_ptr->Price : 0;
+        update.Update.BidVolume = (bid_ptr != nullptr) ? bid_ptr->VisibleVolume : 0;
+        update.Update.AskPrice = (ask_ptr != nullptr) ? ask_ptr->Price : 0;
+        update.Update.AskVolume = (ask_ptr != nullptr) ? ask_ptr->VisibleVolume : 0;
+        update.Timestamp = CppCommon::Timestamp::nano();
+
+        _book.Service.Record(update.Timestamp - start);
+        ++_book.Items;
+
+        for (auto& queue : queues.Updates)
+            Push(*queue, update, _book);
+    }
+
+    _book_errors = replayer.errors();
+
+    queues.BookDone.store(true, std::memory_order_release);
+}
+
+void ITCHPipeline::ConsumerThread(Queues& queues, size_t index)
+{
+    Pin((index < _settings.ConsumerCores.size()) ? _settings.ConsumerCores[index] : -1);
+
+    PipelineStage& stage = _consumers[index];
+
+    UpdateItem item;
+    while (Pop(*queues.Updates[index], item, queues.BookDone))
+    {
+        uint64_t start = CppCommon::Timestamp::nano();
+        stage.Queueing.Record(start - item.Timestamp);
+
+        onUpdate(index, item.Update);
+
+        stage.Service.Record(CppCommon::Timestamp::nano() - start);
+        ++stage.Items;
+    }
+}
+
+template <class TQueue, typename T>
+void ITCHPipeline::Push(TQueue& queue, T& item, PipelineStage& stage)
+{
+    if (queue.Enqueue(item))
+        return;
+
+    ++stage.Stalls;
+
+    size_t spins = 0;
+    while (!queue.Enqueue(item))
+    {
+        if (_failed.load(std::memory_order_relaxed))
+            return;
+        Wait(spins);
+    }
+}
+
+template <class TQueue, typename T>
+bool ITCHPipeline::Pop(TQueue& queue, T& item, const std::atomic<bool>& done)
+{
+    size_t spins = 0;
+    while (!queue.Dequeue(item))
+    {
+        // Check the queue once again after the producer is done
+        if (done.load(std::memory_order_acquire))
+            return queue.Dequeue(item);
+        if (_failed.load(std::memory_order_relaxed))
+            return false;
+        Wait(spins);
+    }
+    return true;
+}
+
+void ITCHPipeline::Wait(size_t& spins) const
+{
+    if (_settings.Wait == WaitPolicy::BUSY_POLL)
+        return;
+
+    // Spin for a while, then give up the time slice
+    if (++spins > 128)
+        CppCommon::Thread::Yield();
+}
+
+void ITCHPipeline::Pin(int core)
+{
+    if ((core < 0) || (core >= 64))
+        return;
+
+    std::bitset<64> affinity;
+    affinity.set((size_t)core);
+    CppCommon::Thread::SetAffinity(affinity);
+}
+
+} // namespace Pipeline
+} // namespace CppTrader
@@ -0,0 +1,186 @@
+/*!
+    \file itch_batch.cpp
+    \brief NASDAQ ITCH message batch decoding implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_batch.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+size_t ITCHHandler::Decode(const void* buffer, size_t size, MessageBatch& batch)
+{
+    size_t index = 0;
+    const uint8_t* base = (const uint8_t*)buffer;
+
+    while (!batch.full() && ((index + 2) <= size))
+    {
+        uint16_t message_size;
+        CppCommon::Endian::ReadBigEndian(&base[index], message_size);
+
+        // Leave the incomplete message for the next buffer
+        if ((index + 2 + message_size) > size)
+            break;
+
+        const uint8_t* data = &base[index + 2];
+        index += 2 + message_size;
+
+        if (message_size == 0)
+            continue;
+
+        char type = (char)data[0];
+        size_t item = batch._size;
+        uint32_t position = MessageBatch::NONE;
+
+        switch (type)
+        {
+            case 'A':
+            case 'F':
+            {
+                if (message_size != ((type == 'A') ? 36 : 40))
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                AddOrderBatch& group = batch.AddOrders;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OrderReferenceNumber[position]);
+                group.BuySellIndicator[position] = (char)*data++;
+                data += CppCommon::Endian::ReadBigEndian(data, group.Shares[position]);
+                std::memcpy(group.Stock[position].data(), data, 8);
+                data += 8;
+                data += CppCommon::Endian::ReadBigEndian(data, group.Price[position]);
+                group.Attribution[position] = (type == 'F') ? (char)*data : '\0';
+                break;
+            }
+            case 'E':
+            case 'C':
+            {
+                if (message_size != ((type == 'E') ? 31 : 36))
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                OrderExecutedBatch& group = batch.OrderExecutions;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OrderReferenceNumber[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.ExecutedShares[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.MatchNumber[position]);
+                if (type == 'C')
+                {
+                    group.Printable[position] = (char)*data++;
+                    data += CppCommon::Endian::ReadBigEndian(data, group.ExecutionPrice[position]);
+                }
+                else
+                {
+                    group.Printable[position] = '\0';
+                    group.ExecutionPrice[position] = 0;
+                }
+                break;
+            }
+            case 'X':
+            {
+                if (message_size != 23)
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                OrderCancelBatch& group = batch.OrderCancels;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OrderReferenceNumber[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.CanceledShares[position]);
+                break;
+            }
+            case 'D':
+            {
+                if (message_size != 19)
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                OrderDeleteBatch& group = batch.OrderDeletes;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OrderReferenceNumber[position]);
+                break;
+            }
+            case 'U':
+            {
+                if (message_size != 35)
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                OrderReplaceBatch& group = batch.OrderReplaces;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OriginalOrderReferenceNumber[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.NewOrderReferenceNumber[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.Shares[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.Price[position]);
+                break;
+            }
+            case 'P':
+            {
+                if (message_size != 44)
+                {
+                    ++batch.Errors;
+                    continue;
+                }
+
+                TradeBatch& group = batch.Trades;
+                position = (uint32_t)group.Count++;
+                data += 1;
+                data += CppCommon::Endian::ReadBigEndian(data, group.StockLocate[position]);
+                data += 2;
+                data += ReadTimestamp(data, group.Timestamp[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.OrderReferenceNumber[position]);
+                group.BuySellIndicator[position] = (char)*data++;
+                data += CppCommon::Endian::ReadBigEndian(data, group.Shares[position]);
+                std::memcpy(group.Stock[position].data(), data, 8);
+                data += 8;
+                data += CppCommon::Endian::ReadBigEndian(data, group.Price[position]);
+                data += CppCommon::Endian::ReadBigEndian(data, group.MatchNumber[position]);
+                break;
+            }
+            default:
+                ++batch.Others;
+                break;
+        }
+
+        batch.Types[item] = type;
+        batch.Indexes[item] = position;
+        ++batch._size;
+    }
+
+    return index;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -101,6 +101,10 @@ bool ITCHHandler::Process(void* buffer, size_t size)
 
 bool ITCHHandler::ProcessMessage(void* buffer, size_t size)
 {
+#if defined(CPPTRADER_PERF_COUNTERS)
+    Statistics::PerfScope perf_scope(_perf_profile, 0);
+#endif
+
     // Message is empty
     if (size == 0)
         return false;
@@ -0,0 +1,290 @@
+/*!
+    \file itch_index.cpp
+    \brief NASDAQ ITCH time index implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_index.h"
+
+#include "trader/replay/event_replayer.h"
+
+#include "filesystem/file.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace CppTrader {
+namespace ITCH {
+
+namespace {
+
+//! ITCH index file header
+struct ITCHIndexHeader
+{
+    char Magic[8];
+    uint32_t Version;
+    uint32_t EventSize;
+    uint64_t Interval;
+    uint64_t Entries;
+    uint64_t Events;
+};
+
+const char ITCH_INDEX_MAGIC[8] = { 'C', 'P', 'P', 'T', 'I', 'D', 'X', '1' };
+const uint32_t ITCH_INDEX_VERSION = 1;
+
+} // namespace
+
+bool ITCHIndex::Restore(const ITCHIndexEntry& entry, Matching::MarketManager& market) const
+{
+    if ((entry.SnapshotSize == 0) || ((entry.SnapshotOffset + entry.SnapshotSize) > _snapshots.size()))
+        return false;
+
+    Replay::EventReplayer replayer(market);
+    const Replay::Event* events = _snapshots.data() + entry.SnapshotOffset;
+    replayer.Replay(events, events + entry.SnapshotSize);
+
+    return replayer.errors() == 0;
+}
+
+void ITCHIndex::Save(const CppCommon::Path& path) const
+{
+    ITCHIndexHeader header;
+    std::memcpy(header.Magic, ITCH_INDEX_MAGIC, sizeof(header.Magic));
+    header.Version = ITCH_INDEX_VERSION;
+    header.EventSize = sizeof(Replay::Event);
+    header.Interval = _interval;
+    header.Entries = _entries.size();
+    header.Events = _snapshots.size();
+
+    CppCommon::File file(path);
+    file.OpenOrCreate(false, true, true);
+    file.Write(&header, sizeof(header));
+    file.Write(_entries.data(), _entries.size() * sizeof(ITCHIndexEntry));
+    file.Write(_snapshots.data(), _snapshots.size() * sizeof(Replay::Event));
+    file.Close();
+}
+
+bool ITCHIndex::Load(const CppCommon::Path& path)
+{
+    Clear();
+
+    CppCommon::File file(path);
+    file.Open(true, false);
+
+    ITCHIndexHeader header;
+    if ((file.Read(&header, sizeof(header)) != sizeof(header)) ||
+        (std::memcmp(header.Magic, ITCH_INDEX_MAGIC, sizeof(header.Magic)) != 0) ||
+        (header.Version != ITCH_INDEX_VERSION) ||
+        (header.EventSize != sizeof(Replay::Event)))
+        return false;
+
+    _entries.resize((size_t)header.Entries);
+    _snapshots.resize((size_t)header.Events);
+
+    size_t entries_size = _entries.size() * sizeof(ITCHIndexEntry);
+    size_t snapshots_size = _snapshots.size() * sizeof(Replay::Event);
+    if ((file.Read(_entries.data(), entries_size) != entries_size) ||
+        (file.Read(_snapshots.data(), snapshots_size) != snapshots_size))
+    {
+        Clear();
+        return false;
+    }
+
+    _interval = header.Interval;
+    return true;
+}
+
+void ITCHIndex::Clear()
+{
+    _interval = 0;
+    _entries.clear();
+    _snapshots.clear();
+}
+
+ITCHIndexBuilder::ITCHIndexBuilder(ITCHIndex& index, uint64_t interval, ITCHHandler* itch_handler, const Matching::MarketManager* market)
+    : _index(index),
+      _itch_handler(itch_handler),
+      _market(market)
+{
+    assert((interval > 0) && "ITCH index interval must be positive!");
+    _index._interval = std::max(interval, (uint64_t)1);
+    Reset();
+}
+
+void ITCHIndexBuilder::Reset()
+{
+    uint64_t interval = _index._interval;
+    _index.Clear();
+    _index._interval = interval;
+    _offset = 0;
+    _messages = 0;
+    _boundary = 0;
+    _size = 0;
+    _cache.clear();
+
+    // The first checkpoint is always the beginning of the stream
+    Checkpoint(0);
+}
+
+bool ITCHIndexBuilder::Process(void* buffer, size_t size)
+{
+    size_t index = 0;
+    uint8_t* data = (uint8_t*)buffer;
+
+    while (index < size)
+    {
+        size_t remaining = size - index;
+
+        if (_size == 0)
+        {
+            // Collect message size into the cache
+            if (((_cache.size() == 0) && (remaining < 2)) || (_cache.size() == 1))
+            {
+                _cache.push_back(data[index++]);
+                continue;
+            }
+
+            uint16_t message_size;
+            if (_cache.empty())
+            {
+                CppCommon::Endian::ReadBigEndian(&data[index], message_size);
+                index += 2;
+            }
+            else
+            {
+                CppCommon::Endian::ReadBigEndian(_cache.data(), message_size);
+                _cache.clear();
+            }
+
+            // Skip empty messages
+            if (message_size == 0)
+            {
+                _offset += 2;
+                continue;
+            }
+
+            _size = message_size;
+            continue;
+        }
+
+        // Complete or place the message into the cache
+        if (!_cache.empty() || (_size > remaining))
+        {
+            size_t tail = std::min(_size - _cache.size(), remaining);
+            _cache.insert(_cache.end(), &data[index], &data[index + tail]);
+            index += tail;
+            if (_cache.size() < _size)
+                continue;
+
+            if (!ProcessMessage(_cache.data(), _size))
+                return false;
+            _cache.clear();
+        }
+        else
+        {
+            if (!ProcessMessage(&data[index], _size))
+                return false;
+            index += _size;
+        }
+
+        _size = 0;
+    }
+
+    return true;
+}
+
+bool ITCHIndexBuilder::ProcessMessage(uint8_t* buffer, size_t size)
+{
+    // All ITCH messages share the common header: type, stock locate, tracking number and 6 bytes timestamp
+    if (size >= 11)
+    {
+        uint64_t timestamp = ((uint64_t)buffer[5] << 40) | ((uint64_t)buffer[6] << 32) | ((uint64_t)buffer[7] << 24) | ((uint64_t)buffer[8] << 16) | ((uint64_t)buffer[9] << 8) | (uint64_t)buffer[10];
+        if (timestamp >= _boundary)
+            Checkpoint(timestamp);
+    }
+
+    if ((_itch_handler != nullptr) && !_itch_handler->ProcessMessage(buffer, size))
+        return false;
+
+    _offset += 2 + size;
+    ++_messages;
+    return true;
+}
+
+void ITCHIndexBuilder::Checkpoint(uint64_t timestamp)
+{
+    const uint64_t interval = _index._interval;
+
+    ITCHIndexEntry entry;
+    entry.Timestamp = (timestamp / interval) * interval;
+    entry.Offset = _offset;
+    entry.Messages = _messages;
+    entry.SnapshotOffset = _index._snapshots.size();
+    entry.SnapshotSize = 0;
+
+    // Replace the checkpoint with the same offset (e.g. stream start)
+    if (!_index._entries.empty() && (_index._entries.back().Offset == _offset))
+    {
+        entry.Timestamp = _index._entries.back().Timestamp;
+        entry.SnapshotOffset = _index._entries.back().SnapshotOffset;
+        _index._snapshots.resize((size_t)entry.SnapshotOffset);
+        _index._entries.pop_back();
+    }
+
+    if (_market != nullptr)
+    {
+        Snapshot();
+        entry.SnapshotSize = _index._snapshots.size() - entry.SnapshotOffset;
+    }
+
+    _index._entries.push_back(entry);
+    _boundary = (timestamp / interval + 1) * interval;
+}
+
+void ITCHIndexBuilder::Snapshot()
+{
+    Replay::Event event;
+    std::memset(&event, 0, sizeof(event));
+
+    // Symbols and order books
+    event.Type = Replay::EventType::SYMBOL;
+    for (const auto symbol : _market->symbols())
+    {
+        if (symbol == nullptr)
+            continue;
+
+        event.Symbol = symbol->Id;
+        std::memcpy(event.Name, symbol->Name, sizeof(event.Name));
+        _index._snapshots.push_back(event);
+    }
+
+    // Limit orders in price-time priority
+    event.Type = Replay::EventType::ADD;
+    event.NewOrderId = 0;
+    for (const auto order_book : _market->order_books())
+    {
+        if (order_book == nullptr)
+            continue;
+
+        for (const auto* levels : { &order_book->bids(), &order_book->asks() })
+        {
+            for (const auto& level : *levels)
+            {
+                for (const auto& order : level.OrderList)
+                {
+                    event.Symbol = order.SymbolId;
+                    event.OrderId = order.Id;
+                    event.Side = order.Side;
+                    event.Price = (uint32_t)order.Price;
+                    event.Quantity = (uint32_t)order.LeavesQuantity;
+                    _index._snapshots.push_back(event);
+                }
+            }
+        }
+    }
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -0,0 +1,589 @@
+/*!
+    \file moldudp64_handler.cpp
+    \brief NASDAQ MoldUDP64 handler implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/moldudp64_handler.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace CppTrader {
+namespace ITCH {
+
+namespace {
+
+// Capture file magic numbers
+const uint32_t PCAP_MAGIC_MICRO = 0xA1B2C3D4;
+const uint32_t PCAP_MAGIC_NANO = 0xA1B23C4D;
+const uint32_t PCAP_MAGIC_MICRO_SWAPPED = 0xD4C3B2A1;
+const uint32_t PCAP_MAGIC_NANO_SWAPPED = 0x4D3CB2A1;
+const uint32_t PCAPNG_BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+
+// Capture file header sizes
+const size_t PCAP_HEADER_SIZE = 24;
+const size_t PCAP_RECORD_HEADER_SIZE = 16;
+const size_t PCAPNG_BLOCK_HEADER_SIZE = 12;
+
+// Maximal captured packet size (the largest default snaplen of capture tools),
+// larger records or blocks are treated as corrupted headers
+const uint32_t MAX_SNAPLEN = 262144;
+const uint32_t MAX_PCAPNG_BLOCK_SIZE = MAX_SNAPLEN + 1024;
+
+// pcapng block types
+const uint32_t PCAPNG_SECTION_HEADER_BLOCK = 0x0A0D0D0A;
+const uint32_t PCAPNG_INTERFACE_DESCRIPTION_BLOCK = 0x00000001;
+const uint32_t PCAPNG_PACKET_BLOCK = 0x00000002;
+const uint32_t PCAPNG_SIMPLE_PACKET_BLOCK = 0x00000003;
+const uint32_t PCAPNG_ENHANCED_PACKET_BLOCK = 0x00000006;
+
+// Link types
+const uint32_t LINKTYPE_NULL = 0;
+const uint32_t LINKTYPE_ETHERNET = 1;
+const uint32_t LINKTYPE_RAW = 101;
+const uint32_t LINKTYPE_LOOP = 108;
+const uint32_t LINKTYPE_LINUX_SLL = 113;
+const uint32_t LINKTYPE_IPV4 = 228;
+const uint32_t LINKTYPE_IPV6 = 229;
+const uint32_t LINKTYPE_LINUX_SLL2 = 276;
+
+// Ethernet types
+const uint16_t ETHERTYPE_IPV4 = 0x0800;
+const uint16_t ETHERTYPE_IPV6 = 0x86DD;
+const uint16_t ETHERTYPE_VLAN = 0x8100;
+const uint16_t ETHERTYPE_QINQ = 0x88A8;
+
+// IP protocols
+const uint8_t IPPROTO_UDP_NUMBER = 17;
+
+// MoldUDP64 header size
+const size_t MOLDUDP64_HEADER_SIZE = 20;
+
+uint16_t ReadNetwork16(const uint8_t* data)
+{
+    uint16_t value;
+    CppCommon::Endian::ReadBigEndian(data, value);
+    return value;
+}
+
+uint64_t ToNanoseconds(uint64_t ticks, uint64_t resolution)
+{
+    return (ticks / resolution) * 1000000000 + (ticks % resolution) * 1000000000 / resolution;
+}
+
+} // namespace
+
+bool MoldUDP64Handler::Process(void* buffer, size_t size)
+{
+    size_t index = 0;
+    uint8_t* data = (uint8_t*)buffer;
+
+    // Complete the record collected in the cache
+    while (!_cache.empty())
+    {
+        size_t required = RequiredSize(_cache.data(), _cache.size());
+        if (required == 0)
+            return false;
+
+        if (_cache.size() >= required)
+        {
+            // Process the current record directly from the cache
+            if (!ProcessRecord(_cache.data(), required))
+                return false;
+
+            // Clear the cache
+            _cache.clear();
+            break;
+        }
+
+        size_t tail = std::min(required - _cache.size(), size - index);
+        if (tail == 0)
+            return true;
+        _cache.insert(_cache.end(), &data[index], &data[index + tail]);
+        index += tail;
+    }
+
+    // Process records directly from the input buffer
+    while (index < size)
+    {
+        size_t remaining = size - index;
+
+        size_t required = RequiredSize(&data[index], remaining);
+        if (required == 0)
+            return false;
+
+        // Place the incomplete record into the cache
+        if (required > remaining)
+        {
+            _cache.reserve(required);
+            _cache.insert(_cache.end(), &data[index], &data[size]);
+            break;
+        }
+
+        // Process the current record
+        if (!ProcessRecord(&data[index], required))
+            return false;
+        index += required;
+    }
+
+    return true;
+}
+
+size_t MoldUDP64Handler::RequiredSize(const uint8_t* data, size_t size) const
+{
+    switch (_format)
+    {
+        case CaptureFormat::UNKNOWN:
+        {
+            if (size < 4)
+                return 4;
+
+            uint32_t magic;
+            CppCommon::Endian::ReadLittleEndian(data, magic);
+            if ((magic == PCAP_MAGIC_MICRO) || (magic == PCAP_MAGIC_NANO) || (magic == PCAP_MAGIC_MICRO_SWAPPED) || (magic == PCAP_MAGIC_NANO_SWAPPED))
+                return PCAP_HEADER_SIZE;
+            if (magic != PCAPNG_SECTION_HEADER_BLOCK)
+                return 0;
+            if (size < PCAPNG_BLOCK_HEADER_SIZE)
+                return PCAPNG_BLOCK_HEADER_SIZE;
+
+            // Section header block defines its own byte order
+            uint32_t byte_order;
+            uint32_t length;
+            CppCommon::Endian::ReadLittleEndian(data + 8, byte_order);
+            if (byte_order == PCAPNG_BYTE_ORDER_MAGIC)
+                CppCommon::Endian::ReadLittleEndian(data + 4, length);
+            else
+                CppCommon::Endian::ReadBigEndian(data + 4, length);
+            return ((length >= (PCAPNG_BLOCK_HEADER_SIZE + 16)) && (length <= MAX_PCAPNG_BLOCK_SIZE) && ((length % 4) == 0)) ? length : 0;
+        }
+        case CaptureFormat::PCAP:
+        {
+            if (size < PCAP_RECORD_HEADER_SIZE)
+                return PCAP_RECORD_HEADER_SIZE;
+            // Captured length could not exceed the snapshot length of the file
+            uint32_t length = Read32(data + 8);
+            return (length <= _snaplen) ? (PCAP_RECORD_HEADER_SIZE + length) : 0;
+        }
+        case CaptureFormat::PCAPNG:
+        {
+            if (size < PCAPNG_BLOCK_HEADER_SIZE)
+                return PCAPNG_BLOCK_HEADER_SIZE;
+
+            uint32_t type;
+            CppCommon::Endian::ReadLittleEndian(data, type);
+
+            uint32_t length;
+            if (type == PCAPNG_SECTION_HEADER_BLOCK)
+            {
+                // Section header block defines its own byte order
+                uint32_t byte_order;
+                CppCommon::Endian::ReadLittleEndian(data + 8, byte_order);
+                if (byte_order == PCAPNG_BYTE_ORDER_MAGIC)
+                    CppCommon::Endian::ReadLittleEndian(data + 4, length);
+                else
+                    CppCommon::Endian::ReadBigEndian(data + 4, length);
+            }
+            else
+                length = Read32(data + 4);
+            return ((length >= PCAPNG_BLOCK_HEADER_SIZE) && (length <= MAX_PCAPNG_BLOCK_SIZE) && ((length % 4) == 0)) ? length : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+bool MoldUDP64Handler::ProcessRecord(uint8_t* data, size_t size)
+{
+    switch (_format)
+    {
+        case CaptureFormat::UNKNOWN:
+        {
+            uint32_t magic;
+            CppCommon::Endian::ReadLittleEndian(data, magic);
+            if (magic == PCAPNG_SECTION_HEADER_BLOCK)
+            {
+                _format = CaptureFormat::PCAPNG;
+                return ProcessPcapngBlock(data, size);
+            }
+            return ProcessPcapHeader(data, size);
+        }
+        case CaptureFormat::PCAP:
+            return ProcessPcapRecord(data, size);
+        case CaptureFormat::PCAPNG:
+            return ProcessPcapngBlock(data, size);
+        default:
+            return false;
+    }
+}
+
+bool MoldUDP64Handler::ProcessPcapHeader(uint8_t* data, size_t size)
+{
+    assert((size == PCAP_HEADER_SIZE) && "Invalid size of the pcap file header");
+    if (size != PCAP_HEADER_SIZE)
+        return false;
+
+    uint32_t magic;
+    CppCommon::Endian::ReadLittleEndian(data, magic);
+    switch (magic)
+    {
+        case PCAP_MAGIC_MICRO:
+            _big_endian = false;
+            _resolution = 1000000;
+            break;
+        case PCAP_MAGIC_NANO:
+            _big_endian = false;
+            _resolution = 1000000000;
+            break;
+        case PCAP_MAGIC_MICRO_SWAPPED:
+            _big_endian = true;
+            _resolution = 1000000;
+            break;
+        case PCAP_MAGIC_NANO_SWAPPED:
+            _big_endian = true;
+            _resolution = 1000000000;
+            break;
+        default:
+            return false;
+    }
+
+    // Upper bits of the link type field contain FCS information
+    _link_type = Read32(data + 20) & 0x0FFFFFFF;
+    _format = CaptureFormat::PCAP;
+
+    // Zero or absurd snapshot length is replaced with the maximal one
+    uint32_t snaplen = Read32(data + 16);
+    _snaplen = ((snaplen > 0) && (snaplen <= MAX_SNAPLEN)) ? snaplen : MAX_SNAPLEN;
+
+    return true;
+}
+
+bool MoldUDP64Handler::ProcessPcapRecord(uint8_t* data, size_t size)
+{
+    uint64_t seconds = Read32(data);
+    uint64_t fraction = Read32(data + 4);
+    uint64_t timestamp = seconds * 1000000000 + ToNanoseconds(fraction, _resolution);
+
+    return ProcessFrame(data + PCAP_RECORD_HEADER_SIZE, size - PCAP_RECORD_HEADER_SIZE, _link_type, timestamp);
+}
+
+bool MoldUDP64Handler::ProcessPcapngBlock(uint8_t* data, size_t size)
+{
+    uint32_t type;
+    CppCommon::Endian::ReadLittleEndian(data, type);
+
+    if (type == PCAPNG_SECTION_HEADER_BLOCK)
+    {
+        uint32_t byte_order;
+        CppCommon::Endian::ReadLittleEndian(data + 8, byte_order);
+        _big_endian = (byte_order != PCAPNG_BYTE_ORDER_MAGIC);
+
+        // Interface Ids are scoped to the section
+        _interfaces.clear();
+        return true;
+    }
+
+    type = Read32(data);
+
+    // Block body without the trailing block length
+    size_t body = size - 4;
+
+    switch (type)
+    {
+        case PCAPNG_INTERFACE_DESCRIPTION_BLOCK:
+        {
+            if (body < 16)
+                return false;
+
+            CaptureInterface description = { Read16(data + 8), 1000000 };
+
+            // Find the timestamp resolution option
+            size_t offset = 16;
+            while ((offset + 4) <= body)
+            {
+                uint16_t code = Read16(data + offset);
+                uint16_t length = Read16(data + offset + 2);
+                offset += 4;
+                if ((code == 0) || ((offset + length) > body))
+                    break;
+                if ((code == 9) && (length >= 1))
+                {
+                    // Exponents above 2^63 or 10^19 do not fit 64 bits, so keep the default microsecond resolution
+                    uint8_t value = data[offset];
+                    if (value & 0x80)
+                    {
+                        if ((value & 0x7F) < 64)
+                            description.Resolution = (uint64_t)1 << (value & 0x7F);
+                    }
+                    else if (value < 20)
+                    {
+                        uint64_t resolution = 1;
+                        for (uint8_t i = 0; i < value; ++i)
+                            resolution *= 10;
+                        description.Resolution = resolution;
+                    }
+                }
+                offset += (length + 3) & ~3;
+            }
+
+            _interfaces.push_back(description);
+            return true;
+        }
+        case PCAPNG_ENHANCED_PACKET_BLOCK:
+        case PCAPNG_PACKET_BLOCK:
+        {
+            if (body < 28)
+                return false;
+
+            uint32_t interface_id = (type == PCAPNG_ENHANCED_PACKET_BLOCK) ? Read32(data + 8) : Read16(data + 8);
+            uint64_t ticks = ((uint64_t)Read32(data + 12) << 32) | Read32(data + 16);
+            uint32_t captured = Read32(data + 20);
+            if ((28 + (size_t)captured) > body)
+                return false;
+            if (interface_id >= _interfaces.size())
+                return false;
+
+            const CaptureInterface& description = _interfaces[interface_id];
+            return ProcessFrame(data + 28, captured, description.LinkType, ToNanoseconds(ticks, description.Resolution));
+        }
+        case PCAPNG_SIMPLE_PACKET_BLOCK:
+        {
+            if ((body < 12) || _interfaces.empty())
+                return false;
+
+            size_t captured = std::min((size_t)Read32(data + 8), body - 12);
+            return ProcessFrame(data + 12, captured, _interfaces.front().LinkType);
+        }
+        default:
+            // Skip all other blocks
+            return true;
+    }
+}
+
+bool MoldUDP64Handler::ProcessFrame(void* buffer, size_t size, uint32_t link_type, uint64_t timestamp)
+{
+    uint8_t* data = (uint8_t*)buffer;
+
+    _packet.Timestamp = timestamp;
+    _packet.LinkType = link_type;
+
+    switch (link_type)
+    {
+        case LINKTYPE_ETHERNET:
+        {
+            if (size < 14)
+                break;
+
+            size_t offset = 14;
+            uint16_t ether_type = ReadNetwork16(data + 12);
+
+            // Skip VLAN tags
+            while ((ether_type == ETHERTYPE_VLAN) || (ether_type == ETHERTYPE_QINQ))
+            {
+                if (size < (offset + 4))
+                    break;
+                ether_type = ReadNetwork16(data + offset + 2);
+                offset += 4;
+            }
+
+            if ((ether_type != ETHERTYPE_IPV4) && (ether_type != ETHERTYPE_IPV6))
+                break;
+
+            return ProcessIP(data + offset, size - offset);
+        }
+        case LINKTYPE_LINUX_SLL:
+            if (size < 16)
+                break;
+            return ProcessIP(data + 16, size - 16);
+        case LINKTYPE_LINUX_SLL2:
+            if (size < 20)
+                break;
+            return ProcessIP(data + 20, size - 20);
+        case LINKTYPE_NULL:
+        case LINKTYPE_LOOP:
+            if (size < 4)
+                break;
+            return ProcessIP(data + 4, size - 4);
+        case LINKTYPE_RAW:
+        case LINKTYPE_IPV4:
+        case LINKTYPE_IPV6:
+            return ProcessIP(data, size);
+        default:
+            break;
+    }
+
+    // Skip unsupported frames
+    ++_skipped;
+    return true;
+}
+
+bool MoldUDP64Handler::ProcessIP(uint8_t* data, size_t size)
+{
+    if (size >= 20)
+    {
+        uint8_t version = data[0] >> 4;
+        if (version == 4)
+        {
+            size_t header = (data[0] & 0x0F) * 4;
+            size_t total = ReadNetwork16(data + 2);
+
+            // Skip fragmented datagrams
+            uint16_t fragment = ReadNetwork16(data + 6) & 0x3FFF;
+
+            // Total length excludes Ethernet padding
+            if ((header >= 20) && (total >= header) && (total <= size) && (fragment == 0) && (data[9] == IPPROTO_UDP_NUMBER))
+                return ProcessUDP(data + header, total - header);
+        }
+        else if ((version == 6) && (size >= 40))
+        {
+            size_t payload = ReadNetwork16(data + 4);
+            if (((40 + payload) <= size) && (data[6] == IPPROTO_UDP_NUMBER))
+                return ProcessUDP(data + 40, payload);
+        }
+    }
+
+    // Skip unsupported packets
+    ++_skipped;
+    return true;
+}
+
+bool MoldUDP64Handler::ProcessUDP(uint8_t* data, size_t size)
+{
+    if (size >= 8)
+    {
+        uint16_t port = ReadNetwork16(data + 2);
+        size_t length = ReadNetwork16(data + 4);
+        if ((length >= 8) && (length <= size) && ((_port == 0) || (_port == port)))
+        {
+            _packet.Port = port;
+
+            // Call the corresponding handler
+            if (!onCapturePacket(_packet))
+                return false;
+
+            return ProcessPacket(data + 8, length - 8);
+        }
+    }
+
+    // Skip unsupported datagrams
+    ++_skipped;
+    return true;
+}
+
+bool MoldUDP64Handler::ProcessPacket(void* buffer, size_t size)
+{
+    // Foreign datagrams too short for the MoldUDP64 header are skipped
+    if (size < MOLDUDP64_HEADER_SIZE)
+    {
+        ++_skipped;
+        return true;
+    }
+
+    uint8_t* data = (uint8_t*)buffer;
+
+    MoldUDP64Header header;
+    std::memcpy(header.Session, data, sizeof(header.Session));
+    CppCommon::Endian::ReadBigEndian(data + 10, header.SequenceNumber);
+    CppCommon::Endian::ReadBigEndian(data + 18, header.MessageCount);
+
+    ++_packets;
+
+    Session& session = FindSession(header.Session);
+    uint64_t count = header.IsEndOfSession() ? 0 : header.MessageCount;
+
+    // The first packet of the session defines the expected sequence number
+    if (session.NextSequence == 0)
+        session.NextSequence = header.SequenceNumber;
+
+    // Report the sequence gap
+    if (header.SequenceNumber > session.NextSequence)
+    {
+        ++_gaps;
+        _lost += header.SequenceNumber - session.NextSequence;
+
+        // Call the corresponding handler
+        if (!onGap(header, session.NextSequence))
+            return false;
+
+        session.NextSequence = header.SequenceNumber;
+    }
+
+    // Calculate the count of already processed messages
+    uint64_t duplicates = std::min(count, session.NextSequence - header.SequenceNumber);
+    _duplicates += duplicates;
+
+    // Process message blocks
+    size_t offset = MOLDUDP64_HEADER_SIZE;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if ((offset + 2) > size)
+            return false;
+        size_t length = ReadNetwork16(data + offset);
+        offset += 2;
+        if ((offset + length) > size)
+            return false;
+
+        if (i >= duplicates)
+        {
+            if (!_itch_handler.ProcessMessage(data + offset, length))
+                return false;
+            ++_messages;
+        }
+
+        offset += length;
+    }
+
+    session.NextSequence = std::max(session.NextSequence, header.SequenceNumber + count);
+
+    // Call the corresponding handler
+    if (header.IsHeartbeat())
+        return onHeartbeat(header);
+    if (header.IsEndOfSession())
+        return onEndOfSession(header);
+
+    return true;
+}
+
+MoldUDP64Handler::Session& MoldUDP64Handler::FindSession(const char (&name)[10])
+{
+    // Check the last used session
+    if ((_session < _sessions.size()) && (std::memcmp(_sessions[_session].Name, name, sizeof(name)) == 0))
+        return _sessions[_session];
+
+    for (_session = 0; _session < _sessions.size(); ++_session)
+        if (std::memcmp(_sessions[_session].Name, name, sizeof(name)) == 0)
+            return _sessions[_session];
+
+    // Create a new session
+    Session session;
+    std::memcpy(session.Name, name, sizeof(name));
+    session.NextSequence = 0;
+    _sessions.push_back(session);
+    return _sessions.back();
+}
+
+void MoldUDP64Handler::Reset()
+{
+    _format = CaptureFormat::UNKNOWN;
+    _big_endian = false;
+    _resolution = 1000000;
+    _link_type = LINKTYPE_ETHERNET;
+    _snaplen = MAX_SNAPLEN;
+    _interfaces.clear();
+    _cache.clear();
+    _packet = CapturePacket{ 0, 0, 0 };
+    _sessions.clear();
+    _session = 0;
+    _packets = 0;
+    _messages = 0;
+    _gaps = 0;
+    _lost = 0;
+    _duplicates = 0;
+    _skipped = 0;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
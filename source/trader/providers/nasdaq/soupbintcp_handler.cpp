@@ -0,0 +1,182 @@
+/*!
+    \file soupbintcp_handler.cpp
+    \brief NASDAQ SoupBinTCP handler implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/soupbintcp_handler.h"
+
+#include <cassert>
+
+namespace CppTrader {
+namespace ITCH {
+
+bool SoupBinTCPHandler::Process(void* buffer, size_t size)
+{
+    size_t index = 0;
+    uint8_t* data = (uint8_t*)buffer;
+
+    while (index < size)
+    {
+        if (_size == 0)
+        {
+            size_t remaining = size - index;
+
+            // Collect packet size into the cache
+            if (((_cache.size() == 0) && (remaining < 3)) || (_cache.size() == 1))
+            {
+                _cache.push_back(data[index++]);
+                continue;
+            }
+
+            // Read a new packet size
+            uint16_t packet_size;
+            if (_cache.empty())
+            {
+                // Read the packet size directly from the input buffer
+                index += CppCommon::Endian::ReadBigEndian(&data[index], packet_size);
+            }
+            else
+            {
+                // Read the packet size from the cache
+                CppCommon::Endian::ReadBigEndian(_cache.data(), packet_size);
+
+                // Clear the cache
+                _cache.clear();
+            }
+            _size = packet_size;
+
+            // Empty packets are not allowed
+            if (_size == 0)
+                return false;
+        }
+
+        // Read a new packet
+        if (_size > 0)
+        {
+            size_t remaining = size - index;
+
+            // Complete or place the packet into the cache
+            if (!_cache.empty())
+            {
+                size_t tail = _size - _cache.size();
+                if (tail > remaining)
+                    tail = remaining;
+                _cache.insert(_cache.end(), &data[index], &data[index + tail]);
+                index += tail;
+                if (_cache.size() < _size)
+                    continue;
+            }
+            else if (_size > remaining)
+            {
+                _cache.reserve(_size);
+                _cache.insert(_cache.end(), &data[index], &data[index + remaining]);
+                index += remaining;
+                continue;
+            }
+
+            // Process the current packet
+            if (_cache.empty())
+            {
+                // Process the current packet directly from the input buffer
+                if (!ProcessPacket(&data[index], _size))
+                    return false;
+                index += _size;
+            }
+            else
+            {
+                // Process the current packet directly from the cache
+                if (!ProcessPacket(_cache.data(), _size))
+                    return false;
+
+                // Clear the cache
+                _cache.clear();
+            }
+
+            // Process the next packet
+            _size = 0;
+        }
+    }
+
+    return true;
+}
+
+bool SoupBinTCPHandler::ProcessPacket(void* buffer, size_t size)
+{
+    // Packet is empty
+    if (size == 0)
+        return false;
+
+    uint8_t* data = (uint8_t*)buffer;
+
+    switch (*data)
+    {
+        case 'S':
+        {
+            // Sequenced data packet contains exactly one ITCH message
+            if (!_itch_handler.ProcessMessage(data + 1, size - 1))
+                return false;
+            ++_sequence;
+            ++_messages;
+            return true;
+        }
+        case 'A':
+            return ProcessLoginAccepted(data, size);
+        case 'J':
+            return onLoginRejected((size > 1) ? (char)data[1] : ' ');
+        case 'H':
+            return onHeartbeat();
+        case 'Z':
+            return onEndOfSession();
+        default:
+            // Skip debug and client packets
+            return true;
+    }
+}
+
+bool SoupBinTCPHandler::ProcessLoginAccepted(uint8_t* data, size_t size)
+{
+    assert((size == 31) && "Invalid size of the SoupBinTCP packet type 'A'");
+    if (size != 31)
+        return false;
+
+    SoupBinTCPLoginAccepted packet;
+    std::memcpy(packet.Session, data + 1, sizeof(packet.Session));
+
+    // Sequence number is a left space padded ASCII number
+    packet.SequenceNumber = 0;
+    for (size_t i = 11; i < 31; ++i)
+        if ((data[i] >= '0') && (data[i] <= '9'))
+            packet.SequenceNumber = packet.SequenceNumber * 10 + (data[i] - '0');
+
+    // Report the sequence gap on re-login into the same session
+    if ((_sequence > 0) && (std::memcmp(_session, packet.Session, sizeof(_session)) == 0) && (packet.SequenceNumber > _sequence))
+    {
+        ++_gaps;
+
+        // Call the corresponding handler
+        if (!onGap(packet, _sequence))
+            return false;
+    }
+
+    std::memcpy(_session, packet.Session, sizeof(_session));
+    _sequence = packet.SequenceNumber;
+
+    // Call the corresponding handler
+    return onLoginAccepted(packet);
+}
+
+void SoupBinTCPHandler::Reset()
+{
+    _size = 0;
+    _cache.clear();
+    std::memset(_session, ' ', sizeof(_session));
+    _sequence = 0;
+    _messages = 0;
+    _gaps = 0;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -5,12 +5,21 @@
 #include <regex>
 #include <string>
 #include <chrono>
+#include <algorithm>
+#include <iterator>
 #include <sw/redis++/redis++.h>
 
 using namespace sw::redis;
 
 using namespace std;
 
+namespace {
+
+// Asynchronous client of the current I/O thread (used to detect calls from completion callbacks)
+thread_local const MyRedisAsync* io_thread_client = nullptr;
+
+} // namespace
+
 
 string MyRedis::_get_db(const string& key)
     {
@@ -125,29 +134,362 @@ bool MyRedis::_hmset_db(const string& key, const std::unordered_map<std::string,
 std::unordered_map<std::string, std::string> MyRedis::_hgetall_db(const string& key)
     {
         try {
-            vector<std::string> val;
-            this->redis.hgetall(key, std::inserter(val, val.begin()));
-
             std::unordered_map<std::string, std::string> val_ret = {};
-            string key_ret;
-            string value;
-            int i = 0;
-            for (std::vector<string>::iterator it = val.begin(); it != val.end(); ++it)
-            {
-                if (i % 2 == 0)
-                {
-                    key_ret = *it;
-                    continue;
-                }
-                value = *it;
-                val_ret[key_ret] = value;    
-                i++;
-            }
+            this->redis.hgetall(key, std::inserter(val_ret, val_ret.begin()));
+            return val_ret;
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+            return {};
+        }
+    }
 
+std::vector<std::unordered_map<std::string, std::string>> MyRedis::_hgetall_db(const std::vector<string>& keys)
+    {
+        MyRedisPipeline pipeline = this->_pipeline_db();
+        for (const auto& key : keys)
+            pipeline._hgetall_db(key);
+
+        std::vector<std::unordered_map<std::string, std::string>> val_ret(keys.size());
+        if (!pipeline._exec())
             return val_ret;
+
+        MyRedisReplies replies = pipeline._replies();
+        for (size_t i = 0; i < replies.size(); ++i)
+            val_ret[i] = replies._hash(i);
+        return val_ret;
+    }
+
+std::vector<string> MyRedis::_scan_db(const string& pattern)
+    {
+        try {
+            std::vector<string> keys;
+            long long cursor = 0;
+            do {
+                cursor = this->redis.scan(cursor, pattern, 1000, std::back_inserter(keys));
+            } while (cursor != 0);
+
+            // SCAN may return the same key more than once
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            return keys;
         }catch (const Error &e) {
             cout << e.what() << endl;
             return {};
         }
     }
 
+std::optional<Subscriber> MyRedis::_subscriber_db(std::chrono::milliseconds timeout)
+    {
+        try {
+            size_t separator = _redis_host.rfind(':');
+            ConnectionOptions options;
+            options.host = _redis_host.substr(0, separator);
+            options.port = std::stoi(_redis_host.substr(separator + 1));
+            options.socket_timeout = timeout;
+            return Redis(options).subscriber();
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+            return std::nullopt;
+        }
+    }
+
+bool MyRedisReplies::_ok(size_t index)
+    {
+        try {
+            return (_replies != nullptr) && (index < _count) && (_replies->get(_offset + index).type != REDIS_REPLY_ERROR);
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+            return false;
+        }
+    }
+
+OptionalString MyRedisReplies::_string(size_t index)
+    {
+        try {
+            if ((_replies != nullptr) && (index < _count))
+                return _replies->get<OptionalString>(_offset + index);
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+        }
+        return {};
+    }
+
+long long MyRedisReplies::_integer(size_t index)
+    {
+        try {
+            if ((_replies != nullptr) && (index < _count))
+                return _replies->get<long long>(_offset + index);
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+        }
+        return 0;
+    }
+
+std::vector<string> MyRedisReplies::_list(size_t index)
+    {
+        try {
+            if ((_replies != nullptr) && (index < _count))
+                return _replies->get<std::vector<string>>(_offset + index);
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+        }
+        return {};
+    }
+
+std::unordered_map<std::string, std::string> MyRedisReplies::_hash(size_t index)
+    {
+        try {
+            if ((_replies != nullptr) && (index < _count))
+                return _replies->get<std::unordered_map<std::string, std::string>>(_offset + index);
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+        }
+        return {};
+    }
+
+template <>
+Pipeline MyRedisQueue<Pipeline>::Create(Redis& redis, bool new_connection)
+    {
+        return redis.pipeline(new_connection);
+    }
+
+template <>
+Transaction MyRedisQueue<Transaction>::Create(Redis& redis, bool new_connection)
+    {
+        // Piped transaction sends MULTI, commands and EXEC in a single write
+        return redis.transaction(true, new_connection);
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>::MyRedisQueue(Redis& redis, bool new_connection)
+    : _redis(&redis), _new_connection(new_connection)
+    {
+        Reconnect();
+    }
+
+template <class TQueued>
+void MyRedisQueue<TQueued>::Reconnect()
+    {
+        // Release the borrowed connection first, so it may be taken again
+        _queue.reset();
+        try {
+            _queue.emplace(Create(*_redis, _new_connection));
+            _failed = false;
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+            _failed = true;
+        }
+    }
+
+template <class TQueued>
+template <class TCommand>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::Queue(TCommand&& command)
+    {
+        try {
+            if (_queue)
+                command(*_queue);
+            else
+                _failed = true;
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+            _failed = true;
+        }
+        ++_queued;
+        return *this;
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_get_db(const string& key)
+    {
+        return Queue([&](TQueued& queue) { queue.get(key); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_del_db(const string& key)
+    {
+        return Queue([&](TQueued& queue) { queue.del(key); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_lrange_db(const string& key)
+    {
+        return Queue([&](TQueued& queue) { queue.lrange(key, 0, -1); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_set_db(const string& key, const string& val)
+    {
+        return Queue([&](TQueued& queue) { queue.set(key, val); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_append_db(const string& key, const vector<std::string>& val)
+    {
+        return Queue([&](TQueued& queue) { queue.rpush(key, val.begin(), val.end()); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_append_db(const string& key, const vector<uint64_t>& val)
+    {
+        // Redis++ takes only string arguments
+        return Queue([&](TQueued& queue)
+        {
+            std::vector<string> values;
+            values.reserve(val.size());
+            for (uint64_t value : val)
+                values.push_back(std::to_string(value));
+            queue.rpush(key, values.begin(), values.end());
+        });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_hmset_db(const string& key, const std::unordered_map<std::string, std::string>& val)
+    {
+        return Queue([&](TQueued& queue) { queue.hmset(key, val.begin(), val.end()); });
+    }
+
+template <class TQueued>
+MyRedisQueue<TQueued>& MyRedisQueue<TQueued>::_hgetall_db(const string& key)
+    {
+        return Queue([&](TQueued& queue) { queue.hgetall(key); });
+    }
+
+template <class TQueued>
+bool MyRedisQueue<TQueued>::_exec()
+    {
+        _result.reset();
+        size_t queued = _queued;
+        _queued = 0;
+
+        try {
+            if (!_failed && (queued > 0))
+                _result.emplace(_queue->exec());
+            if (!_failed)
+                return true;
+        }catch (const Error &e) {
+            cout << e.what() << endl;
+        }
+
+        // Queue is not usable after the failure, so reconnect for the next batch
+        Reconnect();
+        return false;
+    }
+
+template <class TQueued>
+MyRedisReplies MyRedisQueue<TQueued>::_replies(size_t offset, size_t count)
+    {
+        if (!_result || (offset + count > _result->size()))
+            return MyRedisReplies();
+        return MyRedisReplies(&*_result, offset, count);
+    }
+
+template class MyRedisQueue<Pipeline>;
+template class MyRedisQueue<Transaction>;
+
+MyRedisAsync::MyRedisAsync(MyRedis& redis)
+    : _pipeline(redis._pipeline_db(true))
+    {
+    }
+
+bool MyRedisAsync::Start()
+    {
+        std::scoped_lock locker(_mutex);
+        if (_started)
+            return false;
+
+        _stop = false;
+        _thread = std::thread([this]() { Run(); });
+        _started = true;
+        return true;
+    }
+
+bool MyRedisAsync::Stop()
+    {
+        // I/O thread cannot join itself
+        if (io_thread_client == this)
+            return false;
+
+        {
+            std::scoped_lock locker(_mutex);
+            if (!_started || _stop)
+                return false;
+            _stop = true;
+        }
+        _cv_submitted.notify_one();
+        _thread.join();
+
+        std::scoped_lock locker(_mutex);
+        _started = false;
+        return true;
+    }
+
+bool MyRedisAsync::Submit(Batch batch, Callback callback)
+    {
+        {
+            std::scoped_lock locker(_mutex);
+            if (!_started || _stop)
+                return false;
+            _requests.push_back(Request{ std::move(batch), std::move(callback) });
+            ++_submitted;
+        }
+        _cv_submitted.notify_one();
+        return true;
+    }
+
+void MyRedisAsync::Flush()
+    {
+        // Completion callback cannot wait for the I/O thread it is called from
+        if (io_thread_client == this)
+            return;
+
+        std::unique_lock<std::mutex> locker(_mutex);
+        uint64_t submitted = _submitted;
+        _cv_completed.wait(locker, [this, submitted]() { return _completed >= submitted; });
+    }
+
+void MyRedisAsync::Run()
+    {
+        std::vector<Request> requests;
+        std::vector<size_t> offsets;
+
+        io_thread_client = this;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> locker(_mutex);
+                _cv_submitted.wait(locker, [this]() { return _stop || !_requests.empty(); });
+                // Stop only after all submitted batches are shipped
+                if (_requests.empty())
+                    break;
+                std::swap(requests, _requests);
+            }
+
+            // Queue all batches into the single pipeline flush
+            offsets.clear();
+            for (auto& request : requests)
+            {
+                offsets.push_back(_pipeline.size());
+                if (request.Commands)
+                    request.Commands(_pipeline);
+            }
+            offsets.push_back(_pipeline.size());
+
+            // Callbacks are called without the lock, so they may submit new batches
+            bool result = _pipeline._exec();
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                if (!requests[i].Completion)
+                    continue;
+                MyRedisReplies replies = result ? _pipeline._replies(offsets[i], offsets[i + 1] - offsets[i]) : MyRedisReplies();
+                requests[i].Completion(result, replies);
+            }
+
+            {
+                std::scoped_lock locker(_mutex);
+                _completed += requests.size();
+            }
+            _cv_completed.notify_all();
+            requests.clear();
+        }
+        io_thread_client = nullptr;
+    }
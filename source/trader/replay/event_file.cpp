@@ -0,0 +1,162 @@
+/*!
+    \file event_file.cpp
+    \brief Normalized market events file implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/replay/event_file.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CppTrader {
+namespace Replay {
+
+void EventWriter::Open(const CppCommon::Path& path)
+{
+    Close();
+
+    _file = path;
+    _file.OpenOrCreate(false, true, true);
+
+    EventFileHeader header = EventFileHeader::Create();
+    _file.Write(&header, sizeof(header));
+
+    _events = 0;
+}
+
+void EventWriter::Close()
+{
+    if (!IsOpened())
+        return;
+
+    Flush();
+    _file.Close();
+}
+
+void EventWriter::Flush()
+{
+    if (_buffer.empty())
+        return;
+
+    _file.Write(_buffer.data(), _buffer.size() * sizeof(Event));
+    _events += _buffer.size();
+    _buffer.clear();
+}
+
+EventFile::EventFile()
+    : _data(nullptr),
+      _length(0),
+      _events(nullptr),
+      _size(0),
+#if defined(_WIN32) || defined(_WIN64)
+      _file(INVALID_HANDLE_VALUE),
+      _mapping(nullptr)
+#else
+      _file(-1)
+#endif
+{
+}
+
+bool EventFile::Open(const CppCommon::Path& path)
+{
+    Close();
+
+#if defined(_WIN32) || defined(_WIN64)
+    _file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (_file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(_file, &length) || (length.QuadPart < (LONGLONG)sizeof(EventFileHeader)))
+    {
+        Close();
+        return false;
+    }
+    _length = (size_t)length.QuadPart;
+
+    _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    _data = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (_data == nullptr)
+    {
+        Close();
+        return false;
+    }
+#else
+    _file = open(path.string().c_str(), O_RDONLY);
+    if (_file < 0)
+        return false;
+
+    struct stat status;
+    if ((fstat(_file, &status) != 0) || (status.st_size < (off_t)sizeof(EventFileHeader)))
+    {
+        Close();
+        return false;
+    }
+    _length = (size_t)status.st_size;
+
+    void* data = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, _file, 0);
+    if (data == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+    _data = data;
+
+    // Events are read strictly sequentially during replay
+    madvise(_data, _length, MADV_SEQUENTIAL);
+#endif
+
+    const EventFileHeader* header = (const EventFileHeader*)_data;
+    if (!header->IsValid())
+    {
+        Close();
+        return false;
+    }
+
+    _events = (const Event*)((const uint8_t*)_data + sizeof(EventFileHeader));
+    _size = (_length - sizeof(EventFileHeader)) / sizeof(Event);
+
+    return true;
+}
+
+void EventFile::Close()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (_data != nullptr)
+        UnmapViewOfFile(_data);
+    if (_mapping != nullptr)
+        CloseHandle(_mapping);
+    if (_file != INVALID_HANDLE_VALUE)
+        CloseHandle(_file);
+    _mapping = nullptr;
+    _file = INVALID_HANDLE_VALUE;
+#else
+    if (_data != nullptr)
+        munmap(_data, _length);
+    if (_file >= 0)
+        close(_file);
+    _file = -1;
+#endif
+    _data = nullptr;
+    _length = 0;
+    _events = nullptr;
+    _size = 0;
+}
+
+} // namespace Replay
+} // namespace CppTrader
@@ -0,0 +1,103 @@
+/*!
+    \file itch_converter.cpp
+    \brief NASDAQ ITCH to normalized market events converter implementation
+    \author Chris Urbanowicz
+    \date 18.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/replay/itch_converter.h"
+
+namespace CppTrader {
+namespace Replay {
+
+using namespace ITCH;
+using namespace Matching;
+
+ITCHConverter::ITCHConverter()
+    : _messages(0),
+      _events(0),
+      _errors(0)
+{
+}
+
+bool ITCHConverter::Emit(EventType type, uint32_t symbol, uint64_t timestamp, uint64_t order_id, uint32_t price, uint32_t quantity, OrderSide side, uint64_t new_order_id)
+{
+    Event event;
+    event.Timestamp = timestamp;
+    event.OrderId = order_id;
+    event.NewOrderId = new_order_id;
+    event.Symbol = symbol;
+    event.Price = price;
+    event.Quantity = quantity;
+    event.Type = type;
+    event.Side = side;
+    event.Reserved = 0;
+
+    ++_events;
+    return onEvent(event);
+}
+
+bool ITCHConverter::onMessage(const StockDirectoryMessage& message)
+{
+    ++_messages;
+
+    Event event;
+    event.Timestamp = message.Timestamp;
+    event.OrderId = 0;
+    std::memcpy(event.Name, message.Stock, sizeof(event.Name));
+    event.Symbol = message.StockLocate;
+    event.Price = 0;
+    event.Quantity = 0;
+    event.Type = EventType::SYMBOL;
+    event.Side = OrderSide::BUY;
+    event.Reserved = 0;
+
+    ++_events;
+    return onEvent(event);
+}
+
+bool ITCHConverter::onMessage(const AddOrderMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::ADD, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, message.Price, message.Shares, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL);
+}
+
+bool ITCHConverter::onMessage(const AddOrderMPIDMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::ADD, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, message.Price, message.Shares, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL);
+}
+
+bool ITCHConverter::onMessage(const OrderExecutedMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::EXECUTE, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, 0, message.ExecutedShares);
+}
+
+bool ITCHConverter::onMessage(const OrderExecutedWithPriceMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::EXECUTE_PRICE, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, message.ExecutionPrice, message.ExecutedShares);
+}
+
+bool ITCHConverter::onMessage(const OrderCancelMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::CANCEL, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, 0, message.CanceledShares);
+}
+
+bool ITCHConverter::onMessage(const OrderDeleteMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::DELETE, message.StockLocate, message.Timestamp, message.OrderReferenceNumber, 0, 0);
+}
+
+bool ITCHConverter::onMessage(const OrderReplaceMessage& message)
+{
+    ++_messages;
+    return Emit(EventType::REPLACE, message.StockLocate, message.Timestamp, message.OriginalOrderReferenceNumber, message.Price, message.Shares, OrderSide::BUY, message.NewOrderReferenceNumber);
+}
+
+} // namespace Replay
+} // namespace CppTrader
@@ -0,0 +1,383 @@
+/*!
+    \file benchmark_report.cpp
+    \brief Benchmark report implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/statistics/benchmark_report.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace CppTrader {
+namespace Statistics {
+
+namespace {
+
+//! Minimal JSON reader of benchmark reports
+class JSONReader
+{
+public:
+    explicit JSONReader(const std::string& json) : _json(json), _position(0) {}
+
+    bool End() { SkipSpaces(); return _position >= _json.size(); }
+
+    bool Expect(char c)
+    {
+        SkipSpaces();
+        if ((_position < _json.size()) && (_json[_position] == c))
+        {
+            ++_position;
+            return true;
+        }
+        return false;
+    }
+
+    bool Peek(char c)
+    {
+        SkipSpaces();
+        return (_position < _json.size()) && (_json[_position] == c);
+    }
+
+    bool ReadString(std::string& value)
+    {
+        if (!Expect('"'))
+            return false;
+        value.clear();
+        while (_position < _json.size())
+        {
+            char c = _json[_position++];
+            if (c == '"')
+                return true;
+            if (c == '\\')
+            {
+                if (_position >= _json.size())
+                    return false;
+                c = _json[_position++];
+                switch (c)
+                {
+                    case 'n': c = '\n'; break;
+                    case 'r': c = '\r'; break;
+                    case 't': c = '\t'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u':
+                        // Unicode escapes are not used in reports, keep them as is
+                        value += "\\u";
+                        continue;
+                    default: break;
+                }
+            }
+            value += c;
+        }
+        return false;
+    }
+
+    bool ReadNumber(double& value)
+    {
+        SkipSpaces();
+        if (_json.compare(_position, 4, "null") == 0)
+        {
+            _position += 4;
+            value = std::numeric_limits<double>::quiet_NaN();
+            return true;
+        }
+        const char* begin = _json.c_str() + _position;
+        char* end = nullptr;
+        value = std::strtod(begin, &end);
+        if (end == begin)
+            return false;
+        _position += (size_t)(end - begin);
+        return true;
+    }
+
+    bool SkipValue()
+    {
+        SkipSpaces();
+        if (_position >= _json.size())
+            return false;
+
+        char c = _json[_position];
+        if (c == '"')
+        {
+            std::string value;
+            return ReadString(value);
+        }
+        if ((c == '{') || (c == '['))
+        {
+            char close = (c == '{') ? '}' : ']';
+            ++_position;
+            if (Expect(close))
+                return true;
+            do
+            {
+                if (c == '{')
+                {
+                    std::string key;
+                    if (!ReadString(key) || !Expect(':'))
+                        return false;
+                }
+                if (!SkipValue())
+                    return false;
+            } while (Expect(','));
+            return Expect(close);
+        }
+        if (_json.compare(_position, 4, "true") == 0)
+        {
+            _position += 4;
+            return true;
+        }
+        if (_json.compare(_position, 5, "false") == 0)
+        {
+            _position += 5;
+            return true;
+        }
+        double value;
+        return ReadNumber(value);
+    }
+
+private:
+    const std::string& _json;
+    size_t _position;
+
+    void SkipSpaces()
+    {
+        while ((_position < _json.size()) && std::isspace((unsigned char)_json[_position]))
+            ++_position;
+    }
+};
+
+bool ReadMetric(JSONReader& reader, BenchmarkMetric& metric)
+{
+    metric = BenchmarkMetric{ "", 0.0, "", MetricDirection::LOWER_IS_BETTER, -1.0 };
+
+    if (!reader.Expect('{'))
+        return false;
+    if (reader.Expect('}'))
+        return false;
+
+    bool value = false;
+    do
+    {
+        std::string key;
+        if (!reader.ReadString(key) || !reader.Expect(':'))
+            return false;
+
+        if (key == "name")
+        {
+            if (!reader.ReadString(metric.Name))
+                return false;
+        }
+        else if (key == "value")
+        {
+            if (!reader.ReadNumber(metric.Value))
+                return false;
+            value = true;
+        }
+        else if (key == "unit")
+        {
+            if (!reader.ReadString(metric.Unit))
+                return false;
+        }
+        else if (key == "better")
+        {
+            std::string direction;
+            if (!reader.ReadString(direction))
+                return false;
+            if (direction == "higher")
+                metric.Direction = MetricDirection::HIGHER_IS_BETTER;
+            else if (direction == "lower")
+                metric.Direction = MetricDirection::LOWER_IS_BETTER;
+            else
+                return false;
+        }
+        else if (key == "tolerance")
+        {
+            if (!reader.ReadNumber(metric.Tolerance))
+                return false;
+        }
+        else if (!reader.SkipValue())
+            return false;
+    } while (reader.Expect(','));
+
+    return reader.Expect('}') && !metric.Name.empty() && value;
+}
+
+} // namespace
+
+const BenchmarkMetric* BenchmarkReport::Find(const std::string& name) const noexcept
+{
+    for (const auto& metric : _metrics)
+        if (metric.Name == name)
+            return &metric;
+    return nullptr;
+}
+
+void BenchmarkReport::Add(const std::string& name, double value, const std::string& unit, MetricDirection direction, double tolerance)
+{
+    for (auto& metric : _metrics)
+    {
+        if (metric.Name == name)
+        {
+            metric = BenchmarkMetric{ name, value, unit, direction, tolerance };
+            return;
+        }
+    }
+    _metrics.push_back(BenchmarkMetric{ name, value, unit, direction, tolerance });
+}
+
+std::vector<BenchmarkVerdict> BenchmarkReport::Compare(const BenchmarkReport& baseline, double tolerance) const
+{
+    std::vector<BenchmarkVerdict> verdicts;
+    verdicts.reserve(baseline._metrics.size());
+
+    for (const auto& expected : baseline._metrics)
+    {
+        BenchmarkVerdict verdict;
+        verdict.Name = expected.Name;
+        verdict.Baseline = expected.Value;
+        verdict.Current = 0.0;
+        verdict.Change = 0.0;
+        verdict.Tolerance = (expected.Tolerance >= 0.0) ? expected.Tolerance : tolerance;
+        verdict.Missing = false;
+        verdict.Passed = false;
+
+        const BenchmarkMetric* actual = Find(expected.Name);
+        if (actual == nullptr)
+        {
+            verdict.Missing = true;
+            verdicts.push_back(verdict);
+            continue;
+        }
+
+        verdict.Current = actual->Value;
+        if (verdict.Current == verdict.Baseline)
+            verdict.Change = 0.0;
+        else if (verdict.Baseline != 0.0)
+            verdict.Change = (verdict.Current - verdict.Baseline) / std::fabs(verdict.Baseline);
+        else
+            verdict.Change = (verdict.Current > 0.0) ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+
+        // NaN changes are never passed
+        if (expected.Direction == MetricDirection::HIGHER_IS_BETTER)
+            verdict.Passed = (verdict.Change >= -verdict.Tolerance);
+        else
+            verdict.Passed = (verdict.Change <= verdict.Tolerance);
+
+        verdicts.push_back(verdict);
+    }
+
+    return verdicts;
+}
+
+bool BenchmarkReport::ReadJSON(const std::string& json)
+{
+    Clear();
+
+    JSONReader reader(json);
+    if (!reader.Expect('{'))
+        return false;
+
+    if (!reader.Peek('}'))
+    {
+        do
+        {
+            std::string key;
+            if (!reader.ReadString(key) || !reader.Expect(':'))
+                return false;
+
+            if (key == "benchmark")
+            {
+                if (!reader.ReadString(_name))
+                    return false;
+            }
+            else if (key == "metrics")
+            {
+                if (!reader.Expect('['))
+                    return false;
+                if (reader.Expect(']'))
+                    continue;
+                do
+                {
+                    BenchmarkMetric metric;
+                    if (!ReadMetric(reader, metric))
+                        return false;
+                    Add(metric.Name, metric.Value, metric.Unit, metric.Direction, metric.Tolerance);
+                } while (reader.Expect(','));
+                if (!reader.Expect(']'))
+                    return false;
+            }
+            else if (!reader.SkipValue())
+                return false;
+        } while (reader.Expect(','));
+    }
+
+    return reader.Expect('}') && reader.End();
+}
+
+bool BenchmarkReport::Save(const std::string& path) const
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+    WriteJSON(file);
+    return (bool)file;
+}
+
+bool BenchmarkReport::Load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+    std::stringstream json;
+    json << file.rdbuf();
+    return ReadJSON(json.str());
+}
+
+std::string BenchmarkReport::FormatNumber(double value)
+{
+    // JSON has no representation of infinities and NaNs
+    if (!std::isfinite(value))
+        return "null";
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    return buffer;
+}
+
+std::string BenchmarkReport::FormatString(const std::string& value)
+{
+    std::string result = "\"";
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default: result += c; break;
+        }
+    }
+    result += "\"";
+    return result;
+}
+
+bool Passed(const std::vector<BenchmarkVerdict>& verdicts) noexcept
+{
+    for (const auto& verdict : verdicts)
+        if (!verdict.Passed)
+            return false;
+    return true;
+}
+
+} // namespace Statistics
+} // namespace CppTrader
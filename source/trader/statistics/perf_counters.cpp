@@ -0,0 +1,168 @@
+/*!
+    \file perf_counters.cpp
+    \brief Hardware performance counters implementation
+    \author Chris Urbanowicz
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/statistics/perf_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace CppTrader {
+namespace Statistics {
+
+#if defined(__linux__)
+
+namespace {
+
+void PrepareEvent(PerfCounter counter, perf_event_attr& attr)
+{
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    switch (counter)
+    {
+        case PerfCounter::CYCLES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PerfCounter::INSTRUCTIONS:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PerfCounter::L1D_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case PerfCounter::LLC_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PerfCounter::BRANCH_MISSES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PerfCounter::DTLB_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+    }
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+}
+
+} // namespace
+
+#endif
+
+PerfCounters::PerfCounters() noexcept
+    : _leader(-1),
+      _count(0)
+{
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+    {
+        _fds[i] = -1;
+        _positions[i] = PERF_COUNTERS;
+    }
+}
+
+bool PerfCounters::Open()
+{
+    Close();
+
+#if defined(__linux__)
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+    {
+        perf_event_attr attr;
+        PrepareEvent((PerfCounter)i, attr);
+
+        // The group leader starts disabled, other counters follow it
+        attr.disabled = (_leader < 0) ? 1 : 0;
+
+        int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, _leader, 0);
+        if (fd < 0)
+            continue;
+
+        if (_leader < 0)
+            _leader = fd;
+        _fds[i] = fd;
+        _positions[i] = _count++;
+    }
+
+    if (_count == 0)
+        return false;
+
+    ioctl(_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void PerfCounters::Close()
+{
+#if defined(__linux__)
+    if (_leader >= 0)
+        ioctl(_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // Close group members before the group leader
+    for (size_t i = PERF_COUNTERS; i-- > 0;)
+        if (_fds[i] >= 0)
+            close(_fds[i]);
+#endif
+
+    _leader = -1;
+    _count = 0;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+    {
+        _fds[i] = -1;
+        _positions[i] = PERF_COUNTERS;
+    }
+}
+
+bool PerfCounters::Read(PerfSample& sample) const noexcept
+{
+#if defined(__linux__)
+    if (_count == 0)
+        return false;
+
+    // Group read format: count, time enabled, time running, values
+    uint64_t buffer[3 + PERF_COUNTERS];
+    ssize_t size = read(_leader, buffer, sizeof(buffer));
+    if ((size < (ssize_t)((3 + _count) * sizeof(uint64_t))) || (buffer[0] != _count))
+        return false;
+
+    uint64_t enabled = buffer[1];
+    uint64_t running = buffer[2];
+    if (running == 0)
+        return false;
+
+    // Scale values if the group was multiplexed with other events
+    double scale = (running < enabled) ? ((double)enabled / (double)running) : 1.0;
+    for (size_t i = 0; i < PERF_COUNTERS; ++i)
+    {
+        if (_positions[i] < PERF_COUNTERS)
+        {
+            uint64_t value = buffer[3 + _positions[i]];
+            sample.Values[i] = (scale > 1.0) ? (uint64_t)((double)value * scale) : value;
+        }
+        else
+            sample.Values[i] = 0;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Statistics
+} // namespace CppTrader
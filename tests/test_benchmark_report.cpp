@@ -0,0 +1,88 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/statistics/benchmark_report.h"
+
+#include <sstream>
+
+using namespace CppTrader::Statistics;
+
+TEST_CASE("Benchmark report JSON", "[CppTrader][Statistics]")
+{
+    BenchmarkReport report("synthetic");
+    report.Add("command_throughput", 5123456.0, "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+    report.Add("add_limit_p99", 250.0, "ns", MetricDirection::LOWER_IS_BETTER, 0.25);
+    report.Add("errors", 0.0, "", MetricDirection::LOWER_IS_BETTER);
+    report.Add("errors", 1.0, "", MetricDirection::LOWER_IS_BETTER);
+    REQUIRE(report.metrics().size() == 3);
+    REQUIRE(report.Find("errors")->Value == 1.0);
+    REQUIRE(report.Find("unknown") == nullptr);
+
+    std::stringstream json;
+    report.WriteJSON(json);
+
+    BenchmarkReport loaded;
+    REQUIRE(loaded.ReadJSON(json.str()));
+    REQUIRE(loaded.name() == "synthetic");
+    REQUIRE(loaded.metrics().size() == 3);
+    REQUIRE(loaded.Find("command_throughput")->Value == 5123456.0);
+    REQUIRE(loaded.Find("command_throughput")->Unit == "cmd/s");
+    REQUIRE(loaded.Find("command_throughput")->Direction == MetricDirection::HIGHER_IS_BETTER);
+    REQUIRE(loaded.Find("command_throughput")->Tolerance < 0.0);
+    REQUIRE(loaded.Find("add_limit_p99")->Tolerance == 0.25);
+
+    // Unknown fields are skipped
+    REQUIRE(loaded.ReadJSON("{ \"benchmark\": \"test\", \"machine\": { \"cpus\": [1, 2] }, \"metrics\": [ { \"name\": \"x\", \"value\": 1e3, \"better\": \"higher\", \"note\": true } ] }"));
+    REQUIRE(loaded.Find("x")->Value == 1000.0);
+
+    // Malformed reports
+    REQUIRE(!loaded.ReadJSON(""));
+    REQUIRE(!loaded.ReadJSON("{ \"metrics\": [ { \"name\": \"x\" } ] }"));
+    REQUIRE(!loaded.ReadJSON("{ \"metrics\": [ { \"name\": \"x\", \"value\": 1, \"better\": \"faster\" } ] }"));
+    REQUIRE(!loaded.ReadJSON("{ \"benchmark\": \"test\" } trailing"));
+}
+
+TEST_CASE("Benchmark report comparison", "[CppTrader][Statistics]")
+{
+    BenchmarkReport baseline("synthetic");
+    baseline.Add("throughput", 1000.0, "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+    baseline.Add("latency", 100.0, "ns", MetricDirection::LOWER_IS_BETTER);
+    baseline.Add("p99", 1000.0, "ns", MetricDirection::LOWER_IS_BETTER, 0.5);
+    baseline.Add("errors", 0.0, "", MetricDirection::LOWER_IS_BETTER);
+
+    BenchmarkReport current("synthetic");
+    current.Add("throughput", 950.0, "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+    current.Add("latency", 80.0, "ns", MetricDirection::LOWER_IS_BETTER);
+    current.Add("p99", 1400.0, "ns", MetricDirection::LOWER_IS_BETTER);
+    current.Add("errors", 0.0, "", MetricDirection::LOWER_IS_BETTER);
+    current.Add("new_metric", 1.0, "", MetricDirection::LOWER_IS_BETTER);
+
+    std::vector<BenchmarkVerdict> verdicts = current.Compare(baseline, 0.1);
+    REQUIRE(verdicts.size() == 4);
+    REQUIRE(verdicts[0].Passed);
+    REQUIRE(verdicts[0].Change == Approx(-0.05));
+    REQUIRE(verdicts[1].Passed);
+    REQUIRE(verdicts[2].Passed);
+    REQUIRE(verdicts[2].Tolerance == 0.5);
+    REQUIRE(verdicts[3].Passed);
+    REQUIRE(Passed(verdicts));
+
+    // Regressions beyond the tolerance
+    current.Add("throughput", 800.0, "cmd/s", MetricDirection::HIGHER_IS_BETTER);
+    current.Add("errors", 3.0, "", MetricDirection::LOWER_IS_BETTER);
+    verdicts = current.Compare(baseline, 0.1);
+    REQUIRE(!verdicts[0].Passed);
+    REQUIRE(verdicts[1].Passed);
+    REQUIRE(!verdicts[3].Passed);
+    REQUIRE(!Passed(verdicts));
+
+    // Missing metrics fail
+    BenchmarkReport empty("synthetic");
+    verdicts = empty.Compare(baseline, 0.1);
+    REQUIRE(verdicts.size() == 4);
+    REQUIRE(verdicts[0].Missing);
+    REQUIRE(!Passed(verdicts));
+}
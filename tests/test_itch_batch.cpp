@@ -0,0 +1,126 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/providers/nasdaq/itch_batch.h"
+
+using namespace CppTrader::ITCH;
+
+namespace {
+
+void AppendBigEndian(std::vector<uint8_t>& buffer, uint64_t value, size_t size)
+{
+    for (size_t i = size; i > 0; --i)
+        buffer.push_back((uint8_t)(value >> (8 * (i - 1))));
+}
+
+void AppendMessage(std::vector<uint8_t>& buffer, const std::vector<uint8_t>& message)
+{
+    AppendBigEndian(buffer, message.size(), 2);
+    buffer.insert(buffer.end(), message.begin(), message.end());
+}
+
+std::vector<uint8_t> AddOrder(uint64_t timestamp, uint64_t id, char side, uint32_t shares, uint32_t price)
+{
+    std::vector<uint8_t> message = { 'A' };
+    AppendBigEndian(message, 7, 2);
+    AppendBigEndian(message, 0, 2);
+    AppendBigEndian(message, timestamp, 6);
+    AppendBigEndian(message, id, 8);
+    message.push_back((uint8_t)side);
+    AppendBigEndian(message, shares, 4);
+    message.insert(message.end(), { 'A', 'A', 'P', 'L', ' ', ' ', ' ', ' ' });
+    AppendBigEndian(message, price, 4);
+    return message;
+}
+
+std::vector<uint8_t> OrderExecuted(uint64_t timestamp, uint64_t id, uint32_t shares)
+{
+    std::vector<uint8_t> message = { 'E' };
+    AppendBigEndian(message, 7, 2);
+    AppendBigEndian(message, 0, 2);
+    AppendBigEndian(message, timestamp, 6);
+    AppendBigEndian(message, id, 8);
+    AppendBigEndian(message, shares, 4);
+    AppendBigEndian(message, 100, 8);
+    return message;
+}
+
+std::vector<uint8_t> OrderCancel(uint64_t timestamp, uint64_t id, uint32_t shares)
+{
+    std::vector<uint8_t> message = { 'X' };
+    AppendBigEndian(message, 7, 2);
+    AppendBigEndian(message, 0, 2);
+    AppendBigEndian(message, timestamp, 6);
+    AppendBigEndian(message, id, 8);
+    AppendBigEndian(message, shares, 4);
+    return message;
+}
+
+} // namespace
+
+TEST_CASE("ITCH batch decoding", "[CppTrader][Providers][NASDAQ]")
+{
+    std::vector<uint8_t> buffer;
+    AppendMessage(buffer, { 'S', 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 'O' });
+    AppendMessage(buffer, AddOrder(0x010203040506, 1, 'B', 100, 1000));
+    AppendMessage(buffer, AddOrder(2, 2, 'S', 200, 1100));
+    AppendMessage(buffer, OrderExecuted(3, 1, 40));
+    AppendMessage(buffer, OrderCancel(4, 2, 50));
+    AppendMessage(buffer, { 'X', 0, 1 });
+
+    ITCHHandler itch_handler;
+
+    SECTION("Whole buffer")
+    {
+        MessageBatch batch;
+        REQUIRE(itch_handler.Decode(buffer.data(), buffer.size(), batch) == buffer.size());
+
+        REQUIRE(batch.size() == 5);
+        REQUIRE(batch.Others == 1);
+        REQUIRE(batch.Errors == 1);
+        REQUIRE(batch.Types[0] == 'S');
+        REQUIRE(batch.Indexes[0] == MessageBatch::NONE);
+        REQUIRE(batch.Types[2] == 'A');
+        REQUIRE(batch.Indexes[2] == 1);
+
+        REQUIRE(batch.AddOrders.Count == 2);
+        REQUIRE(batch.AddOrders.StockLocate[0] == 7);
+        REQUIRE(batch.AddOrders.Timestamp[0] == 0x010203040506);
+        REQUIRE(batch.AddOrders.OrderReferenceNumber[1] == 2);
+        REQUIRE(batch.AddOrders.BuySellIndicator[1] == 'S');
+        REQUIRE(batch.AddOrders.Shares[1] == 200);
+        REQUIRE(batch.AddOrders.Price[1] == 1100);
+        REQUIRE(std::string(batch.AddOrders.Stock[0].data(), 4) == "AAPL");
+        REQUIRE(batch.AddOrders.Attribution[0] == '\0');
+
+        REQUIRE(batch.OrderExecutions.Count == 1);
+        REQUIRE(batch.OrderExecutions.ExecutedShares[0] == 40);
+        REQUIRE(batch.OrderExecutions.MatchNumber[0] == 100);
+        REQUIRE(batch.OrderExecutions.ExecutionPrice[0] == 0);
+
+        REQUIRE(batch.OrderCancels.Count == 1);
+        REQUIRE(batch.OrderCancels.OrderReferenceNumber[0] == 2);
+        REQUIRE(batch.OrderCancels.CanceledShares[0] == 50);
+
+        batch.Clear();
+        REQUIRE(batch.empty());
+        REQUIRE(batch.AddOrders.Count == 0);
+    }
+
+    SECTION("Limited capacity and incomplete message")
+    {
+        MessageBatch batch(2);
+        size_t consumed = itch_handler.Decode(buffer.data(), buffer.size(), batch);
+        REQUIRE(batch.full());
+        REQUIRE(consumed == (2 + 12) + (2 + 36));
+
+        batch.Clear();
+        size_t partial = itch_handler.Decode(buffer.data() + consumed, 2 + 36 + 10, batch);
+        REQUIRE(partial == 2 + 36);
+        REQUIRE(batch.size() == 1);
+        REQUIRE(batch.AddOrders.OrderReferenceNumber[0] == 2);
+    }
+}
@@ -0,0 +1,143 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/providers/nasdaq/itch_index.h"
+#include "trader/replay/event_replayer.h"
+#include "trader/replay/itch_converter.h"
+
+#include <vector>
+
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Replay;
+
+namespace {
+
+const uint64_t SECOND = 1000000000;
+
+class MyITCHConverter : public ITCHConverter
+{
+public:
+    explicit MyITCHConverter(MarketManager& market) : _replayer(market) {}
+
+protected:
+    bool onEvent(const Event& event) override { _replayer.Replay(event); return true; }
+
+private:
+    EventReplayer _replayer;
+};
+
+void Append(std::vector<uint8_t>& buffer, uint64_t value, size_t size)
+{
+    for (size_t i = size; i-- > 0;)
+        buffer.push_back((uint8_t)(value >> (8 * i)));
+}
+
+void AppendHeader(std::vector<uint8_t>& buffer, size_t size, char type, uint64_t timestamp)
+{
+    Append(buffer, size, 2);
+    buffer.push_back((uint8_t)type);
+    Append(buffer, 1, 2);
+    Append(buffer, 0, 2);
+    Append(buffer, timestamp, 6);
+}
+
+void AppendStockDirectory(std::vector<uint8_t>& buffer, uint64_t timestamp)
+{
+    AppendHeader(buffer, 39, 'R', timestamp);
+    buffer.insert(buffer.end(), { 'T', 'E', 'S', 'T', ' ', ' ', ' ', ' ' });
+    buffer.insert(buffer.end(), 20, 0);
+}
+
+void AppendAddOrder(std::vector<uint8_t>& buffer, uint64_t timestamp, uint64_t id, uint32_t price)
+{
+    AppendHeader(buffer, 36, 'A', timestamp);
+    Append(buffer, id, 8);
+    buffer.push_back('B');
+    Append(buffer, 100, 4);
+    buffer.insert(buffer.end(), { 'T', 'E', 'S', 'T', ' ', ' ', ' ', ' ' });
+    Append(buffer, price, 4);
+}
+
+void AppendOrderDelete(std::vector<uint8_t>& buffer, uint64_t timestamp, uint64_t id)
+{
+    AppendHeader(buffer, 19, 'D', timestamp);
+    Append(buffer, id, 8);
+}
+
+// Stock directory at 0.5s, then one add order every 0.5s and a delete of the first order at 4.2s
+std::vector<uint8_t> Stream()
+{
+    std::vector<uint8_t> stream;
+    AppendStockDirectory(stream, SECOND / 2);
+    for (uint64_t i = 1; i <= 8; ++i)
+        AppendAddOrder(stream, SECOND / 2 + i * SECOND / 2, i, (uint32_t)(10000 + i));
+    AppendOrderDelete(stream, 4 * SECOND + SECOND / 5, 1);
+    return stream;
+}
+
+} // namespace
+
+TEST_CASE("ITCHIndex", "[CppTrader][Providers][NASDAQ]")
+{
+    std::vector<uint8_t> stream = Stream();
+
+    SECTION("Offsets")
+    {
+        ITCHIndex index;
+        ITCHIndexBuilder builder(index, SECOND);
+
+        // Split the stream into single bytes
+        for (auto& byte : stream)
+            REQUIRE(builder.Process(&byte, 1));
+
+        REQUIRE(builder.messages() == 10);
+        REQUIRE(builder.offset() == stream.size());
+
+        // Checkpoints at 0s, 1s, 2s, 3s and 4s
+        REQUIRE(index.entries().size() == 5);
+        REQUIRE(index.entries()[0].Offset == 0);
+        REQUIRE(index.entries()[0].Messages == 0);
+        REQUIRE(index.entries()[1].Timestamp == SECOND);
+        REQUIRE(index.entries()[1].Messages == 1);
+        REQUIRE(index.entries()[1].Offset == 41);
+        REQUIRE(index.entries()[4].Timestamp == 4 * SECOND);
+        REQUIRE(index.entries()[4].Messages == 7);
+        REQUIRE(index.entries()[4].Offset == 41 + 6 * 38);
+        REQUIRE(index.snapshots().empty());
+
+        REQUIRE(index.Seek(0)->Messages == 0);
+        REQUIRE(index.Seek(2 * SECOND + 1)->Timestamp == 2 * SECOND);
+        REQUIRE(index.Seek(100 * SECOND)->Timestamp == 4 * SECOND);
+    }
+
+    SECTION("Snapshots")
+    {
+        MarketManager market;
+        MyITCHConverter converter(market);
+
+        ITCHIndex index;
+        ITCHIndexBuilder builder(index, SECOND, &converter, &market);
+        REQUIRE(builder.Process(stream.data(), stream.size()));
+
+        const ITCHIndexEntry* entry = index.Seek(3 * SECOND);
+        REQUIRE(entry != nullptr);
+        REQUIRE(entry->Messages == 5);
+        REQUIRE(entry->SnapshotSize == 5);
+
+        // Restore the book at 3s and replay the rest of the stream
+        MarketManager restored;
+        REQUIRE(index.Restore(*entry, restored));
+        REQUIRE(restored.orders().size() == 4);
+
+        MyITCHConverter restored_converter(restored);
+        REQUIRE(restored_converter.Process(stream.data() + entry->Offset, stream.size() - entry->Offset));
+
+        REQUIRE(restored.orders().size() == market.orders().size());
+        REQUIRE(restored.GetOrder(1) == nullptr);
+        REQUIRE(restored.GetOrderBook(1)->best_bid()->Price == market.GetOrderBook(1)->best_bid()->Price);
+    }
+}
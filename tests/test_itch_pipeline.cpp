@@ -0,0 +1,139 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/pipeline/itch_pipeline.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppTrader::Matching;
+using namespace CppTrader::Pipeline;
+using namespace CppTrader::Replay;
+
+namespace {
+
+class MyITCHPipeline : public ITCHPipeline
+{
+public:
+    using ITCHPipeline::ITCHPipeline;
+
+    std::atomic<uint64_t> updates{0};
+    std::atomic<uint64_t> best_bid{0};
+
+protected:
+    void onUpdate(size_t consumer, const BookUpdate& update) override
+    {
+        ++updates;
+        if (consumer == 0)
+            best_bid = update.BidPrice;
+    }
+};
+
+void Append(std::vector<uint8_t>& buffer, uint64_t value, size_t size)
+{
+    for (size_t i = size; i-- > 0;)
+        buffer.push_back((uint8_t)(value >> (8 * i)));
+}
+
+void AppendHeader(std::vector<uint8_t>& buffer, size_t size, char type, uint64_t timestamp)
+{
+    Append(buffer, size, 2);
+    buffer.push_back((uint8_t)type);
+    Append(buffer, 1, 2);
+    Append(buffer, 0, 2);
+    Append(buffer, timestamp, 6);
+}
+
+// Stock directory, 1000 buy orders and deletes of all orders except the last one
+std::vector<uint8_t> Stream()
+{
+    std::vector<uint8_t> stream;
+    AppendHeader(stream, 39, 'R', 0);
+    stream.insert(stream.end(), { 'T', 'E', 'S', 'T', ' ', ' ', ' ', ' ' });
+    stream.insert(stream.end(), 20, 0);
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        AppendHeader(stream, 36, 'A', i);
+        Append(stream, i, 8);
+        stream.push_back('B');
+        Append(stream, 100, 4);
+        stream.insert(stream.end(), { 'T', 'E', 'S', 'T', ' ', ' ', ' ', ' ' });
+        Append(stream, 10000 + i, 4);
+    }
+    for (uint64_t i = 1; i < 1000; ++i)
+    {
+        AppendHeader(stream, 19, 'D', 1000 + i);
+        Append(stream, i, 8);
+    }
+    return stream;
+}
+
+} // namespace
+
+TEST_CASE("ITCH pipeline", "[CppTrader][Pipeline]")
+{
+    std::vector<uint8_t> stream = Stream();
+
+    // Tiny chunks and queues to exercise backpressure
+    PipelineSettings settings;
+    settings.ChunkSize = 7;
+    settings.Chunks = 4;
+    settings.EventsQueue = 8;
+    settings.UpdatesQueue = 8;
+    settings.Consumers = 2;
+
+    SECTION("Memory buffer")
+    {
+        MarketManager market;
+        MyITCHPipeline pipeline(market, settings);
+        REQUIRE(pipeline.Run(stream.data(), stream.size()));
+
+        REQUIRE(pipeline.bytes() == stream.size());
+        REQUIRE(pipeline.messages() == 2000);
+        REQUIRE(pipeline.errors() == 0);
+        REQUIRE(pipeline.book().Items == 2000);
+        REQUIRE(pipeline.book().Service.count() == 2000);
+        REQUIRE(pipeline.consumer(0).Items == 2000);
+        REQUIRE(pipeline.consumer(1).Items == 2000);
+        REQUIRE(pipeline.updates == 4000);
+        REQUIRE(pipeline.best_bid == 11000);
+        REQUIRE(market.orders().size() == 1);
+    }
+
+    SECTION("Reader")
+    {
+        class MemoryReader : public CppCommon::Reader
+        {
+        public:
+            MemoryReader(const std::vector<uint8_t>& data) : _data(data), _offset(0) {}
+
+            size_t Read(void* buffer, size_t size) override
+            {
+                size = std::min(size, _data.size() - _offset);
+                std::memcpy(buffer, _data.data() + _offset, size);
+                _offset += size;
+                return size;
+            }
+
+        private:
+            const std::vector<uint8_t>& _data;
+            size_t _offset;
+        };
+
+        MemoryReader input(stream);
+
+        MarketManager market;
+        MyITCHPipeline pipeline(market, settings);
+        REQUIRE(pipeline.Run(input));
+
+        REQUIRE(pipeline.bytes() == stream.size());
+        REQUIRE(pipeline.reader().Items == (stream.size() + 6) / 7);
+        REQUIRE(pipeline.parser().Items == pipeline.reader().Items);
+        REQUIRE(pipeline.consumer(1).Items == 2000);
+        REQUIRE(pipeline.best_bid == 11000);
+        REQUIRE(market.orders().size() == 1);
+    }
+}
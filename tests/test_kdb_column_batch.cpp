@@ -0,0 +1,109 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/kdbp_db.h"
+
+namespace {
+
+struct TestRow
+{
+    uint64_t Id;
+    int32_t Side;
+    double Price;
+    const char* Symbol;
+};
+
+int64_t Notional(const TestRow& row)
+{
+    return (int64_t)(row.Price * 100.0);
+}
+
+typedef KdbColumnBatch<TestRow,
+    KdbField<KJ, &TestRow::Id>,
+    KdbField<KH, &TestRow::Side>,
+    KdbField<KF, &TestRow::Price>,
+    KdbField<KS, &TestRow::Symbol>,
+    KdbField<KJ, &Notional>> TestBatch;
+
+} // namespace
+
+TEST_CASE("kdb+ column batch", "[CppTrader][kdb+]")
+{
+    TestBatch batch(4);
+    REQUIRE(TestBatch::COLUMNS == 5);
+    REQUIRE(batch.empty());
+    REQUIRE(batch.capacity() == 4);
+
+    batch.Add(TestRow{ 1, 0, 10.5, "AAPL" });
+    batch.Add(TestRow{ 2, 1, 20.25, "MSFT" });
+
+    K columns = batch.Emit();
+    REQUIRE(columns->t == 0);
+    REQUIRE(columns->n == 5);
+    REQUIRE(columns->r == 1);
+    REQUIRE(kK(columns)[0]->t == KJ);
+    REQUIRE(kK(columns)[0]->n == 2);
+    REQUIRE(kJ(kK(columns)[0])[1] == 2);
+    REQUIRE(kK(columns)[1]->t == KH);
+    REQUIRE(kH(kK(columns)[1])[1] == 1);
+    REQUIRE(kF(kK(columns)[2])[0] == 10.5);
+    REQUIRE(kK(columns)[3]->t == KS);
+    REQUIRE(kS(kK(columns)[3])[0] == ss((S)"AAPL"));
+    REQUIRE(kJ(kK(columns)[4])[1] == 2025);
+
+    // Serialized columns are the same as kdb+ deserializes them back
+    K bytes = b9(3, columns);
+    REQUIRE(bytes != nullptr);
+    K copy = d9(bytes);
+    REQUIRE(copy->n == 5);
+    REQUIRE(kK(copy)[0]->n == 2);
+    REQUIRE(kS(kK(copy)[3])[1] == ss((S)"MSFT"));
+    r0(copy);
+    r0(bytes);
+
+    // The consumer releases emitted columns
+    r0(columns);
+    REQUIRE(batch.column(0)->r == 0);
+}
+
+TEST_CASE("kdb+ column batch reuse and growth", "[CppTrader][kdb+]")
+{
+    TestBatch batch(2);
+    K column = batch.column(0);
+
+    // Columns are reused across batches which fit into the capacity
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        std::vector<TestRow> rows = { { i, 0, 1.0, "A" }, { i + 1, 1, 2.0, "B" } };
+        K columns = batch.Emit(rows);
+        REQUIRE(batch.column(0) == column);
+        REQUIRE(kJ(kK(columns)[0])[0] == (J)i);
+        r0(columns);
+    }
+
+    // Columns grow geometrically and keep already added rows
+    batch.Clear();
+    for (uint64_t i = 0; i < 100; ++i)
+        batch.Add(TestRow{ i, (int32_t)(i % 2), (double)i, "C" });
+    REQUIRE(batch.size() == 100);
+    REQUIRE(batch.capacity() == 128);
+
+    K columns = batch.Emit();
+    REQUIRE(kK(columns)[0]->n == 100);
+    for (uint64_t i = 0; i < 100; ++i)
+    {
+        REQUIRE(kJ(kK(columns)[0])[i] == (J)i);
+        REQUIRE(kF(kK(columns)[2])[i] == (double)i);
+    }
+    r0(columns);
+
+    // Smaller batches do not shrink columns
+    std::vector<TestRow> rows = { { 7, 0, 7.0, "D" } };
+    column = batch.column(0);
+    r0(batch.Emit(rows));
+    REQUIRE(batch.column(0) == column);
+    REQUIRE(batch.capacity() == 128);
+}
@@ -0,0 +1,159 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/kdb_ipc.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace CppTrader;
+
+namespace {
+
+struct TestRow
+{
+    uint64_t Id;
+    uint8_t Side;
+    double Price;
+    char Symbol[8];
+    std::string Account;
+};
+
+typedef KdbIpcMessage<TestRow,
+    KdbField<KJ, &TestRow::Id>,
+    KdbField<KH, &TestRow::Side>,
+    KdbField<KF, &TestRow::Price>,
+    KdbField<KS, &TestRow::Symbol>,
+    KdbField<KS, &TestRow::Account>,
+    KdbField<KB, &TestRow::Side>> TestMessage;
+
+// Serialize the same message with the kdb+ C library
+K Expected(const std::vector<TestRow>& rows)
+{
+    J n = (J)rows.size();
+    K ids = ktn(KJ, n), sides = ktn(KH, n), prices = ktn(KF, n), symbols = ktn(KS, n), accounts = ktn(KS, n), flags = ktn(KB, n);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        kJ(ids)[i] = rows[i].Id;
+        kH(sides)[i] = rows[i].Side;
+        kF(prices)[i] = rows[i].Price;
+        kS(symbols)[i] = sn((S)rows[i].Symbol, (I)strnlen(rows[i].Symbol, 8));
+        kS(accounts)[i] = ss((S)rows[i].Account.c_str());
+        kG(flags)[i] = rows[i].Side;
+    }
+    K message = knk(3, kp((S)"insert"), ks((S)"test"), knk(6, ids, sides, prices, symbols, accounts, flags));
+    K bytes = b9(3, message);
+    r0(message);
+    return bytes;
+}
+
+} // namespace
+
+TEST_CASE("kdb+ IPC message serialization", "[CppTrader][kdb+]")
+{
+    std::vector<TestRow> rows;
+    rows.push_back(TestRow{ 1, 0, 10.5, { 'A', 'A', 'P', 'L' }, "alice" });
+    rows.push_back(TestRow{ 2, 1, 20.25, { 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H' }, "bob" });
+    rows.push_back(TestRow{ 3, 1, 30.0, { 0 }, "" });
+
+    TestMessage message("insert", "test", 16);
+    REQUIRE(TestMessage::COLUMNS == 6);
+
+    // Wire format is the same as the kdb+ C library serialization
+    for (size_t count = 0; count <= rows.size(); ++count)
+    {
+        std::vector<TestRow> batch(rows.begin(), rows.begin() + count);
+        size_t size = message.Serialize(batch);
+        K expected = Expected(batch);
+        REQUIRE(size == (size_t)expected->n);
+        REQUIRE(message.data()[1] == 0);
+        REQUIRE(std::memcmp(message.data() + 2, kG(expected) + 2, size - 2) == 0);
+        r0(expected);
+    }
+    REQUIRE(message.capacity() >= message.size());
+
+    // Synchronous message type
+    message.Serialize(rows, true);
+    REQUIRE(message.data()[1] == 1);
+
+    // Serialized message is deserialized by the kdb+ C library (d9() requires its initialization)
+    khp((S)"", -1);
+    K bytes = ktn(KG, message.size());
+    std::memcpy(kG(bytes), message.data(), message.size());
+    K copy = d9(bytes);
+    REQUIRE(copy != nullptr);
+    REQUIRE(copy->t == 0);
+    REQUIRE(kK(copy)[1]->s == ss((S)"test"));
+    K columns = kK(copy)[2];
+    REQUIRE(columns->n == 6);
+    REQUIRE(kJ(kK(columns)[0])[2] == 3);
+    REQUIRE(kF(kK(columns)[2])[1] == 20.25);
+    REQUIRE(kS(kK(columns)[3])[1] == ss((S)"ABCDEFGH"));
+    REQUIRE(kS(kK(columns)[4])[0] == ss((S)"alice"));
+    r0(copy);
+    r0(bytes);
+}
+
+TEST_CASE("kdb+ IPC message transport", "[CppTrader][kdb+]")
+{
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    std::vector<TestRow> rows(1000, TestRow{ 7, 1, 1.5, { 'S', 'Y', 'M' }, "account" });
+    TestMessage message("upsert", "test");
+
+    // Asynchronous message is sent with a single write
+    REQUIRE(message.Send(sockets[0], rows));
+    std::vector<uint8_t> received(message.size());
+    size_t offset = 0;
+    while (offset < received.size())
+    {
+        ssize_t result = read(sockets[1], received.data() + offset, received.size() - offset);
+        REQUIRE(result > 0);
+        offset += (size_t)result;
+    }
+    REQUIRE(std::memcmp(received.data(), message.data(), message.size()) == 0);
+
+    // Synchronous message reads the response
+    uint8_t response[] = { 1, 2, 0, 0, 10, 0, 0, 0, (uint8_t)-KH, 0 };
+    REQUIRE(write(sockets[1], response, sizeof(response)) == sizeof(response));
+    REQUIRE(message.Send(sockets[0], rows, true));
+    offset = 0;
+    while (offset < received.size())
+        offset += (size_t)read(sockets[1], received.data() + offset, received.size() - offset);
+
+    // Error response fails the synchronous message
+    uint8_t error[] = { 1, 2, 0, 0, 14, 0, 0, 0, 0x80, 't', 'y', 'p', 'e', 0 };
+    REQUIRE(write(sockets[1], error, sizeof(error)) == sizeof(error));
+    REQUIRE(!message.Send(sockets[0], rows, true));
+    offset = 0;
+    while (offset < received.size())
+        offset += (size_t)read(sockets[1], received.data() + offset, received.size() - offset);
+
+    // Message type is taken from the serialized header
+    uint8_t large[] = { 1, 2, 0, 0, 0x08, 0x20, 0, 0, 0x80, 'e' };
+    std::vector<uint8_t> large_response(0x2008, 0);
+    std::memcpy(large_response.data(), large, sizeof(large));
+    REQUIRE(write(sockets[1], large_response.data(), large_response.size()) == (ssize_t)large_response.size());
+    REQUIRE(!message.Send(sockets[0]));
+    offset = 0;
+    while (offset < received.size())
+        offset += (size_t)read(sockets[1], received.data() + offset, received.size() - offset);
+
+    // Compressed and oversized responses are rejected
+    uint8_t compressed[] = { 1, 2, 1, 0, 8, 0, 0, 0 };
+    REQUIRE(write(sockets[1], compressed, sizeof(compressed)) == sizeof(compressed));
+    REQUIRE(!message.Send(sockets[0]));
+    offset = 0;
+    while (offset < received.size())
+        offset += (size_t)read(sockets[1], received.data() + offset, received.size() - offset);
+    uint8_t oversized[] = { 1, 2, 0, 0, 0, 0, 0, 0x80 };
+    REQUIRE(write(sockets[1], oversized, sizeof(oversized)) == sizeof(oversized));
+    REQUIRE(!message.Send(sockets[0]));
+
+    close(sockets[0]);
+    close(sockets[1]);
+}
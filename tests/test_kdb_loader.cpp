@@ -0,0 +1,182 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/kdb_loader.h"
+
+using namespace CppTrader;
+using namespace CppTrader::Matching;
+using namespace CppTrader::Risk;
+
+namespace {
+
+// Build the kdb+ table of the given named columns
+K Table(std::initializer_list<const char*> names, std::initializer_list<K> columns)
+{
+    K keys = ktn(KS, 0);
+    for (auto name : names)
+        js(&keys, ss((S)name));
+    K values = ktn(0, 0);
+    for (auto column : columns)
+        jk(&values, column);
+    return xT(xD(keys, values));
+}
+
+template <int KType, typename T>
+K Column(std::initializer_list<T> values)
+{
+    K column = ktn(KType, (J)values.size());
+    size_t i = 0;
+    for (auto value : values)
+    {
+        if constexpr (KType == KS)
+            kS(column)[i++] = ss((S)value);
+        else
+            ((typename KdbColumnType<KType>::Type*)kG(column))[i++] = (typename KdbColumnType<KType>::Type)value;
+    }
+    return column;
+}
+
+} // namespace
+
+TEST_CASE("kdb+ table view", "[CppTrader][Kdb]")
+{
+    khp((S)"", -1);
+
+    K table = Table({ "Id", "Price" }, { Column<KJ>({ 1, 2, 3 }), Column<KF>({ 1.5, 2.5, 3.5 }) });
+    KdbTable view(table);
+    REQUIRE(view.valid());
+    REQUIRE(view.rows() == 3);
+    REQUIRE(view.column<KJ>("Id")[2] == 3);
+    REQUIRE(view.column<KF>("Price")[0] == 1.5);
+    REQUIRE(view.column<KF>("Id") == nullptr);
+    REQUIRE(view.column<KJ>("Quantity") == nullptr);
+
+    // Keyed table exposes both key and value columns
+    K keyed = xD(Table({ "Id" }, { Column<KJ>({ 7, 8 }) }), Table({ "Quantity" }, { Column<KJ>({ 70, 80 }) }));
+    KdbTable keyed_view(keyed);
+    REQUIRE(keyed_view.valid());
+    REQUIRE(keyed_view.rows() == 2);
+    REQUIRE(keyed_view.column<KJ>("Id")[1] == 8);
+    REQUIRE(keyed_view.column<KJ>("Quantity")[1] == 80);
+
+    // Table without columns has no rows
+    K empty = ka(XT);
+    empty->k = xD(ktn(KS, 0), ktn(0, 0));
+    KdbTable empty_view(empty);
+    REQUIRE(empty_view.rows() == 0);
+    REQUIRE(empty_view.column<KJ>("Id") == nullptr);
+
+    K atom = kj(1);
+    REQUIRE(!KdbTable(atom).valid());
+    REQUIRE(!KdbTable(nullptr).valid());
+
+    r0(atom);
+    r0(empty);
+    r0(keyed);
+    r0(table);
+}
+
+TEST_CASE("kdb+ state loader", "[CppTrader][Kdb]")
+{
+    khp((S)"", -1);
+
+    MarketManager market;
+    PositionBook positions;
+
+    K symbols = Table({ "Id", "Time", "Name", "Type", "Multiplier", "QuantityDivisor" },
+        { Column<KH>({ 0, 1 }), Column<KJ>({ 0, 0 }), Column<KS>({ "BTCUSD", "ETHUSD" }),
+          Column<KH>({ (int)SymbolType::VANILLAPERP, (int)SymbolType::INVERSEPERP }), Column<KJ>({ 1000, 50 }), Column<KJ>({ 10, 100 }) });
+    REQUIRE(KdbLoader::LoadSymbols(symbols, market) == 2);
+    REQUIRE(market.GetSymbol(1) != nullptr);
+    REQUIRE(std::string(market.GetSymbol(1)->Name) == "ETHUSD");
+    REQUIRE(market.GetSymbol(1)->Multiplier == 50);
+    REQUIRE(market.GetOrderBook(0) != nullptr);
+
+    // Open limit and stop orders are restored, closed and market orders are skipped
+    K orders = Table({ "Id", "SymbolId", "ExecutedQuantity", "LeavesQuantity", "MaxVisibleQuantity", "Price", "Quantity", "Side", "Slippage",
+                       "StopPrice", "TimeInForce", "TrailingDistance", "TrailingStep", "Type", "Time", "AccountId", "CurrentExecutedPrice",
+                       "CurrentExecutedQuantity", "Status" },
+        { Column<KJ>({ 1, 2, 3, 4, 5 }),
+          Column<KH>({ 0, 0, 0, 1, 0 }),
+          Column<KJ>({ 4, 0, 0, 0, 10 }),
+          Column<KJ>({ 6, 20, 5, 7, 0 }),
+          Column<KJ>({ ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX }),
+          Column<KJ>({ 100, 110, 0, 90, 100 }),
+          Column<KJ>({ 10, 20, 5, 7, 10 }),
+          Column<KH>({ (int)OrderSide::BUY, (int)OrderSide::SELL, (int)OrderSide::BUY, (int)OrderSide::BUY, (int)OrderSide::BUY }),
+          Column<KJ>({ ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX, ORDER_INT_MAX }),
+          Column<KJ>({ 0, 0, 120, 0, 0 }),
+          Column<KH>({ 0, 0, 0, 0, 0 }),
+          Column<KJ>({ 0, 0, 0, 0, 0 }),
+          Column<KJ>({ 0, 0, 0, 0, 0 }),
+          Column<KH>({ (int)OrderType::LIMIT, (int)OrderType::LIMIT, (int)OrderType::STOP, (int)OrderType::LIMIT, (int)OrderType::LIMIT }),
+          Column<KJ>({ 0, 0, 0, 0, 0 }),
+          Column<KJ>({ 10, 11, 12, 13, 14 }),
+          Column<KJ>({ 0, 0, 0, 0, 0 }),
+          Column<KJ>({ 0, 0, 0, 0, 0 }),
+          Column<KH>({ (int)OrderStatus::PARTIALLY_FILLED, (int)OrderStatus::PENDING, (int)OrderStatus::REPLACED,
+                       (int)OrderStatus::CANCELLED, (int)OrderStatus::FILLED }) });
+    REQUIRE(KdbLoader::LoadOrders(orders, market) == 3);
+    REQUIRE(market.orders().size() == 3);
+    REQUIRE(market.GetOrder(1)->ExecutedQuantity == 4);
+    REQUIRE(market.GetOrder(1)->LeavesQuantity == 6);
+    REQUIRE(market.GetOrder(1)->AccountId == 10);
+    REQUIRE(market.GetOrder(4) == nullptr);
+    REQUIRE(market.GetOrder(5) == nullptr);
+    REQUIRE(market.GetOrderBook(0)->best_bid()->Price == 100);
+    REQUIRE(market.GetOrderBook(0)->best_bid()->TotalVolume == 6);
+    REQUIRE(market.GetOrderBook(0)->best_ask()->Price == 110);
+    REQUIRE(market.GetOrderBook(0)->best_buy_stop()->Price == 120);
+
+    // Restored orders are matched as usual
+    market.EnableMatching();
+    REQUIRE(market.AddOrder(Order::SellLimit(6, 0, 100, 6)) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(1) == nullptr);
+
+    // Duplicate orders fail the restore
+    REQUIRE(KdbLoader::LoadOrders(orders, market) == -1);
+
+    K position_rows = Table({ "Id", "SymbolId", "AvgEntryPrice", "Quantity", "Side", "Time", "AccountId", "RiskZ", "RiskC", "Funding",
+                              "MarkPrice", "IndexPrice", "RealizedPnL", "UnrealizedPnL", "FundingTime" },
+        { Column<KJ>({ 1, 2, 3 }),
+          Column<KH>({ 0, 0, 1 }),
+          Column<KF>({ 100.5, 0.0, 90.0 }),
+          Column<KJ>({ 10, 0, 7 }),
+          Column<KH>({ 0, 0, 1 }),
+          Column<KJ>({ 0, 0, 0 }),
+          Column<KJ>({ 10, 11, 10 }),
+          Column<KF>({ 0.1, 0.0, 0.2 }),
+          Column<KF>({ 0.01, 0.0, 0.04 }),
+          Column<KF>({ 1.0, 0.0, 2.0 }),
+          Column<KJ>({ 101, 0, 91 }),
+          Column<KJ>({ 100, 0, 90 }),
+          Column<KF>({ 5.0, 3.0, 0.0 }),
+          Column<KF>({ 5.0, 0.0, -7.0 }),
+          Column<KJ>({ 1000, 0, 2000 }) });
+    REQUIRE(KdbLoader::LoadPositions(position_rows, positions) == 3);
+    REQUIRE(positions.size() == 3);
+    REQUIRE(positions.accounts() == 2);
+    REQUIRE(positions.dirty() == 0);
+    REQUIRE(positions.holders(0) == 1);
+    REQUIRE(positions.holders(1) == 1);
+    const Position* position = positions.GetPosition(1, 10);
+    REQUIRE(position != nullptr);
+    REQUIRE(position->Id == 3);
+    REQUIRE(position->Side == PositionSide::SHORT);
+    REQUIRE(position->Quantity == 7);
+    REQUIRE(position->UnrealizedPnL == -7.0);
+    REQUIRE(position->FundingTime == 2000);
+    REQUIRE(positions.GetPosition(0, 11)->RealizedPnL == 3.0);
+
+    // Missing columns fail the load
+    K missing = Table({ "Id" }, { Column<KJ>({ 1 }) });
+    REQUIRE(KdbLoader::LoadPositions(missing, positions) == -1);
+
+    r0(missing);
+    r0(position_rows);
+    r0(orders);
+    r0(symbols);
+}
@@ -0,0 +1,116 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/kdb_ipc.h"
+#include "trader/kdb_server.h"
+
+using namespace CppTrader;
+
+namespace {
+
+struct TestRow
+{
+    uint64_t Id;
+    double Price;
+    std::string Symbol;
+};
+
+typedef KdbIpcMessage<TestRow,
+    KdbField<KJ, &TestRow::Id>,
+    KdbField<KF, &TestRow::Price>,
+    KdbField<KS, &TestRow::Symbol>> TestMessage;
+
+K Columns(J count)
+{
+    K ids = ktn(KJ, count), prices = ktn(KF, count), symbols = ktn(KS, count);
+    for (J i = 0; i < count; ++i)
+    {
+        kJ(ids)[i] = i;
+        kF(prices)[i] = (double)i;
+        kS(symbols)[i] = ss((S)"AAPL");
+    }
+    return knk(3, ids, prices, symbols);
+}
+
+} // namespace
+
+TEST_CASE("kdb+ stand-in server", "[CppTrader][kdb+]")
+{
+    KdbServer server;
+    REQUIRE(server.Start());
+    REQUIRE(!server.Start());
+    REQUIRE(server.port() > 0);
+
+    I handle = khpu((S)"localhost", server.port(), (S)"user:password");
+    REQUIRE(handle > 0);
+
+    // Table definition
+    K result = k(handle, (S)"orders:([]id:`long$();price:`float$();sym:`symbol$())", (K)0);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->t == 101);
+    r0(result);
+
+    // Asynchronous inserts
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(k(-handle, (S)"insert", ks((S)"orders"), Columns(100), (K)0) != nullptr);
+
+    // Synchronous insert returns indexes of inserted rows
+    result = k(handle, (S)"insert", ks((S)"orders"), Columns(3), (K)0);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->t == KJ);
+    REQUIRE(result->n == 3);
+    REQUIRE(kJ(result)[0] == 1000);
+    REQUIRE(kJ(result)[2] == 1002);
+    r0(result);
+
+    // Synchronous upsert of a single row returns the table name
+    result = k(handle, (S)"upsert", ks((S)"positions"), knk(2, kj(1), kf(2.0)), (K)0);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->t == -KS);
+    REQUIRE(std::string(result->s) == "positions");
+    r0(result);
+
+    // Upsert of a table
+    K names = ktn(KS, 3);
+    kS(names)[0] = ss((S)"id");
+    kS(names)[1] = ss((S)"price");
+    kS(names)[2] = ss((S)"sym");
+    result = k(handle, (S)"upsert", ks((S)"positions"), xT(xD(names, Columns(5))), (K)0);
+    REQUIRE(result != nullptr);
+    r0(result);
+
+    // Direct IPC messages share the connection
+    std::vector<TestRow> rows(50, TestRow{ 1, 1.5, "MSFT" });
+    TestMessage message("insert", "orders");
+    REQUIRE(message.Send(handle, rows));
+    REQUIRE(message.Send(handle, rows, true));
+
+    // Count queries are replied with received rows
+    result = k(handle, (S)"count orders", (K)0);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->t == -KJ);
+    REQUIRE(result->j == 1103);
+    r0(result);
+    REQUIRE(server.rows("orders") == 1103);
+    REQUIRE(server.rows("positions") == 6);
+
+    // Other queries are replied with the generic null
+    result = k(handle, (S)"select from orders", (K)0);
+    REQUIRE(result != nullptr);
+    REQUIRE(result->t == 101);
+    r0(result);
+
+    kclose(handle);
+    server.Stop();
+    REQUIRE(!server.running());
+
+    KdbServerStats stats = server.stats();
+    REQUIRE(stats.Connections == 1);
+    REQUIRE(stats.Messages == 18);
+    REQUIRE(stats.SyncMessages == 7);
+    REQUIRE(stats.Rows == 1109);
+    REQUIRE(stats.Errors == 0);
+}
@@ -0,0 +1,141 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/kdb_sink.h"
+
+#include <chrono>
+
+using namespace CppTrader;
+
+namespace {
+
+struct TestRow
+{
+    uint64_t Id;
+    uint64_t Price;
+};
+
+} // namespace
+
+TEST_CASE("kdb+ sink without writer thread", "[CppTrader][kdb+]")
+{
+    KdbSinkSettings settings;
+    settings.BatchSize = 10;
+
+    KdbSink sink(settings);
+    std::vector<size_t> batches;
+    std::vector<uint64_t> ids;
+    auto& table = sink.AddTable<TestRow>("test", [&](const std::vector<TestRow>& rows)
+    {
+        batches.push_back(rows.size());
+        for (const auto& row : rows)
+            ids.push_back(row.Id);
+        return true;
+    });
+    REQUIRE(sink.tables() == 1);
+    REQUIRE(sink.table(0).name() == "test");
+
+    // Full batches are shipped in the producer thread
+    for (uint64_t i = 0; i < 25; ++i)
+        table.Push(TestRow{ i, 100 + i });
+    REQUIRE(batches.size() == 2);
+    REQUIRE(table.buffered() == 5);
+
+    table.Flush(true);
+    REQUIRE(batches.size() == 3);
+    REQUIRE(batches[2] == 5);
+    REQUIRE(table.buffered() == 0);
+    for (uint64_t i = 0; i < 25; ++i)
+        REQUIRE(ids[i] == i);
+
+    KdbSinkStats stats = table.stats();
+    REQUIRE(stats.Rows == 25);
+    REQUIRE(stats.Batches == 3);
+    REQUIRE(stats.Shipped == 25);
+    REQUIRE(stats.Errors == 0);
+    REQUIRE(stats.Blocks == 0);
+}
+
+TEST_CASE("kdb+ sink with writer thread", "[CppTrader][kdb+]")
+{
+    KdbSinkSettings settings;
+    settings.BatchSize = 100;
+    settings.MaxRows = 0;
+
+    KdbSink sink(settings);
+    std::vector<uint64_t> ids;
+    size_t failures = 0;
+    auto& table1 = sink.AddTable<TestRow>("table1", [&](const std::vector<TestRow>& rows)
+    {
+        for (const auto& row : rows)
+            ids.push_back(row.Id);
+        return true;
+    });
+    auto& table2 = sink.AddTable<TestRow>("table2", [&](const std::vector<TestRow>& rows)
+    {
+        ++failures;
+        return false;
+    });
+
+    REQUIRE(sink.Start());
+    REQUIRE(!sink.Start());
+    for (uint64_t i = 0; i < 100000; ++i)
+    {
+        table1.Push(TestRow{ i, i });
+        if ((i % 1000) == 0)
+            table2.Push(TestRow{ i, i });
+    }
+    sink.Stop();
+    REQUIRE(!sink.running());
+
+    // All rows are shipped in the order of their pushes
+    REQUIRE(ids.size() == 100000);
+    for (uint64_t i = 0; i < ids.size(); ++i)
+        REQUIRE(ids[i] == i);
+
+    KdbSinkStats stats1 = table1.stats();
+    REQUIRE(stats1.Rows == 100000);
+    REQUIRE(stats1.Shipped == 100000);
+    REQUIRE(stats1.Batches <= 1000);
+    REQUIRE(stats1.MaxBuffered >= 100);
+    REQUIRE(stats1.Errors == 0);
+
+    KdbSinkStats stats2 = table2.stats();
+    REQUIRE(stats2.Rows == 100);
+    REQUIRE(stats2.Batches == 1);
+    REQUIRE(stats2.Errors == 1);
+    REQUIRE(failures == 1);
+}
+
+TEST_CASE("kdb+ sink backpressure", "[CppTrader][kdb+]")
+{
+    KdbSinkSettings settings;
+    settings.BatchSize = 10;
+    settings.MaxRows = 20;
+
+    KdbSink sink(settings);
+    size_t shipped = 0;
+    auto& table = sink.AddTable<TestRow>("slow", [&](const std::vector<TestRow>& rows)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        shipped += rows.size();
+        return true;
+    });
+
+    REQUIRE(sink.Start());
+    for (uint64_t i = 0; i < 1000; ++i)
+        table.Push(TestRow{ i, i });
+    sink.Stop();
+
+    // The producer overflows the batch size and then waits for the slow writer
+    KdbSinkStats stats = table.stats();
+    REQUIRE(shipped == 1000);
+    REQUIRE(stats.Shipped == 1000);
+    REQUIRE(stats.Overflows > 0);
+    REQUIRE(stats.Blocks > 0);
+    REQUIRE(stats.BlockedTime > 0);
+    REQUIRE(stats.MaxBuffered <= 20);
+}
@@ -0,0 +1,50 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/statistics/latency_histogram.h"
+
+using namespace CppTrader::Statistics;
+
+TEST_CASE("Latency histogram", "[CppTrader][Statistics]")
+{
+    LatencyHistogram histogram;
+    REQUIRE(histogram.empty());
+    REQUIRE(histogram.Percentile(50.0) == 0);
+
+    for (uint64_t i = 1; i <= 100; ++i)
+        histogram.Record(i);
+
+    REQUIRE(histogram.count() == 100);
+    REQUIRE(histogram.min() == 1);
+    REQUIRE(histogram.max() == 100);
+    REQUIRE(histogram.mean() == 50.5);
+    REQUIRE(histogram.Percentile(50.0) == 50);
+    REQUIRE(histogram.Percentile(99.0) == 99);
+    REQUIRE(histogram.Percentile(100.0) == 100);
+
+    // Large values are recorded with the relative error below 1/64
+    histogram.Reset();
+    histogram.Record(1000000, 99);
+    histogram.Record(5000000000);
+    REQUIRE(histogram.Percentile(50.0) >= 1000000);
+    REQUIRE(histogram.Percentile(50.0) <= 1000000 + 1000000 / 64);
+    REQUIRE(histogram.Percentile(99.9) == 5000000000);
+
+    // Merge histograms
+    LatencyHistogram other;
+    other.Record(10);
+    histogram.Merge(other);
+    REQUIRE(histogram.count() == 101);
+    REQUIRE(histogram.min() == 10);
+    REQUIRE(histogram.Percentile(0.5) == 10);
+
+    // Coordinated omission correction
+    histogram.Reset();
+    histogram.RecordCorrected(1000, 100);
+    REQUIRE(histogram.count() == 10);
+    REQUIRE(histogram.min() == 100);
+    REQUIRE(histogram.max() == 1000);
+}
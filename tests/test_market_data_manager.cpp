@@ -0,0 +1,203 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_data_manager.h"
+
+#include <map>
+#include <random>
+
+using namespace CppTrader::Matching;
+
+namespace {
+
+class MyMarketDataHandler : public MarketDataHandler
+{
+public:
+    MyMarketDataHandler()
+        : _orders(0),
+          _levels(0),
+          _top_updates(0),
+          _executed(0)
+    {}
+
+    size_t orders() const { return _orders; }
+    size_t levels() const { return _levels; }
+    size_t top_updates() const { return _top_updates; }
+    uint64_t executed() const { return _executed; }
+
+protected:
+    void onUpdateOrderBook(const MarketDataBook& order_book, bool top) override { if (top) ++_top_updates; }
+    void onAddLevel(const MarketDataBook& order_book, const MarketDataLevel& level, bool top) override { ++_levels; }
+    void onDeleteLevel(const MarketDataBook& order_book, const MarketDataLevel& level, bool top) override { --_levels; }
+    void onAddOrder(const MarketDataOrder& order) override { ++_orders; }
+    void onDeleteOrder(const MarketDataOrder& order) override { --_orders; }
+    void onExecuteOrder(const MarketDataOrder& order, uint64_t price, uint64_t quantity) override { _executed += quantity; }
+
+private:
+    size_t _orders;
+    size_t _levels;
+    size_t _top_updates;
+    uint64_t _executed;
+};
+
+} // namespace
+
+TEST_CASE("Market data manager", "[CppTrader][Matching]")
+{
+    MyMarketDataHandler market_handler;
+    MarketDataManager market(market_handler);
+
+    const char name[8] = "TEST";
+    Symbol symbol(1, name);
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::ORDER_BOOK_DUPLICATE);
+    REQUIRE(market.AddOrder(1, 2, OrderSide::BUY, 100, 10) == ErrorCode::ORDER_BOOK_NOT_FOUND);
+
+    REQUIRE(market.AddOrder(1, 1, OrderSide::BUY, 100, 10) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(2, 1, OrderSide::BUY, 101, 20) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(3, 1, OrderSide::BUY, 100, 30) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(4, 1, OrderSide::SELL, 103, 40) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(5, 1, OrderSide::SELL, 102, 50) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(5, 1, OrderSide::SELL, 102, 50) == ErrorCode::ORDER_DUPLICATE);
+
+    const MarketDataBook* order_book = market.GetOrderBook(1);
+    REQUIRE(order_book != nullptr);
+    REQUIRE(order_book->bids().size() == 2);
+    REQUIRE(order_book->asks().size() == 2);
+    REQUIRE(order_book->best_bid()->Price == 101);
+    REQUIRE(order_book->best_ask()->Price == 102);
+    REQUIRE(order_book->level(order_book->bids().front()).Volume == 40);
+    REQUIRE(order_book->level(order_book->bids().front()).Orders == 2);
+    REQUIRE(market_handler.levels() == 4);
+
+    // Partial execution keeps the order and the level
+    REQUIRE(market.ExecuteOrder(2, 5) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(2)->Quantity == 15);
+    REQUIRE(order_book->best_bid()->Volume == 15);
+
+    // Full execution deletes the best bid level
+    REQUIRE(market.ExecuteOrder(2, 101, 100) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(2) == nullptr);
+    REQUIRE(market_handler.executed() == 20);
+    REQUIRE(order_book->best_bid()->Price == 100);
+
+    // Replace moves the order into a new level
+    REQUIRE(market.ReplaceOrder(5, 6, 104, 5) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(5) == nullptr);
+    REQUIRE(market.GetOrder(6)->Side == OrderSide::SELL);
+    REQUIRE(order_book->best_ask()->Price == 103);
+    REQUIRE(order_book->asks().size() == 2);
+
+    // Modify, reduce and delete
+    REQUIRE(market.ModifyOrder(1, 99, 10) == ErrorCode::OK);
+    REQUIRE(order_book->bids().size() == 2);
+    REQUIRE(market.ReduceOrder(3, 10) == ErrorCode::OK);
+    REQUIRE(order_book->best_bid()->Volume == 20);
+    REQUIRE(market.DeleteOrder(3) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(3) == ErrorCode::ORDER_NOT_FOUND);
+    REQUIRE(order_book->best_bid()->Price == 99);
+
+    REQUIRE(market_handler.orders() == 3);
+    REQUIRE(market_handler.levels() == 3);
+
+    // Delete the order book with all its orders
+    REQUIRE(market.DeleteOrderBook(1) == ErrorCode::OK);
+    REQUIRE(market.GetOrderBook(1) == nullptr);
+    REQUIRE(market.GetOrder(1) == nullptr);
+    REQUIRE(market.levels().allocated() == 0);
+    REQUIRE(market.DeleteSymbol(1) == ErrorCode::OK);
+    REQUIRE(market.GetSymbol(1) == nullptr);
+}
+
+TEST_CASE("Market data manager random order flow", "[CppTrader][Matching]")
+{
+    MyMarketDataHandler market_handler;
+    MarketDataManager market(market_handler);
+    const char name[8] = "TEST";
+    market.AddOrderBook(Symbol(0, name));
+
+    // Reference book: price -> volume for each side
+    std::map<uint32_t, uint64_t> bids;
+    std::map<uint32_t, uint64_t> asks;
+    std::map<uint64_t, MarketDataOrder> orders;
+
+    std::mt19937 generator(42);
+    uint64_t next_id = 1;
+    for (int i = 0; i < 20000; ++i)
+    {
+        int action = (int)(generator() % 4);
+        if (orders.empty() || (action == 0))
+        {
+            OrderSide side = (generator() % 2) ? OrderSide::BUY : OrderSide::SELL;
+            uint32_t price = 1000 + (uint32_t)(generator() % 50);
+            uint32_t quantity = 1 + (uint32_t)(generator() % 100);
+            REQUIRE(market.AddOrder(next_id, 0, side, price, quantity) == ErrorCode::OK);
+            orders[next_id] = MarketDataOrder{ next_id, 0, price, quantity, 0, side };
+            ((side == OrderSide::BUY) ? bids : asks)[price] += quantity;
+            ++next_id;
+        }
+        else
+        {
+            auto it = orders.begin();
+            std::advance(it, generator() % orders.size());
+            MarketDataOrder& order = it->second;
+            auto& levels = (order.Side == OrderSide::BUY) ? bids : asks;
+            uint32_t quantity = 1 + (uint32_t)(generator() % 100);
+            if (action == 1)
+            {
+                REQUIRE(market.ExecuteOrder(order.Id, quantity) == ErrorCode::OK);
+                quantity = std::min(quantity, order.Quantity);
+                levels[order.Price] -= quantity;
+                order.Quantity -= quantity;
+            }
+            else if (action == 2)
+            {
+                REQUIRE(market.DeleteOrder(order.Id) == ErrorCode::OK);
+                levels[order.Price] -= order.Quantity;
+                order.Quantity = 0;
+            }
+            else
+            {
+                uint32_t price = 1000 + (uint32_t)(generator() % 50);
+                REQUIRE(market.ReplaceOrder(order.Id, next_id, price, quantity) == ErrorCode::OK);
+                levels[order.Price] -= order.Quantity;
+                if (levels[order.Price] == 0)
+                    levels.erase(order.Price);
+                levels[price] += quantity;
+                orders[next_id] = MarketDataOrder{ next_id, 0, price, quantity, 0, order.Side };
+                orders.erase(it);
+                ++next_id;
+                continue;
+            }
+            if (levels[order.Price] == 0)
+                levels.erase(order.Price);
+            if (order.Quantity == 0)
+                orders.erase(it);
+        }
+    }
+
+    // Compare the market data book with the reference book
+    const MarketDataBook* order_book = market.GetOrderBook(0);
+    REQUIRE(order_book->bids().size() == bids.size());
+    REQUIRE(order_book->asks().size() == asks.size());
+    auto bid = bids.begin();
+    for (const auto& price_level : order_book->bids())
+    {
+        REQUIRE(price_level.Price == bid->first);
+        REQUIRE(order_book->level(price_level).Volume == bid->second);
+        ++bid;
+    }
+    auto ask = asks.rbegin();
+    for (const auto& price_level : order_book->asks())
+    {
+        REQUIRE(price_level.Price == ask->first);
+        REQUIRE(order_book->level(price_level).Volume == ask->second);
+        ++ask;
+    }
+    REQUIRE(market_handler.orders() == orders.size());
+    REQUIRE(market.levels().allocated() == (bids.size() + asks.size()));
+}
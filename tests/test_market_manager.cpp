@@ -161,3 +161,52 @@ TEST_CASE("Market manager", "[CppTrader][Matching]")
     REQUIRE(market_handler.delete_orders() == 58915);
     REQUIRE(market_handler.execute_orders() == 2435);
 }
+
+TEST_CASE("Market manager orders restore", "[CppTrader][Matching]")
+{
+    char name[8] = "TEST";
+    Symbol symbol(0, name);
+
+    MarketManager market;
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+    market.EnableMatching();
+
+    // Trade sets the last prices followed by trailing stop orders
+    REQUIRE(market.AddOrder(Order::BuyLimit(1, 0, 100, 10)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::SellLimit(2, 0, 100, 4)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::SellLimit(3, 0, 120, 10)) == ErrorCode::OK);
+    REQUIRE(market.GetOrderBook(0)->best_bid()->TotalVolume == 6);
+
+    // Invalid order fails the whole batch
+    std::vector<Order> orders = { Order::BuyLimit(20, 0, 90, 1), Order::BuyLimit(21, 9, 90, 1) };
+    REQUIRE(market.RestoreOrders(orders.data(), orders.size()) == ErrorCode::ORDER_BOOK_NOT_FOUND);
+    REQUIRE(market.GetOrder(20) == nullptr);
+    orders = { Order::BuyLimit(22, 0, 90, 1), Order::BuyLimit(22, 0, 91, 1) };
+    REQUIRE(market.RestoreOrders(orders.data(), orders.size()) == ErrorCode::ORDER_DUPLICATE);
+    REQUIRE(market.GetOrder(22) == nullptr);
+    orders = { Order::BuyLimit(23, 0, 90, 1), Order::BuyLimit(3, 0, 91, 1) };
+    REQUIRE(market.RestoreOrders(orders.data(), orders.size()) == ErrorCode::ORDER_DUPLICATE);
+    REQUIRE(market.GetOrder(23) == nullptr);
+    REQUIRE(market.orders().size() == 2);
+
+    // Persisted trailing stop price is recalculated and triggered stop orders are activated
+    orders = { Order::TrailingStop(10, 0, OrderSide::SELL, 50, 2, 5), Order::BuyStop(11, 0, 120, 2), Order::BuyLimit(12, 0, 90, 1) };
+    REQUIRE(market.RestoreOrders(orders.data(), orders.size()) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(10)->StopPrice == 95);
+    REQUIRE(market.GetOrder(11) == nullptr);
+    REQUIRE(market.GetOrder(12) != nullptr);
+    REQUIRE(market.GetOrderBook(0)->best_ask()->TotalVolume == 8);
+
+    // Without matching triggered stop orders are activated by enabling it
+    MarketManager restored;
+    REQUIRE(restored.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(restored.AddOrderBook(symbol) == ErrorCode::OK);
+    orders = { Order::SellLimit(1, 0, 100, 10), Order::BuyStop(2, 0, 100, 3) };
+    REQUIRE(restored.RestoreOrders(orders.data(), orders.size()) == ErrorCode::OK);
+    REQUIRE(restored.GetOrder(2) != nullptr);
+    REQUIRE(restored.GetOrderBook(0)->best_buy_stop()->Price == 100);
+    restored.EnableMatching();
+    REQUIRE(restored.GetOrder(2) == nullptr);
+    REQUIRE(restored.GetOrderBook(0)->best_ask()->TotalVolume == 7);
+}
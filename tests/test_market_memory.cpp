@@ -0,0 +1,74 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <sstream>
+
+using namespace CppTrader::Matching;
+
+TEST_CASE("Market manager memory statistics", "[CppTrader][Matching]")
+{
+    MarketManager market;
+
+    MarketMemoryStats stats = market.GetMemoryStats();
+    REQUIRE(stats.used() == 0);
+    REQUIRE(stats.OrdersSize == 0);
+    REQUIRE(stats.OrderBooks.empty());
+
+    Symbol symbol1(0, "TEST1");
+    Symbol symbol2(1, "TEST2");
+    market.AddSymbol(symbol1);
+    market.AddSymbol(symbol2);
+    market.AddOrderBook(symbol1);
+    market.AddOrderBook(symbol2);
+
+    // Two bid levels with three orders and one ask level in the first book
+    market.AddOrder(Order::BuyLimit(1, 0, 10, 10));
+    market.AddOrder(Order::BuyLimit(2, 0, 10, 10));
+    market.AddOrder(Order::BuyLimit(3, 0, 9, 10));
+    market.AddOrder(Order::SellLimit(4, 0, 20, 10));
+    // One stop level in the second book
+    market.AddOrder(Order::BuyStop(5, 1, 30, 10));
+
+    stats = market.GetMemoryStats();
+    REQUIRE(stats.SymbolPool.Items == 2);
+    REQUIRE(stats.SymbolPool.Used == 2 * sizeof(Symbol));
+    REQUIRE(stats.OrderBookPool.Items == 2);
+    REQUIRE(stats.OrderPool.Items == 5);
+    REQUIRE(stats.OrderPool.Used == 5 * stats.OrderPool.ItemSize);
+    REQUIRE(stats.OrderPool.Reserved >= stats.OrderPool.Used);
+    REQUIRE(stats.LevelPool.Items == 4);
+    REQUIRE(stats.OrdersSize == 5);
+    REQUIRE(stats.OrdersCapacity >= stats.OrdersSize);
+    REQUIRE(stats.OrdersLoadFactor > 0.0);
+    REQUIRE(stats.reserved() >= stats.used());
+
+    REQUIRE(stats.OrderBooks.size() == 2);
+    REQUIRE(stats.OrderBooks[0].SymbolId == 0);
+    REQUIRE(stats.OrderBooks[0].BidLevels == 2);
+    REQUIRE(stats.OrderBooks[0].AskLevels == 1);
+    REQUIRE(stats.OrderBooks[0].StopLevels == 0);
+    REQUIRE(stats.OrderBooks[0].Orders == 4);
+    REQUIRE(stats.OrderBooks[1].StopLevels == 1);
+    REQUIRE(stats.OrderBooks[1].Orders == 1);
+
+    // Pool pages are kept after orders are deleted
+    size_t reserved = stats.OrderPool.Reserved;
+    for (uint64_t id = 1; id <= 5; ++id)
+        market.DeleteOrder(id);
+
+    stats = market.GetMemoryStats();
+    REQUIRE(stats.OrderPool.Items == 0);
+    REQUIRE(stats.OrderPool.Used == 0);
+    REQUIRE(stats.OrderPool.Reserved == reserved);
+    REQUIRE(stats.LevelPool.Items == 0);
+    REQUIRE(stats.OrderBooks[0].Orders == 0);
+
+    std::stringstream stream;
+    stream << stats;
+    REQUIRE(stream.str().find("MarketMemoryStats(") == 0);
+}
@@ -0,0 +1,155 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_scenario.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace CppTrader::Matching;
+
+TEST_CASE("Market scenario parsing", "[CppTrader][Matching]")
+{
+    const char text[] =
+        "# Comment\r\n"
+        "enable matching\n"
+        "add symbol 0 EURUSD\n"
+        "add book 0\n"
+        "\n"
+        "add limit buy 1 0 10 20\n"
+        "add ioc limit sell 2 0 10 5\n"
+        "add slippage market sell 3 0 1000 10\n"
+        "add stop sell 4 0 5 10\n"
+        "add stop-limit buy 5 0 30 31 10\n"
+        "add trailing stop sell 6 0 0 100 -10 5\n"
+        "add trailing stop-limit buy 7 0 40 41 10 10 0\n"
+        "  reduce  order 1 5\n"
+        "modify order 1 11 12\n"
+        "mitigate order 1 11 10\n"
+        "replace order 1 8 12 10\n"
+        "delete order 8\n"
+        "match\n"
+        "disable matching\n"
+        "delete book 0\n"
+        "delete symbol 0";
+
+    MarketScenario scenario;
+    REQUIRE(scenario.Parse(text, sizeof(text) - 1));
+    REQUIRE(scenario.lines() == 21);
+    REQUIRE(scenario.error_line() == 0);
+
+    const auto& commands = scenario.commands();
+    REQUIRE(commands.size() == 19);
+    REQUIRE(commands[0].Type == ScenarioCommandType::ENABLE_MATCHING);
+    REQUIRE(commands[1].Type == ScenarioCommandType::ADD_SYMBOL);
+    REQUIRE(commands[1].Symbol.Id == 0);
+    REQUIRE(std::string(commands[1].Symbol.Name, 6) == "EURUSD");
+    REQUIRE(commands[2].Type == ScenarioCommandType::ADD_BOOK);
+    REQUIRE(commands[3].Order.IsLimit());
+    REQUIRE(commands[3].Order.IsBuy());
+    REQUIRE(commands[3].Order.Price == 10);
+    REQUIRE(commands[3].Order.Quantity == 20);
+    REQUIRE(commands[4].Order.IsIOC());
+    REQUIRE(commands[5].Order.IsMarket());
+    REQUIRE(commands[5].Order.Slippage == 10);
+    REQUIRE(commands[6].Order.IsStop());
+    REQUIRE(commands[6].Order.StopPrice == 5);
+    REQUIRE(commands[7].Order.IsStopLimit());
+    REQUIRE(commands[7].Order.Price == 31);
+    REQUIRE(commands[8].Order.IsTrailingStop());
+    REQUIRE(commands[8].Order.TrailingDistance == -10);
+    REQUIRE(commands[8].Order.TrailingStep == 5);
+    REQUIRE(commands[9].Order.IsTrailingStopLimit());
+    REQUIRE(commands[10].Type == ScenarioCommandType::REDUCE_ORDER);
+    REQUIRE(commands[10].Order.Quantity == 5);
+    REQUIRE(commands[11].Type == ScenarioCommandType::MODIFY_ORDER);
+    REQUIRE(commands[12].Type == ScenarioCommandType::MITIGATE_ORDER);
+    REQUIRE(commands[13].Type == ScenarioCommandType::REPLACE_ORDER);
+    REQUIRE(commands[13].NewId == 8);
+    REQUIRE(commands[14].Type == ScenarioCommandType::DELETE_ORDER);
+    REQUIRE(commands[15].Type == ScenarioCommandType::MATCH);
+    REQUIRE(commands[16].Type == ScenarioCommandType::DISABLE_MATCHING);
+    REQUIRE(commands[17].Type == ScenarioCommandType::DELETE_BOOK);
+    REQUIRE(commands[18].Type == ScenarioCommandType::DELETE_SYMBOL);
+
+    // Malformed lines
+    const char* malformed[] =
+    {
+        "show books",
+        "add limit left 1 0 10 10",
+        "add limit buy 1 0 10",
+        "add limit buy 1 0 10 10 10",
+        "add limit buy 1 0 -10 10",
+        "add limit buy 1 0 99999999999999999999 10",
+        "add ioc stop buy 1 0 10 10",
+        "add trailing stop buy 1 0 10 10 x 0",
+        "add symbol 0",
+        "replace order 1 2 3",
+    };
+    for (const char* line : malformed)
+    {
+        scenario.Clear();
+        REQUIRE(!scenario.Parse(std::string("add symbol 0 TEST\n") + line));
+        REQUIRE(scenario.error_line() == 2);
+        REQUIRE(!scenario.error().empty());
+        REQUIRE(scenario.commands().size() == 1);
+    }
+}
+
+TEST_CASE("Market scenario replay", "[CppTrader][Matching]")
+{
+    MarketScenario scenario;
+    REQUIRE(scenario.Parse(
+        "enable matching\n"
+        "add symbol 0 EURUSD\n"
+        "add book 0\n"
+        "add limit buy 1 0 10 10\n"
+        "add limit buy 2 0 10 10\n"
+        "add limit sell 3 0 10 15\n"
+        "reduce order 2 2\n"
+        "delete order 1\n"
+        "add limit sell 4 0 20 10\n"
+        "replace order 4 5 21 10\n"));
+
+    // Replay the same scenario several times into fresh market managers
+    for (size_t i = 0; i < 3; ++i)
+    {
+        MarketManager market;
+        REQUIRE(scenario.Replay(market) == 1);
+
+        // Order #1 was filled by the aggressive limit order, so its delete fails
+        REQUIRE(market.GetOrder(1) == nullptr);
+        REQUIRE(market.GetOrder(2) != nullptr);
+        REQUIRE(market.GetOrder(2)->LeavesQuantity == 3);
+        REQUIRE(market.GetOrder(4) == nullptr);
+        REQUIRE(market.GetOrder(5) != nullptr);
+        REQUIRE(market.GetOrder(5)->Price == 21);
+    }
+}
+
+TEST_CASE("Market scenario files", "[CppTrader][Matching]")
+{
+    // Parse and replay all scenario files which are available
+    for (int i = 1; i <= 14; ++i)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "scenario-%02d.txt", i);
+
+        for (std::string directory : { "../../tools/matching/", "../tools/matching/", "tools/matching/" })
+        {
+            if (!std::ifstream(directory + name))
+                continue;
+
+            MarketScenario scenario;
+            REQUIRE(scenario.Load(directory + name));
+            REQUIRE(!scenario.commands().empty());
+
+            MarketManager market;
+            scenario.Replay(market);
+            break;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <sstream>
+
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+TEST_CASE("TSC clock", "[CppTrader][Statistics]")
+{
+    REQUIRE(TscClock::nanoseconds_per_tick() > 0.0);
+
+    uint64_t start = TscClock::ticks();
+    uint64_t stop = TscClock::ticks();
+    REQUIRE(stop >= start);
+}
+
+TEST_CASE("Market statistics", "[CppTrader][Statistics]")
+{
+    MarketStatistics statistics;
+
+    for (uint64_t i = 1; i <= 1000; ++i)
+        statistics.Record(MarketOperation::ADD_LIMIT, i);
+    statistics.Record(MarketOperation::CANCEL, 100);
+
+    MarketOperationSummary summary = statistics.Summary(MarketOperation::ADD_LIMIT);
+    REQUIRE(summary.Count == 1000);
+    REQUIRE(summary.P50 <= summary.P99);
+    REQUIRE(summary.P99 <= summary.P999);
+    REQUIRE(summary.P999 <= summary.Max);
+    REQUIRE(statistics.histogram(MarketOperation::ADD_LIMIT).max() == 1000);
+    REQUIRE(statistics.Summary(MarketOperation::MATCH).Count == 0);
+
+    std::stringstream stream;
+    statistics.Dump(stream);
+    REQUIRE(stream.str().find("ADD_LIMIT") != std::string::npos);
+    REQUIRE(stream.str().find("CANCEL") != std::string::npos);
+    REQUIRE(stream.str().find("MATCH") == std::string::npos);
+
+    statistics.Reset();
+    REQUIRE(statistics.histogram(MarketOperation::ADD_LIMIT).empty());
+
+#if defined(CPPTRADER_STATISTICS)
+    MarketManager market;
+    const char name[8] = "TEST";
+    Symbol symbol(0, name);
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+    market.EnableMatching();
+    market.AddOrder(Order::BuyLimit(1, 0, 10, 10));
+    market.AddOrder(Order::SellLimit(2, 0, 10, 5));
+    market.DeleteOrder(1);
+
+    REQUIRE(market.statistics().histogram(MarketOperation::ADD_LIMIT).count() == 2);
+    REQUIRE(market.statistics().histogram(MarketOperation::CANCEL).count() == 1);
+    REQUIRE(market.statistics().histogram(MarketOperation::MATCH).count() >= 2);
+    REQUIRE(market.statistics().histogram(MarketOperation::MATCH_ORDER).count() == 2);
+#endif
+}
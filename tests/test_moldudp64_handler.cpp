@@ -0,0 +1,293 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/providers/nasdaq/moldudp64_handler.h"
+#include "trader/providers/nasdaq/soupbintcp_handler.h"
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+
+namespace {
+
+class MyITCHHandler : public ITCHHandler
+{
+public:
+    MyITCHHandler() : _messages(0), _errors(0) {}
+
+    size_t messages() const { return _messages; }
+    size_t errors() const { return _errors; }
+
+protected:
+    bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const UnknownMessage& message) override { ++_errors; return true; }
+
+private:
+    size_t _messages;
+    size_t _errors;
+};
+
+class MyMoldUDP64Handler : public MoldUDP64Handler
+{
+public:
+    using MoldUDP64Handler::MoldUDP64Handler;
+
+    uint64_t timestamp() const { return _timestamp; }
+
+protected:
+    bool onCapturePacket(const CapturePacket& packet) override { _timestamp = packet.Timestamp; return true; }
+
+private:
+    uint64_t _timestamp{0};
+};
+
+void Append16(std::vector<uint8_t>& buffer, uint16_t value)
+{
+    buffer.push_back((uint8_t)(value >> 8));
+    buffer.push_back((uint8_t)value);
+}
+
+void Append32LE(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        buffer.push_back((uint8_t)(value >> (8 * i)));
+}
+
+void Append64(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    for (int i = 7; i >= 0; --i)
+        buffer.push_back((uint8_t)(value >> (8 * i)));
+}
+
+// Prepare Ethernet/IPv4/UDP frame with MoldUDP64 packet of system event messages
+std::vector<uint8_t> MoldFrame(uint64_t sequence, uint16_t count, uint16_t port = 26400)
+{
+    std::vector<uint8_t> mold = { 'S', 'E', 'S', 'S', 'I', 'O', 'N', '0', '0', '1' };
+    Append64(mold, sequence);
+    Append16(mold, count);
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        Append16(mold, 12);
+        std::vector<uint8_t> message = { 'S', 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 'O' };
+        mold.insert(mold.end(), message.begin(), message.end());
+    }
+
+    std::vector<uint8_t> frame(12, 0);
+    Append16(frame, 0x0800);
+    frame.push_back(0x45);
+    frame.push_back(0);
+    Append16(frame, (uint16_t)(20 + 8 + mold.size()));
+    Append32LE(frame, 0);
+    frame.push_back(64);
+    frame.push_back(17);
+    Append16(frame, 0);
+    Append32LE(frame, 0);
+    Append32LE(frame, 0);
+    Append16(frame, 10000);
+    Append16(frame, port);
+    Append16(frame, (uint16_t)(8 + mold.size()));
+    Append16(frame, 0);
+    frame.insert(frame.end(), mold.begin(), mold.end());
+    return frame;
+}
+
+std::vector<uint8_t> PcapCapture(const std::vector<std::vector<uint8_t>>& frames)
+{
+    std::vector<uint8_t> capture;
+    Append32LE(capture, 0xA1B2C3D4);
+    Append32LE(capture, 0x00040002);
+    Append32LE(capture, 0);
+    Append32LE(capture, 0);
+    Append32LE(capture, 65535);
+    Append32LE(capture, 1);
+    for (const auto& frame : frames)
+    {
+        Append32LE(capture, 1);
+        Append32LE(capture, 500);
+        Append32LE(capture, (uint32_t)frame.size());
+        Append32LE(capture, (uint32_t)frame.size());
+        capture.insert(capture.end(), frame.begin(), frame.end());
+    }
+    return capture;
+}
+
+std::vector<uint8_t> PcapngCapture(const std::vector<std::vector<uint8_t>>& frames)
+{
+    std::vector<uint8_t> capture;
+
+    // Section header block
+    Append32LE(capture, 0x0A0D0D0A);
+    Append32LE(capture, 28);
+    Append32LE(capture, 0x1A2B3C4D);
+    Append32LE(capture, 0x00000001);
+    Append32LE(capture, 0xFFFFFFFF);
+    Append32LE(capture, 0xFFFFFFFF);
+    Append32LE(capture, 28);
+
+    // Interface description block with nanosecond resolution
+    Append32LE(capture, 0x00000001);
+    Append32LE(capture, 32);
+    Append32LE(capture, 0x00000001);
+    Append32LE(capture, 65535);
+    Append32LE(capture, 0x00010009);
+    Append32LE(capture, 0x00000009);
+    Append32LE(capture, 0);
+    Append32LE(capture, 32);
+
+    // Enhanced packet blocks
+    for (const auto& frame : frames)
+    {
+        uint32_t padded = (uint32_t)((frame.size() + 3) & ~3);
+        Append32LE(capture, 0x00000006);
+        Append32LE(capture, 32 + padded);
+        Append32LE(capture, 0);
+        Append32LE(capture, 0);
+        Append32LE(capture, 1000);
+        Append32LE(capture, (uint32_t)frame.size());
+        Append32LE(capture, (uint32_t)frame.size());
+        capture.insert(capture.end(), frame.begin(), frame.end());
+        capture.insert(capture.end(), padded - frame.size(), 0);
+        Append32LE(capture, 32 + padded);
+    }
+
+    return capture;
+}
+
+} // namespace
+
+TEST_CASE("MoldUDP64Handler", "[CppTrader][Providers][NASDAQ]")
+{
+    // Sequence 3..4 is lost, sequence 5..6 is duplicated
+    std::vector<std::vector<uint8_t>> frames = { MoldFrame(1, 2), MoldFrame(5, 2), MoldFrame(5, 3), MoldFrame(8, 0), MoldFrame(8, 1, 1234) };
+
+    SECTION("pcap")
+    {
+        MyITCHHandler itch_handler;
+        MoldUDP64Handler mold_handler(itch_handler, 26400);
+
+        std::vector<uint8_t> capture = PcapCapture(frames);
+        REQUIRE(mold_handler.Process(capture.data(), capture.size()));
+
+        REQUIRE(itch_handler.errors() == 0);
+        REQUIRE(itch_handler.messages() == 5);
+        REQUIRE(mold_handler.packets() == 4);
+        REQUIRE(mold_handler.messages() == 5);
+        REQUIRE(mold_handler.gaps() == 1);
+        REQUIRE(mold_handler.lost() == 2);
+        REQUIRE(mold_handler.duplicates() == 2);
+        REQUIRE(mold_handler.skipped() == 1);
+        REQUIRE(mold_handler.GetNextSequence({ 'S', 'E', 'S', 'S', 'I', 'O', 'N', '0', '0', '1' }) == 8);
+    }
+
+    SECTION("pcapng split into single bytes")
+    {
+        MyITCHHandler itch_handler;
+        MoldUDP64Handler mold_handler(itch_handler);
+
+        std::vector<uint8_t> capture = PcapngCapture(frames);
+        for (auto& byte : capture)
+            REQUIRE(mold_handler.Process(&byte, 1));
+
+        REQUIRE(itch_handler.messages() == 6);
+        REQUIRE(mold_handler.packets() == 5);
+        REQUIRE(mold_handler.gaps() == 1);
+        REQUIRE(mold_handler.duplicates() == 2);
+    }
+
+    SECTION("corrupted record lengths")
+    {
+        MyITCHHandler itch_handler;
+        MoldUDP64Handler mold_handler(itch_handler);
+
+        // pcap record longer than the snapshot length of the file
+        std::vector<uint8_t> capture = PcapCapture({ MoldFrame(1, 1) });
+        capture[24 + 8] = 0xFF;
+        capture[24 + 9] = 0xFF;
+        capture[24 + 10] = 0xFF;
+        capture[24 + 11] = 0xFF;
+        REQUIRE(!mold_handler.Process(capture.data(), 24 + 16));
+
+        // pcapng block of gigabytes
+        mold_handler.Reset();
+        capture = PcapngCapture({});
+        size_t size = capture.size();
+        Append32LE(capture, 6);
+        Append32LE(capture, 0xF0000000);
+        Append32LE(capture, 0);
+        REQUIRE(!mold_handler.Process(capture.data(), size + 12));
+    }
+
+    SECTION("foreign datagrams")
+    {
+        MyITCHHandler itch_handler;
+        MoldUDP64Handler mold_handler(itch_handler);
+
+        // UDP payload shorter than the MoldUDP64 header
+        std::vector<uint8_t> frame = MoldFrame(1, 0);
+        frame.resize(14 + 20 + 8 + 4);
+        frame[17] = 20 + 8 + 4;
+        frame[39] = 8 + 4;
+
+        std::vector<uint8_t> capture = PcapCapture({ frame, MoldFrame(1, 1) });
+        REQUIRE(mold_handler.Process(capture.data(), capture.size()));
+        REQUIRE(itch_handler.messages() == 1);
+        REQUIRE(mold_handler.packets() == 1);
+        REQUIRE(mold_handler.skipped() == 1);
+    }
+
+    SECTION("pcapng timestamp resolution")
+    {
+        MyITCHHandler itch_handler;
+        MyMoldUDP64Handler mold_handler(itch_handler);
+
+        // Nanosecond resolution of the interface
+        std::vector<uint8_t> capture = PcapngCapture({ MoldFrame(1, 1) });
+        REQUIRE(mold_handler.Process(capture.data(), capture.size()));
+        REQUIRE(mold_handler.timestamp() == 1000);
+
+        // Exponents out of 64 bits fall back to the microsecond resolution
+        for (uint8_t exponent : { (uint8_t)20, (uint8_t)0xFF, (uint8_t)(0x80 | 64) })
+        {
+            mold_handler.Reset();
+            capture[28 + 20] = exponent;
+            REQUIRE(mold_handler.Process(capture.data(), capture.size()));
+            REQUIRE(mold_handler.timestamp() == 1000000);
+        }
+
+        // Binary exponent of the interface
+        mold_handler.Reset();
+        capture[28 + 20] = 0x80 | 10;
+        REQUIRE(mold_handler.Process(capture.data(), capture.size()));
+        REQUIRE(mold_handler.timestamp() == 1000 * 1000000000ull / 1024);
+    }
+}
+
+TEST_CASE("SoupBinTCPHandler", "[CppTrader][Providers][NASDAQ]")
+{
+    MyITCHHandler itch_handler;
+    SoupBinTCPHandler soup_handler(itch_handler);
+
+    std::vector<uint8_t> stream;
+    std::string login = "ASESSION001                   1";
+    Append16(stream, (uint16_t)login.size());
+    stream.insert(stream.end(), login.begin(), login.end());
+    for (int i = 0; i < 3; ++i)
+    {
+        Append16(stream, 13);
+        std::vector<uint8_t> packet = { 'S', 'S', 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 'O' };
+        stream.insert(stream.end(), packet.begin(), packet.end());
+    }
+    Append16(stream, 1);
+    stream.push_back('H');
+    login = "ASESSION001                  10";
+    Append16(stream, (uint16_t)login.size());
+    stream.insert(stream.end(), login.begin(), login.end());
+
+    REQUIRE(soup_handler.Process(stream.data(), stream.size()));
+    REQUIRE(itch_handler.messages() == 3);
+    REQUIRE(soup_handler.messages() == 3);
+    REQUIRE(soup_handler.gaps() == 1);
+    REQUIRE(soup_handler.sequence() == 10);
+}
@@ -0,0 +1,219 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/generator/order_flow.h"
+
+using namespace CppTrader::Generator;
+using namespace CppTrader::Matching;
+
+TEST_CASE("Order flow generator reproducibility", "[CppTrader][Generator]")
+{
+    OrderFlowSettings settings;
+    settings.Seed = 42;
+    settings.Symbols = 4;
+    settings.Accounts = 10;
+    settings.Volatility = 1.0;
+
+    OrderFlowGenerator generator1(settings);
+    OrderFlowGenerator generator2(settings);
+
+    std::vector<OrderFlowCommand> commands1;
+    std::vector<OrderFlowCommand> commands2;
+    generator1.Generate(10000, commands1);
+    generator2.Generate(10000, commands2);
+    REQUIRE(generator1.commands() == 10000);
+    REQUIRE(commands1.size() == commands2.size());
+
+    for (size_t i = 0; i < commands1.size(); ++i)
+    {
+        REQUIRE(commands1[i].Type == commands2[i].Type);
+        REQUIRE(commands1[i].Order.Id == commands2[i].Order.Id);
+        REQUIRE(commands1[i].Order.Type == commands2[i].Order.Type);
+        REQUIRE(commands1[i].Order.Price == commands2[i].Order.Price);
+        REQUIRE(commands1[i].Order.Quantity == commands2[i].Order.Quantity);
+    }
+
+    // Reset restarts the same stream
+    generator1.Reset();
+    OrderFlowCommand command = generator1.Next();
+    REQUIRE(command.Order.Id == commands1[0].Order.Id);
+    REQUIRE(command.Order.Price == commands1[0].Order.Price);
+
+    // Another seed gives another stream
+    settings.Seed = 43;
+    OrderFlowGenerator generator3(settings);
+    std::vector<OrderFlowCommand> commands3;
+    generator3.Generate(10000, commands3);
+    size_t different = 0;
+    for (size_t i = 0; i < commands1.size(); ++i)
+        if (commands1[i].Order.Price != commands3[i].Order.Price)
+            ++different;
+    REQUIRE(different > 0);
+}
+
+TEST_CASE("Order flow generator mix", "[CppTrader][Generator]")
+{
+    OrderFlowSettings settings;
+    settings.Seed = 7;
+    settings.Symbols = 3;
+    settings.Accounts = 5;
+    settings.CancelRatio = 0.2;
+    settings.ModifyRatio = 0.1;
+    settings.Mix.TrailingStop = 0.02;
+    settings.Mix.TrailingStopLimit = 0.02;
+    settings.Mix.AON = 0.02;
+
+    OrderFlowGenerator generator(settings);
+    std::vector<OrderFlowCommand> commands;
+    generator.Generate(100000, commands);
+
+    size_t adds = 0, modifies = 0, cancels = 0, limits = 0, markets = 0, icebergs = 0;
+    for (const auto& command : commands)
+    {
+        switch (command.Type)
+        {
+            case OrderFlowCommandType::ADD:
+                ++adds;
+                REQUIRE(command.Order.Validate() == ErrorCode::OK);
+                REQUIRE(command.Order.SymbolId < settings.Symbols);
+                REQUIRE(command.Order.AccountId >= 1);
+                REQUIRE(command.Order.AccountId <= settings.Accounts);
+                REQUIRE(command.Order.Quantity >= settings.MinQuantity);
+                REQUIRE(command.Order.Quantity <= settings.MaxQuantity);
+                if (command.Order.Type == OrderType::LIMIT)
+                    ++limits;
+                if (command.Order.IsMarket())
+                    ++markets;
+                if (command.Order.IsIceberg())
+                    ++icebergs;
+                if (command.Order.IsStop() || command.Order.IsTrailingStop())
+                {
+                    if (command.Order.IsBuy())
+                        REQUIRE(command.Order.StopPrice > settings.MidPrice);
+                    else
+                        REQUIRE(command.Order.StopPrice < settings.MidPrice);
+                }
+                break;
+            case OrderFlowCommandType::MODIFY:
+                ++modifies;
+                break;
+            case OrderFlowCommandType::CANCEL:
+                ++cancels;
+                break;
+        }
+    }
+
+    REQUIRE(adds + modifies + cancels == commands.size());
+    REQUIRE((cancels > 18000 && cancels < 22000));
+    REQUIRE((modifies > 8000 && modifies < 12000));
+    REQUIRE((limits > adds * 74 / 100 && limits < adds * 84 / 100));
+    REQUIRE((markets > adds * 8 / 100 && markets < adds * 12 / 100));
+    REQUIRE(icebergs > 0);
+}
+
+TEST_CASE("Order flow generator distributions", "[CppTrader][Generator]")
+{
+    for (auto distribution : { PriceDistribution::UNIFORM, PriceDistribution::NORMAL, PriceDistribution::EXPONENTIAL })
+    {
+        OrderFlowSettings settings;
+        settings.Distribution = distribution;
+        settings.PriceScale = 20.0;
+        settings.Aggressive = 0.0;
+        settings.Mix = OrderMix();
+        settings.Mix.Market = settings.Mix.Stop = settings.Mix.StopLimit = 0.0;
+        settings.Mix.TrailingStop = settings.Mix.TrailingStopLimit = 0.0;
+        settings.CancelRatio = settings.ModifyRatio = 0.0;
+
+        OrderFlowGenerator generator(settings);
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            OrderFlowCommand command = generator.Next();
+            REQUIRE(command.Order.IsLimit());
+
+            // Passive orders never cross the mid price
+            if (command.Order.IsBuy())
+                REQUIRE(command.Order.Price < settings.MidPrice);
+            else
+                REQUIRE(command.Order.Price > settings.MidPrice);
+            if (distribution == PriceDistribution::UNIFORM)
+            {
+                uint64_t distance = command.Order.IsBuy() ? (settings.MidPrice - command.Order.Price) : (command.Order.Price - settings.MidPrice);
+                REQUIRE(distance <= 21);
+            }
+        }
+    }
+}
+
+TEST_CASE("Order flow generator symbols skew", "[CppTrader][Generator]")
+{
+    OrderFlowSettings settings;
+    settings.Seed = 11;
+    settings.Symbols = 100;
+    settings.CancelRatio = 0.0;
+    settings.ModifyRatio = 0.0;
+
+    // Uniform and Zipf activity of symbols
+    for (double skew : { 0.0, 1.0 })
+    {
+        settings.SymbolSkew = skew;
+        OrderFlowGenerator generator(settings);
+
+        std::vector<size_t> orders(settings.Symbols, 0);
+        for (size_t i = 0; i < 100000; ++i)
+        {
+            OrderFlowCommand command = generator.Next();
+            REQUIRE(command.Order.SymbolId < settings.Symbols);
+            ++orders[command.Order.SymbolId];
+        }
+
+        if (skew == 0.0)
+        {
+            REQUIRE(orders[0] < 2000);
+            REQUIRE(orders[99] > 500);
+        }
+        else
+        {
+            // Zipf law with 100 symbols gives about 19% of orders to the first one and 0.19% to the last one
+            REQUIRE(orders[0] > 15000);
+            REQUIRE(orders[0] > orders[1]);
+            REQUIRE(orders[1] > orders[10]);
+            REQUIRE(orders[99] < 500);
+        }
+    }
+}
+
+TEST_CASE("Order flow generator applied to the market manager", "[CppTrader][Generator]")
+{
+    OrderFlowSettings settings;
+    settings.Seed = 2026;
+    settings.Symbols = 8;
+    settings.Accounts = 100;
+    settings.Volatility = 2.0;
+
+    MarketHandler handler;
+    MarketManager market(handler);
+    market.EnableMatching();
+
+    OrderFlowGenerator generator(settings);
+    REQUIRE(generator.Initialize(market) == ErrorCode::OK);
+
+    std::vector<OrderFlowCommand> commands;
+    generator.Generate(50000, commands);
+
+    size_t ok = 0, missing = 0;
+    for (const auto& command : commands)
+    {
+        ErrorCode result = command.Apply(market);
+        REQUIRE(((result == ErrorCode::OK) || (result == ErrorCode::ORDER_NOT_FOUND)));
+        if (result == ErrorCode::OK)
+            ++ok;
+        else
+            ++missing;
+    }
+
+    REQUIRE(ok > missing);
+    REQUIRE(missing > 0);
+}
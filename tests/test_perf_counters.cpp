@@ -0,0 +1,115 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+#include "trader/statistics/perf_counters.h"
+
+#include <sstream>
+
+using namespace CppTrader::Matching;
+using namespace CppTrader::Statistics;
+
+TEST_CASE("Hardware performance counters", "[CppTrader][Statistics]")
+{
+    PerfCounters counters;
+    REQUIRE(!counters.opened());
+
+    PerfSample sample;
+    REQUIRE(!counters.Read(sample));
+
+    // Counters are not available on all platforms and virtual machines
+    if (counters.Open())
+    {
+        REQUIRE(counters.opened());
+
+        PerfSample start;
+        PerfSample stop;
+        REQUIRE(counters.Read(start));
+        volatile uint64_t sum = 0;
+        for (uint64_t i = 0; i < 100000; ++i)
+            sum = sum + i;
+        REQUIRE(counters.Read(stop));
+
+        for (size_t i = 0; i < PERF_COUNTERS; ++i)
+        {
+            if (counters.available((PerfCounter)i))
+                REQUIRE(stop.Values[i] >= start.Values[i]);
+            else
+                REQUIRE(stop.Values[i] == 0);
+        }
+        if (counters.available(PerfCounter::INSTRUCTIONS))
+            REQUIRE(stop[PerfCounter::INSTRUCTIONS] - start[PerfCounter::INSTRUCTIONS] >= 100000);
+
+        counters.Close();
+        REQUIRE(!counters.opened());
+    }
+}
+
+TEST_CASE("Hardware performance counters profile", "[CppTrader][Statistics]")
+{
+    PerfProfile profile({ "FIRST", "SECOND" });
+    REQUIRE(profile.regions() == 2);
+    REQUIRE(profile.name(1) == "SECOND");
+    REQUIRE(profile.enabled(0));
+
+    PerfSample start;
+    PerfSample stop;
+    stop.Values[(size_t)PerfCounter::CYCLES] = 200;
+    stop.Values[(size_t)PerfCounter::INSTRUCTIONS] = 300;
+    stop.Values[(size_t)PerfCounter::LLC_MISSES] = 4;
+    profile.Record(0, start, stop);
+    stop.Values[(size_t)PerfCounter::CYCLES] = 100;
+    profile.Record(0, start, stop);
+
+    REQUIRE(profile.count(0) == 2);
+    REQUIRE(profile.count(1) == 0);
+    REQUIRE(profile.total(0, PerfCounter::CYCLES) == 300);
+
+    PerfRegionSummary summary = profile.Summary(0);
+    REQUIRE(summary.Region == "FIRST");
+    REQUIRE(summary.Count == 2);
+    REQUIRE(summary.Values[(size_t)PerfCounter::CYCLES] == 150.0);
+    REQUIRE(summary.Values[(size_t)PerfCounter::LLC_MISSES] == 4.0);
+    REQUIRE(summary.IPC == 2.0);
+
+    std::stringstream stream;
+    profile.Dump(stream);
+    REQUIRE(stream.str().find("FIRST") != std::string::npos);
+    REQUIRE(stream.str().find("SECOND") == std::string::npos);
+
+    // Scopes do nothing until the profile is opened
+    {
+        PerfScope scope(profile, 1);
+    }
+    REQUIRE(profile.count(1) == 0);
+
+    // Disabled regions are not recorded
+    profile.EnableAll(false);
+    REQUIRE(!profile.enabled(0));
+    if (profile.Open())
+    {
+        {
+            PerfScope scope(profile, 1);
+        }
+        REQUIRE(profile.count(1) == 0);
+
+        profile.Enable(1);
+        {
+            PerfScope scope(profile, 1);
+        }
+        REQUIRE(profile.count(1) == 1);
+    }
+
+    profile.Reset();
+    REQUIRE(profile.count(0) == 0);
+    REQUIRE(profile.total(0, PerfCounter::CYCLES) == 0);
+
+#if defined(CPPTRADER_PERF_COUNTERS)
+    MarketManager market;
+    REQUIRE(market.perf_profile().regions() == MarketStatistics::OPERATIONS);
+    REQUIRE(market.perf_profile().name((size_t)MarketOperation::MATCH_ORDER) == "MATCH_ORDER");
+#endif
+}
@@ -0,0 +1,127 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/risk/position_book.h"
+
+using namespace CppTrader::Risk;
+
+TEST_CASE("Position book", "[CppTrader][Risk]")
+{
+    PositionBook book;
+    REQUIRE(book.empty());
+    REQUIRE(book.GetPosition(0, 1000) == nullptr);
+    REQUIRE(book.GetAccount(1000) == -1);
+
+    // Accounts get dense indexes in the order of registration
+    REQUIRE(book.AddAccount(1000) == 0);
+    REQUIRE(book.AddAccount(7) == 1);
+    REQUIRE(book.AddAccount(1000) == 0);
+    REQUIRE(book.accounts() == 2);
+
+    Position& position = book.AddPosition(3, 7);
+    REQUIRE(book.size() == 1);
+    REQUIRE(position.SymbolId == 3);
+    REQUIRE(position.AccountId == 7);
+    REQUIRE(position.Quantity == 0);
+    REQUIRE(position.RealizedPnL == 0.0);
+    position.Quantity = 10;
+
+    // Existing position is returned by the next add
+    REQUIRE(book.AddPosition(3, 7).Quantity == 10);
+    REQUIRE(book.size() == 1);
+    REQUIRE(book.GetPosition(3, 7)->Quantity == 10);
+    REQUIRE(book.GetPosition(PositionBook::Key{ 3, 1 })->Quantity == 10);
+    REQUIRE(book.GetPosition(3, 1000) == nullptr);
+    REQUIRE(book.GetPosition(2, 7) == nullptr);
+    REQUIRE(book.GetPosition(100, 7) == nullptr);
+
+    book.AddPosition(3, 1000);
+    book.AddPosition(0, 5);
+    REQUIRE(book.size() == 3);
+    REQUIRE(book.accounts() == 3);
+
+    // Positions of the symbol are visited in the order of account indexes
+    std::vector<uint64_t> accounts;
+    book.ForEachPosition(3, [&](Position& p, PositionBook::Key key) { accounts.push_back(p.AccountId); REQUIRE(key.Symbol == 3); });
+    REQUIRE(accounts == std::vector<uint64_t>({ 1000, 7 }));
+}
+
+TEST_CASE("Position book dirty list", "[CppTrader][Risk]")
+{
+    PositionBook book;
+    for (uint64_t account = 1; account <= 10; ++account)
+        for (uint32_t symbol = 0; symbol < 4; ++symbol)
+            book.AddPosition(symbol, account);
+    REQUIRE(book.size() == 40);
+    REQUIRE(book.dirty() == 0);
+
+    // Each position is listed once in the order of marking
+    REQUIRE(book.MarkDirty(2, 5));
+    REQUIRE(book.MarkDirty(0, 1));
+    REQUIRE(book.MarkDirty(2, 5));
+    REQUIRE(!book.MarkDirty(7, 5));
+    REQUIRE(!book.MarkDirty(2, 11));
+    REQUIRE(book.dirty() == 2);
+
+    std::vector<uint64_t> flushed;
+    REQUIRE(book.FlushDirty([&](const Position& p) { flushed.push_back(p.SymbolId * 100 + p.AccountId); }) == 2);
+    REQUIRE(flushed == std::vector<uint64_t>({ 205, 1 }));
+    REQUIRE(book.dirty() == 0);
+
+    // Flushed positions could be marked again
+    REQUIRE(book.MarkDirty(2, 5));
+    REQUIRE(book.dirty() == 1);
+
+    book.Clear();
+    REQUIRE(book.empty());
+    REQUIRE(book.dirty() == 0);
+    REQUIRE(book.GetPosition(2, 5) == nullptr);
+}
+
+TEST_CASE("Position book holders", "[CppTrader][Risk]")
+{
+    PositionBook book;
+    for (uint64_t account = 1; account <= 100; ++account)
+        book.AddPosition(0, account);
+    REQUIRE(book.holders(0) == 0);
+    REQUIRE(book.holders(5) == 0);
+
+    // Accounts with non-zero quantity become holders when marked
+    for (uint64_t account = 10; account <= 30; account += 10)
+    {
+        book.GetPosition(0, account)->Quantity = account;
+        book.MarkDirty(0, account);
+    }
+    book.MarkDirty(0, 50);
+    REQUIRE(book.holders(0) == 3);
+
+    // Only holders are visited
+    uint64_t visited = 0;
+    book.ForEachHolder(0, [&](Position& p, PositionBook::Key key) { visited += p.AccountId; REQUIRE(p.Quantity != 0); });
+    REQUIRE(visited == 60);
+
+    // Flat positions are removed from holders, even while visiting them
+    book.ForEachHolder(0, [&](Position& p, PositionBook::Key key)
+    {
+        if (p.AccountId != 20)
+        {
+            p.Quantity = 0;
+            book.MarkDirty(key);
+        }
+    });
+    REQUIRE(book.holders(0) == 1);
+    visited = 0;
+    book.ForEachHolder(0, [&](Position& p, PositionBook::Key key) { visited += p.AccountId; });
+    REQUIRE(visited == 20);
+
+    // Holder could be re-added and removed again
+    book.GetPosition(0, 10)->Quantity = 5;
+    book.MarkDirty(0, 10);
+    book.GetPosition(0, 20)->Quantity = 0;
+    book.MarkDirty(0, 20);
+    REQUIRE(book.holders(0) == 1);
+    book.ForEachHolder(0, [&](Position& p, PositionBook::Key key) { REQUIRE(p.AccountId == 10); });
+}
@@ -0,0 +1,167 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/redis_db.h"
+
+#include <atomic>
+
+namespace {
+
+// Tests are run against the local Redis server and skipped if it is not available
+bool Available(MyRedis& redis)
+{
+    if (redis._set_db("cpptrader:test:ping", "1"))
+        return true;
+    WARN("Redis server is not available on 127.0.0.1:6379");
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("Redis pipeline and transaction", "[CppTrader][Redis]")
+{
+    MyRedis redis;
+    if (!Available(redis))
+        return;
+
+    redis._del_db("cpptrader:test:list");
+
+    {
+        // Commands are shipped by the single flush
+        MyRedisPipeline pipeline = redis._pipeline_db();
+        pipeline._set_db("cpptrader:test:a", "1")._set_db("cpptrader:test:b", "2");
+        pipeline._append_db("cpptrader:test:list", std::vector<uint64_t>{ 1, 2, 3 });
+        pipeline._get_db("cpptrader:test:a")._get_db("cpptrader:test:missing")._lrange_db("cpptrader:test:list");
+        REQUIRE(pipeline.size() == 6);
+        REQUIRE(pipeline._exec());
+        REQUIRE(pipeline.size() == 0);
+
+        MyRedisReplies replies = pipeline._replies();
+        REQUIRE(replies.size() == 6);
+        REQUIRE(replies._ok(0));
+        REQUIRE(replies._integer(2) == 3);
+        REQUIRE(replies._string(3).value() == "1");
+        REQUIRE(!replies._string(4));
+        REQUIRE(replies._list(5) == std::vector<std::string>{ "1", "2", "3" });
+
+        // Pipeline is reused by the next flush
+        pipeline._del_db("cpptrader:test:b");
+        REQUIRE(pipeline._exec());
+        REQUIRE(pipeline._replies()._integer(0) == 1);
+
+        // Command error fails only its own reply
+        pipeline._hgetall_db("cpptrader:test:list")._get_db("cpptrader:test:a");
+        REQUIRE(pipeline._exec());
+        REQUIRE(!pipeline._replies()._ok(0));
+        REQUIRE(pipeline._replies()._hash(0).empty());
+        REQUIRE(pipeline._replies()._string(1).value() == "1");
+    }
+
+    // Borrowed connection is returned to the client with the pipeline
+    REQUIRE(redis._get_db("cpptrader:test:a") == "1");
+
+    {
+        MyRedisTransaction transaction = redis._transaction_db();
+        transaction._hmset_db("cpptrader:test:hash", { { "Id", "1" }, { "Name", "AAPL" } });
+        transaction._del_db("cpptrader:test:a");
+        transaction._hgetall_db("cpptrader:test:hash");
+        REQUIRE(transaction._exec());
+
+        MyRedisReplies replies = transaction._replies();
+        REQUIRE(replies.size() == 3);
+        REQUIRE(replies._integer(1) == 1);
+        REQUIRE(replies._hash(2).at("Name") == "AAPL");
+    }
+
+    // Bulk hashes read
+    auto hashes = redis._hgetall_db(std::vector<std::string>{ "cpptrader:test:hash", "cpptrader:test:missing" });
+    REQUIRE(hashes.size() == 2);
+    REQUIRE(hashes[0].at("Id") == "1");
+    REQUIRE(hashes[1].empty());
+
+    redis._del_db("cpptrader:test:hash");
+    redis._del_db("cpptrader:test:list");
+}
+
+TEST_CASE("Redis asynchronous client", "[CppTrader][Redis]")
+{
+    MyRedis redis;
+    if (!Available(redis))
+        return;
+
+    MyRedisAsync async(redis);
+    REQUIRE(!async.Submit([](MyRedisPipeline& pipeline) { pipeline._get_db("cpptrader:test:ping"); }));
+    REQUIRE(async.Start());
+    REQUIRE(!async.Start());
+    REQUIRE(async.IsStarted());
+
+    // Batches of several threads are completed in the order of submission with their own replies
+    std::mutex mutex;
+    std::vector<int> completed;
+    std::atomic<int> rejected{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                std::string key = "cpptrader:test:async:" + std::to_string(t);
+                std::string value = std::to_string(i);
+                bool submitted = async.Submit([key, value](MyRedisPipeline& pipeline) { pipeline._set_db(key, value)._get_db(key); },
+                    [&, t, value](bool result, MyRedisReplies& replies)
+                    {
+                        std::scoped_lock locker(mutex);
+                        if (result && (replies.size() == 2) && (replies._string(1).value_or("") == value))
+                            completed.push_back(t * 1000 + std::stoi(value));
+                    });
+                if (!submitted)
+                    ++rejected;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    async.Flush();
+    REQUIRE(rejected == 0);
+    REQUIRE(completed.size() == 400);
+    for (int t = 0; t < 4; ++t)
+    {
+        std::vector<int> order;
+        for (int value : completed)
+            if (value / 1000 == t)
+                order.push_back(value % 1000);
+        REQUIRE(std::is_sorted(order.begin(), order.end()));
+    }
+
+    // Completion callback may submit and flush without the deadlock
+    std::atomic<bool> nested{false};
+    std::atomic<bool> stopped{true};
+    REQUIRE(async.Submit([](MyRedisPipeline& pipeline) { pipeline._get_db("cpptrader:test:ping"); },
+        [&](bool result, MyRedisReplies& replies)
+        {
+            async.Submit([](MyRedisPipeline& pipeline) { pipeline._get_db("cpptrader:test:ping"); },
+                [&](bool result, MyRedisReplies& replies) { nested = result && (replies._string(0).value_or("") == "1"); });
+            async.Flush();
+            stopped = async.Stop();
+        }));
+    async.Flush();
+    async.Flush();
+    REQUIRE(nested);
+    REQUIRE(!stopped);
+
+    // Stop ships the remaining batches
+    std::atomic<int> last{0};
+    for (int i = 0; i < 10; ++i)
+        async.Submit([](MyRedisPipeline& pipeline) { pipeline._get_db("cpptrader:test:ping"); }, [&](bool result, MyRedisReplies&) { last += result ? 1 : 0; });
+    REQUIRE(async.Stop());
+    REQUIRE(!async.Stop());
+    REQUIRE(last == 10);
+    REQUIRE(!async.Submit([](MyRedisPipeline& pipeline) { pipeline._get_db("cpptrader:test:ping"); }));
+
+    for (int t = 0; t < 4; ++t)
+        redis._del_db("cpptrader:test:async:" + std::to_string(t));
+}
@@ -0,0 +1,157 @@
+//
+// Created by Chris Urbanowicz on 18.10.2026
+//
+
+#include "test.h"
+
+#include "trader/replay/event_replayer.h"
+#include "trader/replay/itch_converter.h"
+
+#include <vector>
+
+using namespace CppTrader::Matching;
+using namespace CppTrader::Replay;
+
+namespace {
+
+class MyITCHConverter : public ITCHConverter
+{
+public:
+    std::vector<Event> events;
+
+protected:
+    bool onEvent(const Event& event) override { events.push_back(event); return true; }
+};
+
+void Append(std::vector<uint8_t>& buffer, uint64_t value, size_t size)
+{
+    for (size_t i = size; i-- > 0;)
+        buffer.push_back((uint8_t)(value >> (8 * i)));
+}
+
+void AppendString(std::vector<uint8_t>& buffer, const char* value, size_t size)
+{
+    buffer.insert(buffer.end(), value, value + size);
+}
+
+// Prepare length prefixed ITCH message with a common header
+std::vector<uint8_t> Message(char type, uint16_t locate, uint64_t timestamp, const std::vector<uint8_t>& body)
+{
+    std::vector<uint8_t> message;
+    Append(message, 1 + 2 + 2 + 6 + body.size(), 2);
+    message.push_back((uint8_t)type);
+    Append(message, locate, 2);
+    Append(message, 0, 2);
+    Append(message, timestamp, 6);
+    message.insert(message.end(), body.begin(), body.end());
+    return message;
+}
+
+std::vector<uint8_t> StockDirectory(uint16_t locate, const char* stock)
+{
+    std::vector<uint8_t> body;
+    AppendString(body, stock, 8);
+    body.insert(body.end(), 20, 0);
+    return Message('R', locate, 1, body);
+}
+
+std::vector<uint8_t> AddOrder(uint16_t locate, uint64_t timestamp, uint64_t id, char side, uint32_t shares, uint32_t price)
+{
+    std::vector<uint8_t> body;
+    Append(body, id, 8);
+    body.push_back((uint8_t)side);
+    Append(body, shares, 4);
+    AppendString(body, "TEST    ", 8);
+    Append(body, price, 4);
+    return Message('A', locate, timestamp, body);
+}
+
+std::vector<uint8_t> OrderCancel(uint16_t locate, uint64_t timestamp, uint64_t id, uint32_t shares)
+{
+    std::vector<uint8_t> body;
+    Append(body, id, 8);
+    Append(body, shares, 4);
+    return Message('X', locate, timestamp, body);
+}
+
+std::vector<uint8_t> OrderReplace(uint16_t locate, uint64_t timestamp, uint64_t id, uint64_t new_id, uint32_t shares, uint32_t price)
+{
+    std::vector<uint8_t> body;
+    Append(body, id, 8);
+    Append(body, new_id, 8);
+    Append(body, shares, 4);
+    Append(body, price, 4);
+    return Message('U', locate, timestamp, body);
+}
+
+std::vector<uint8_t> OrderDelete(uint16_t locate, uint64_t timestamp, uint64_t id)
+{
+    std::vector<uint8_t> body;
+    Append(body, id, 8);
+    return Message('D', locate, timestamp, body);
+}
+
+} // namespace
+
+TEST_CASE("ITCHConverter", "[CppTrader][Replay]")
+{
+    std::vector<std::vector<uint8_t>> messages = {
+        StockDirectory(7, "TEST    "),
+        AddOrder(7, 0x0102030405ULL, 1, 'B', 100, 10000),
+        AddOrder(7, 0x0102030406ULL, 2, 'S', 200, 10100),
+        OrderCancel(7, 0x0102030407ULL, 1, 40),
+        OrderReplace(7, 0x0102030408ULL, 2, 3, 150, 10200),
+        OrderDelete(7, 0x0102030409ULL, 1)
+    };
+
+    std::vector<uint8_t> stream;
+    for (const auto& message : messages)
+        stream.insert(stream.end(), message.begin(), message.end());
+
+    MyITCHConverter converter;
+    REQUIRE(converter.Process(stream.data(), stream.size()));
+    REQUIRE(converter.errors() == 0);
+    REQUIRE(converter.messages() == 6);
+    REQUIRE(converter.events.size() == 6);
+
+    const auto& events = converter.events;
+    REQUIRE(events[0].Type == EventType::SYMBOL);
+    REQUIRE(events[0].Symbol == 7);
+    REQUIRE(std::memcmp(events[0].Name, "TEST    ", 8) == 0);
+    REQUIRE(events[1].Type == EventType::ADD);
+    REQUIRE(events[1].Timestamp == 0x0102030405ULL);
+    REQUIRE(events[1].OrderId == 1);
+    REQUIRE(events[1].Side == OrderSide::BUY);
+    REQUIRE(events[1].Price == 10000);
+    REQUIRE(events[1].Quantity == 100);
+    REQUIRE(events[2].Side == OrderSide::SELL);
+    REQUIRE(events[3].Type == EventType::CANCEL);
+    REQUIRE(events[3].Quantity == 40);
+    REQUIRE(events[4].Type == EventType::REPLACE);
+    REQUIRE(events[4].OrderId == 2);
+    REQUIRE(events[4].NewOrderId == 3);
+    REQUIRE(events[5].Type == EventType::DELETE);
+    REQUIRE(events[5].Timestamp == 0x0102030409ULL);
+
+    SECTION("Replay")
+    {
+        MarketManager market;
+        EventReplayer replayer(market);
+        replayer.Replay(events.data(), events.data() + 4);
+
+        REQUIRE(replayer.errors() == 0);
+        REQUIRE(market.GetOrderBook(7) != nullptr);
+        REQUIRE(market.GetOrder(1)->LeavesQuantity == 60);
+
+        replayer.Replay(events.data() + 4, events.data() + events.size());
+
+        REQUIRE(replayer.events() == 6);
+        REQUIRE(replayer.errors() == 0);
+        REQUIRE(market.GetOrder(1) == nullptr);
+        REQUIRE(market.GetOrder(2) == nullptr);
+        REQUIRE(market.GetOrder(3)->Price == 10200);
+        REQUIRE(market.GetOrder(3)->Side == OrderSide::SELL);
+        REQUIRE(market.GetOrderBook(7)->best_ask()->Price == 10200);
+        REQUIRE(market.GetOrderBook(7)->best_bid() == nullptr);
+    }
+}
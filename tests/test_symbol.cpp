@@ -0,0 +1,113 @@
+//
+// Created by Chris Urbanowicz on 19.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/symbol.h"
+#include "trader/matching/symbol_registry.h"
+
+#include <thread>
+
+using namespace CppTrader::Matching;
+
+TEST_CASE("Symbol parsing", "[CppTrader][Matching]")
+{
+    Symbol symbol;
+
+    REQUIRE(Symbol::Parse({ { "Id", "12" }, { "Name", "BTCUSD" }, { "Type", "10" }, { "Multiplier", "1000" }, { "QuantityDivisor", "10" } }, symbol));
+    REQUIRE(symbol.Id == 12);
+    REQUIRE(std::string(symbol.Name, 6) == "BTCUSD");
+    REQUIRE(symbol.Name[6] == 0);
+    REQUIRE(symbol.Type == SymbolType::INVERSEPERP);
+    REQUIRE(symbol.Multiplier == 1000);
+    REQUIRE(symbol.QuantityDivisor == 10);
+
+    // Optional fields are defaulted and long names are truncated
+    REQUIRE(Symbol::Parse({ { "Id", "3" }, { "Name", "VERYLONGNAME" }, { "Type", "0" } }, symbol));
+    REQUIRE(symbol.Id == 3);
+    REQUIRE(std::string(symbol.Name, 8) == "VERYLONG");
+    REQUIRE(symbol.Multiplier == 1);
+    REQUIRE(symbol.QuantityDivisor == 100);
+
+    // Missing and malformed fields
+    REQUIRE(!Symbol::Parse({}, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Type", "0" } }, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3x" }, { "Name", "ETHUSD" }, { "Type", "0" } }, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "0" }, { "Multiplier", "-1" } }, symbol));
+
+    // Only symbol type enumerators are accepted
+    REQUIRE(Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "13" } }, symbol));
+    REQUIRE(symbol.Type == SymbolType::OPTIONINVERSEFUT);
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "5" } }, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "14" } }, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "266" } }, symbol));
+    REQUIRE(!Symbol::Parse({ { "Id", "3" }, { "Name", "ETHUSD" }, { "Type", "4294967306" } }, symbol));
+
+    // Legacy reader returns the empty symbol
+    REQUIRE(symbol.ReadDbStructure({}).Id == 0);
+}
+
+TEST_CASE("Symbol registry updates", "[CppTrader][Matching]")
+{
+    const char btc[8] = "BTCUSD";
+    const char eth[8] = "ETHUSD";
+    const char rbw[8] = "RBWUSD";
+    const char xrp[8] = "XRPUSD";
+    const char sol[8] = "SOLUSD";
+
+    SymbolRegistry registry;
+    REQUIRE(registry.empty());
+    REQUIRE(registry.Update() == 0);
+
+    // Queued changes are not visible until the update
+    registry.Push(Symbol(1, btc, SymbolType::VANILLAPERP, 1000, 10));
+    registry.Push(Symbol(4, eth, SymbolType::INVERSEPERP, 50, 100));
+    REQUIRE(registry.GetSymbol(1) == nullptr);
+    REQUIRE(registry.Update() == 2);
+    REQUIRE(registry.size() == 2);
+    REQUIRE(registry.GetSymbol(1)->Multiplier == 1000);
+    REQUIRE(registry.GetSymbol(4)->Type == SymbolType::INVERSEPERP);
+    REQUIRE(registry.GetSymbol(2) == nullptr);
+    REQUIRE(registry.GetSymbol(100) == nullptr);
+    REQUIRE(registry.Update() == 0);
+
+    // Changes of the same symbol are coalesced into the latest one
+    registry.Push(Symbol(1, btc, SymbolType::VANILLAPERP, 2000, 10));
+    registry.Push(Symbol(1, btc, SymbolType::VANILLAPERP, 3000, 10));
+    registry.Remove(4);
+    registry.Push(Symbol(2, rbw, SymbolType::INVERSEFUT, 100, 1));
+    registry.Push(Symbol(9, xrp, SymbolType::SPOT, 1, 100));
+    registry.Remove(9);
+    registry.Remove(7);
+    REQUIRE(registry.GetSymbol(1)->Multiplier == 1000);
+    REQUIRE(registry.GetSymbol(4) != nullptr);
+
+    // Removals of unknown symbols are not applied
+    std::vector<std::pair<uint32_t, bool>> changes;
+    REQUIRE(registry.Update([&](uint32_t id, const Symbol* symbol) { changes.emplace_back(id, symbol != nullptr); }) == 3);
+    REQUIRE(changes == std::vector<std::pair<uint32_t, bool>>{ { 1, true }, { 4, false }, { 2, true } });
+    REQUIRE(registry.size() == 2);
+    REQUIRE(registry.GetSymbol(1)->Multiplier == 3000);
+    REQUIRE(registry.GetSymbol(4) == nullptr);
+    REQUIRE(registry.GetSymbol(9) == nullptr);
+
+    std::vector<uint32_t> ids;
+    registry.ForEachSymbol([&](const Symbol& symbol) { ids.push_back(symbol.Id); });
+    REQUIRE(ids == std::vector<uint32_t>{ 1, 2 });
+
+    // Producer thread queues changes while the owner swaps the buffers
+    std::thread producer([&registry, &sol]()
+    {
+        for (uint64_t i = 1; i <= 10000; ++i)
+            registry.Push(Symbol(3, sol, SymbolType::SPOT, i, 100));
+    });
+    size_t applied = 0;
+    while ((registry.GetSymbol(3) == nullptr) || (registry.GetSymbol(3)->Multiplier != 10000))
+        applied += registry.Update();
+    producer.join();
+    REQUIRE(applied >= 1);
+    REQUIRE(applied <= 10000);
+    REQUIRE(registry.Update() == 0);
+    REQUIRE(registry.size() == 3);
+}